@@ -0,0 +1,27 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // the input must outlive the resulting node and all of its copies.
+    std::string s = "foo: bar\nbaz: [qux, 'quux']\n";
+    fkyaml::node n = fkyaml::node::deserialize_borrowed(s);
+
+    // string scalars are read without being copied.
+    std::cout << n << std::endl;
+
+    // as_str() on a non-const node makes an owned copy of a borrowed string.
+    std::string& foo = n["foo"].as_str();
+    foo += "bar";
+    std::cout << n["foo"].get_value<std::string>() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // prepare a YAML string which consists of many documents.
+    std::string s;
+    for (int i = 0; i < 1000; i++) {
+        s += "---\nid: " + std::to_string(i) + "\nname: item" + std::to_string(i) + "\n";
+    }
+
+    // deserialize the documents with 4 threads.
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(s, 4);
+
+    // the documents are in the order of the input.
+    std::cout << docs.size() << std::endl;
+    std::cout << docs[0] << std::endl;
+    std::cout << docs[999] << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // small payloads received one after another.
+    std::vector<std::string> payloads = {
+        "id: 1\nmethod: get\nparams: [foo]",
+        "id: 2\nmethod: set\nparams: [foo, 123]",
+        "id: 3\nmethod: delete\nparams: [bar]",
+    };
+
+    // the deserializer reuses its internal buffers for every payload.
+    fkyaml::node::deserializer deserializer;
+    for (const auto& payload : payloads) {
+        fkyaml::node request = deserializer.deserialize(payload);
+        std::cout << request["id"].get_value<int>() << ": " << request["method"].get_value<std::string>() << " "
+                  << request["params"].size() << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <fstream>
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // open a YAML file which contains multiple documents.
+    std::ifstream ifs("input_multi.yaml");
+
+    // read the YAML documents one by one.
+    // Each document is deserialized as soon as its end is found in the input.
+    fkyaml::node::document_reader reader(ifs);
+    fkyaml::node doc;
+    while (reader.next_document(doc)) {
+        std::cout << doc << std::endl;
+    }
+
+    return 0;
+}
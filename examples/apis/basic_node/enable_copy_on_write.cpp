@@ -0,0 +1,34 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    fkyaml::node config = fkyaml::node::deserialize("server: {host: localhost, port: 8080}\nusers: [alice, bob]\n");
+
+    // let copies share the container and string values.
+    config.enable_copy_on_write();
+
+    // copying the node doesn't copy the values.
+    fkyaml::node snapshot = config;
+
+    // modification copies only the values on the path to the modified node.
+    config["server"]["port"] = 8081;
+
+    std::cout << config << std::endl;
+    std::cout << snapshot << std::endl;
+
+    // untouched values are still shared.
+    const fkyaml::node& const_config = config;
+    const fkyaml::node& const_snapshot = snapshot;
+    std::cout << std::boolalpha;
+    std::cout << (&const_config["users"].as_seq() == &const_snapshot["users"].as_seq()) << std::endl;
+    std::cout << (&const_config["server"].as_map() == &const_snapshot["server"].as_map()) << std::endl;
+    return 0;
+}
@@ -0,0 +1,24 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // the input must outlive the resulting node and all of its copies.
+    std::string s = "foo: bar\n";
+    const fkyaml::node n = fkyaml::node::deserialize_borrowed(s);
+
+    // read the string value which refers to the input without copying it.
+    auto view = n["foo"].get_str_view();
+    std::cout << std::string(view.data(), view.size()) << std::endl;
+    std::cout << view.size() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+// prints parse events with indentation. Callbacks which are not overridden just continue parsing.
+class event_printer : public fkyaml::event_handler {
+public:
+    bool start_mapping() override {
+        print("start_mapping");
+        ++depth;
+        return true;
+    }
+    bool end_mapping() override {
+        --depth;
+        print("end_mapping");
+        return true;
+    }
+    bool start_sequence() override {
+        print("start_sequence");
+        ++depth;
+        return true;
+    }
+    bool end_sequence() override {
+        --depth;
+        print("end_sequence");
+        return true;
+    }
+    bool scalar(const char* value, std::size_t length, fkyaml::scalar_style /*unused*/) override {
+        print("scalar: " + std::string(value, length));
+        return true;
+    }
+    bool anchor(const char* name, std::size_t length) override {
+        print("anchor: " + std::string(name, length));
+        return true;
+    }
+    bool alias(const char* name, std::size_t length) override {
+        print("alias: " + std::string(name, length));
+        return true;
+    }
+
+private:
+    void print(const std::string& message) const {
+        std::cout << std::string(depth * 2, ' ') << message << std::endl;
+    }
+
+    std::size_t depth {0};
+};
+
+int main() {
+    // no basic_node objects are created while parsing.
+    event_printer printer;
+    bool completed = fkyaml::node::parse_events("foo: &anchor [1, 2]\nbar: *anchor\n", printer);
+
+    std::cout << std::boolalpha << completed << std::endl;
+    return 0;
+}
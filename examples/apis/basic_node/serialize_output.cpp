@@ -0,0 +1,31 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main() {
+    fkyaml::node n = {{"foo", true}, {"bar", {1, 2, 3}}, {"baz", "qux"}};
+
+    // write the result into an output stream without building a whole string.
+    fkyaml::node::serialize(n, std::cout);
+
+    // write the result through a fixed-size buffer. The callback is called whenever the buffer gets full.
+    char buffer[16];
+    std::size_t num_chunks = 0;
+    std::string result;
+    fkyaml::node::serialize(n, buffer, sizeof(buffer), [&](const char* chars, std::size_t size) {
+        result.append(chars, size);
+        ++num_chunks;
+    });
+    std::cout << "num_chunks: " << num_chunks << ", size: " << result.size() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    fkyaml::deserialization_limits limits;
+    limits.max_depth = 16;
+    limits.max_aliases = 100;
+    limits.max_expanded_nodes = 10000;
+
+    // a document within the limits is deserialized as usual.
+    fkyaml::node n = fkyaml::node::deserialize("base: &base {x: 1, y: 2}\ncopy: *base\n", limits);
+    std::cout << n["copy"]["y"].as_int() << std::endl;
+
+    // each alias below expands into 10 times as many nodes as the previous one.
+    std::string laughs = "a: &a [lol, lol, lol, lol, lol, lol, lol, lol, lol, lol]\n"
+                         "b: &b [*a, *a, *a, *a, *a, *a, *a, *a, *a, *a]\n"
+                         "c: &c [*b, *b, *b, *b, *b, *b, *b, *b, *b, *b]\n"
+                         "d: &d [*c, *c, *c, *c, *c, *c, *c, *c, *c, *c]\n";
+    try {
+        fkyaml::node bomb = fkyaml::node::deserialize(laughs, limits);
+    }
+    catch (const fkyaml::limit_exceeded& e) {
+        std::cout << e.what() << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+// a basic_node type whose mapping nodes use indexed_ordered_map.
+using indexed_node = fkyaml::basic_node<std::vector, fkyaml::indexed_ordered_map>;
+
+int main() {
+    indexed_node n = indexed_node::deserialize("foo: 123\nbar: true\n");
+
+    std::cout << n["foo"].as_int() << std::endl;
+    std::cout << indexed_node::serialize(n);
+
+    return 0;
+}
@@ -0,0 +1,28 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // map the whole contents of a YAML file into memory.
+    // fkyaml::exception will be thrown if the file cannot be opened.
+    fkyaml::mapped_file file("input.yaml");
+
+    // deserialize the file contents. The file object must outlive the deserialization.
+    fkyaml::node n = fkyaml::node::deserialize(file);
+
+    // check the deserialization result.
+    std::cout << n["foo"].get_value<bool>() << std::endl;
+    std::cout << n["bar"].get_value<std::int64_t>() << std::endl;
+    std::cout << std::setprecision(3) << n["baz"].get_value<double>() << std::endl;
+
+    return 0;
+}
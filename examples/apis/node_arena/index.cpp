@@ -0,0 +1,30 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // an arena must outlive all the nodes whose values are allocated from it.
+    fkyaml::node_arena arena;
+    {
+        // node values created while the scope is alive are allocated from the arena.
+        fkyaml::arena_scope scope(arena);
+
+        fkyaml::arena_node n = fkyaml::arena_node::deserialize("foo: [1, 2, 3]\nbar: baz\n");
+        std::cout << n["foo"].size() << std::endl;
+        std::cout << n["bar"].as_str() << std::endl;
+        std::cout << std::boolalpha << (arena.allocated_bytes() > 0) << std::endl;
+    }
+
+    // release all the memory at once. (also done in the destructor.)
+    arena.release();
+    std::cout << arena.allocated_bytes() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+int main() {
+    fkyaml::node manifest = fkyaml::node::deserialize(std::string("metadata:\n"
+                                                                  "  name: web\n"
+                                                                  "spec:\n"
+                                                                  "  containers:\n"
+                                                                  "    - image: nginx:1.27\n"
+                                                                  "      ports: [80, 443]\n"));
+
+    // compile paths once, either from dotted paths or from JSON Pointers.
+    fkyaml::path image_path("spec.containers[0].image");
+    fkyaml::path port_path("/spec/containers/0/ports/1");
+
+    std::cout << manifest.at(image_path).as_str() << std::endl;
+    std::cout << manifest.at(port_path).as_int() << std::endl;
+
+    // find() returns nullptr instead of throwing an exception if the node is not found.
+    std::cout << std::boolalpha << (manifest.find(fkyaml::path("spec.volumes")) == nullptr) << std::endl;
+
+    // paths in a batch are evaluated at once, traversing their common prefixes only once.
+    fkyaml::path_batch batch {fkyaml::path("metadata.name"), image_path, port_path};
+    std::vector<const fkyaml::node*> results;
+    manifest.find(batch, results);
+    for (const fkyaml::node* p_node : results) {
+        std::cout << *p_node << std::endl;
+    }
+
+    return 0;
+}
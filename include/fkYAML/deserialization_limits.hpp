@@ -0,0 +1,35 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DESERIALIZATION_LIMITS_HPP
+#define FK_YAML_DESERIALIZATION_LIMITS_HPP
+
+#include <cstddef>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief Limits on the structure of each YAML document checked during deserialization.
+/// @note
+/// A limit of 0 means no limit, which is the default for all of them. Exceeding any of the limits makes the
+/// deserialization throw a fkyaml::limit_exceeded exception.
+/// @sa https://fktn-k.github.io/fkYAML/api/deserialization_limits/
+struct deserialization_limits {
+    /// The maximum number of collections (sequences and mappings) in which a node is nested.
+    /// Aliases do not add their anchored nodes' depths; the number of expanded nodes bounds them instead.
+    std::size_t max_depth {0};
+    /// The maximum number of alias nodes in a document.
+    std::size_t max_aliases {0};
+    /// The maximum number of nodes in a document, where each alias node counts as the nodes of its anchored node.
+    std::size_t max_expanded_nodes {0};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_DESERIALIZATION_LIMITS_HPP */
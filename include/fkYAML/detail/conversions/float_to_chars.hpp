@@ -0,0 +1,504 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_CONVERSIONS_FLOAT_TO_CHARS_HPP
+#define FK_YAML_DETAIL_CONVERSIONS_FLOAT_TO_CHARS_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/assert.hpp>
+
+#if FK_YAML_HAS_TO_CHARS
+#include <charconv>
+#endif
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// The buffer size which is large enough for the shortest representation of any finite float or double value.
+constexpr std::size_t float_to_chars_buffer_size = 32;
+
+#if !FK_YAML_HAS_TO_CHARS
+
+// The following implementation of the Grisu2 algorithm is based on:
+//   Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers", PLDI 2010.
+// Grisu2 always produces a decimal representation which is converted back to the original value, and the
+// representation is the shortest one in the vast majority of cases.
+
+namespace grisu2 {
+
+/// @brief A floating point number whose significand and exponent are represented by integers. (f * 2^e)
+struct diyfp {
+    /// @brief Construct a new diyfp object.
+    /// @param f_ The significand.
+    /// @param e_ The binary exponent.
+    constexpr diyfp(uint64_t f_, int e_) noexcept
+        : f(f_),
+          e(e_) {
+    }
+
+    /// @brief Subtract two diyfp values with the same exponent. (x - y)
+    /// @param x The minuend, which must not be less than y.
+    /// @param y The subtrahend.
+    /// @return The difference.
+    static diyfp sub(const diyfp& x, const diyfp& y) noexcept {
+        FK_YAML_ASSERT(x.e == y.e && x.f >= y.f);
+        return {x.f - y.f, x.e};
+    }
+
+    /// @brief Multiply two diyfp values and round the result to the upper 64 bits of the 128-bit product.
+    /// @param x A multiplicand.
+    /// @param y A multiplier.
+    /// @return The rounded product.
+    static diyfp mul(const diyfp& x, const diyfp& y) noexcept {
+        const uint64_t u_lo = x.f & 0xFFFFFFFFu;
+        const uint64_t u_hi = x.f >> 32u;
+        const uint64_t v_lo = y.f & 0xFFFFFFFFu;
+        const uint64_t v_hi = y.f >> 32u;
+
+        const uint64_t p0 = u_lo * v_lo;
+        const uint64_t p1 = u_lo * v_hi;
+        const uint64_t p2 = u_hi * v_lo;
+        const uint64_t p3 = u_hi * v_hi;
+
+        uint64_t q = (p0 >> 32u) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        q += uint64_t {1} << 31u; // round half up
+
+        return {p3 + (p1 >> 32u) + (p2 >> 32u) + (q >> 32u), x.e + y.e + 64};
+    }
+
+    /// @brief Normalize a diyfp value so that the most significant bit of its significand is set.
+    /// @param x A non-zero diyfp value.
+    /// @return The normalized value.
+    static diyfp normalize(diyfp x) noexcept {
+        FK_YAML_ASSERT(x.f != 0);
+        while ((x.f >> 63u) == 0) {
+            x.f <<= 1u;
+            x.e--;
+        }
+        return x;
+    }
+
+    /// @brief Normalize a diyfp value so that its exponent becomes the target one.
+    /// @param x A diyfp value whose exponent is not less than the target one.
+    /// @param target_exponent The target exponent.
+    /// @return The normalized value.
+    static diyfp normalize_to(const diyfp& x, int target_exponent) noexcept {
+        const int delta = x.e - target_exponent;
+        FK_YAML_ASSERT(delta >= 0 && ((x.f << static_cast<uint32_t>(delta)) >> static_cast<uint32_t>(delta)) == x.f);
+        return {x.f << static_cast<uint32_t>(delta), target_exponent};
+    }
+
+    /// The significand.
+    uint64_t f {0};
+    /// The binary exponent.
+    int e {0};
+};
+
+/// @brief The normalized value and its boundaries, i.e., the midpoints to its adjacent floating point values.
+struct boundaries {
+    /// The normalized value.
+    diyfp w;
+    /// The lower boundary.
+    diyfp minus;
+    /// The upper boundary.
+    diyfp plus;
+};
+
+/// @brief Compute the boundaries of a positive finite floating point value.
+/// @tparam FloatType The floating point number type, either float or double.
+/// @param value A positive finite floating point value.
+/// @return The normalized value and its boundaries.
+template <typename FloatType>
+inline boundaries compute_boundaries(FloatType value) noexcept {
+    static_assert(
+        std::numeric_limits<FloatType>::is_iec559 && (sizeof(FloatType) == 4 || sizeof(FloatType) == 8),
+        "compute_boundaries() accepts IEEE 754 single or double precision values only.");
+    using bits_type = typename std::conditional<sizeof(FloatType) == 4, uint32_t, uint64_t>::type;
+
+    // the precision including the hidden bit.
+    constexpr int precision = std::numeric_limits<FloatType>::digits;
+    constexpr int bias = std::numeric_limits<FloatType>::max_exponent - 1 + (precision - 1);
+    constexpr int min_exponent = 1 - bias;
+    constexpr uint64_t hidden_bit = uint64_t {1} << static_cast<uint32_t>(precision - 1);
+
+    bits_type bits {};
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint64_t biased_exponent = static_cast<uint64_t>(bits) >> static_cast<uint32_t>(precision - 1);
+    const uint64_t fraction = static_cast<uint64_t>(bits) & (hidden_bit - 1);
+
+    const bool is_denormal = biased_exponent == 0;
+    const diyfp v = is_denormal ? diyfp(fraction, min_exponent)
+                                : diyfp(fraction + hidden_bit, static_cast<int>(biased_exponent) - bias);
+
+    // the lower boundary is closer if the value is a power of two other than the smallest normalized value.
+    const bool lower_boundary_is_closer = fraction == 0 && biased_exponent > 1;
+    const diyfp m_plus(2 * v.f + 1, v.e - 1);
+    const diyfp m_minus = lower_boundary_is_closer ? diyfp(4 * v.f - 1, v.e - 2) : diyfp(2 * v.f - 1, v.e - 1);
+
+    const diyfp w_plus = diyfp::normalize(m_plus);
+    const diyfp w_minus = diyfp::normalize_to(m_minus, w_plus.e);
+    return {diyfp::normalize(v), w_minus, w_plus};
+}
+
+/// @brief A cached power of ten. (c = f * 2^e ~= 10^k)
+struct cached_power {
+    /// The significand.
+    uint64_t f;
+    /// The binary exponent.
+    int e;
+    /// The decimal exponent.
+    int k;
+};
+
+/// The lower bound of the binary exponents of scaled values in the digit generation.
+constexpr int alpha = -60;
+/// The upper bound of the binary exponents of scaled values in the digit generation.
+constexpr int gamma = -32;
+
+/// @brief Get a cached power of ten c = 10^-k such that the binary exponent of c * w is in [alpha, gamma].
+/// @param e The binary exponent of a normalized value w.
+/// @return The cached power of ten.
+inline cached_power get_cached_power_for_binary_exponent(int e) noexcept {
+    constexpr int cached_powers_min_dec_exp = -300;
+    constexpr int cached_powers_dec_step = 8;
+
+    static constexpr cached_power cached_powers[] = {
+        {0xAB70FE17C79AC6CA, -1060, -300},
+        {0xFF77B1FCBEBCDC4F, -1034, -292},
+        {0xBE5691EF416BD60C, -1007, -284},
+        {0x8DD01FAD907FFC3C, -980, -276},
+        {0xD3515C2831559A83, -954, -268},
+        {0x9D71AC8FADA6C9B5, -927, -260},
+        {0xEA9C227723EE8BCB, -901, -252},
+        {0xAECC49914078536D, -874, -244},
+        {0x823C12795DB6CE57, -847, -236},
+        {0xC21094364DFB5637, -821, -228},
+        {0x9096EA6F3848984F, -794, -220},
+        {0xD77485CB25823AC7, -768, -212},
+        {0xA086CFCD97BF97F4, -741, -204},
+        {0xEF340A98172AACE5, -715, -196},
+        {0xB23867FB2A35B28E, -688, -188},
+        {0x84C8D4DFD2C63F3B, -661, -180},
+        {0xC5DD44271AD3CDBA, -635, -172},
+        {0x936B9FCEBB25C996, -608, -164},
+        {0xDBAC6C247D62A584, -582, -156},
+        {0xA3AB66580D5FDAF6, -555, -148},
+        {0xF3E2F893DEC3F126, -529, -140},
+        {0xB5B5ADA8AAFF80B8, -502, -132},
+        {0x87625F056C7C4A8B, -475, -124},
+        {0xC9BCFF6034C13053, -449, -116},
+        {0x964E858C91BA2655, -422, -108},
+        {0xDFF9772470297EBD, -396, -100},
+        {0xA6DFBD9FB8E5B88F, -369, -92},
+        {0xF8A95FCF88747D94, -343, -84},
+        {0xB94470938FA89BCF, -316, -76},
+        {0x8A08F0F8BF0F156B, -289, -68},
+        {0xCDB02555653131B6, -263, -60},
+        {0x993FE2C6D07B7FAC, -236, -52},
+        {0xE45C10C42A2B3B06, -210, -44},
+        {0xAA242499697392D3, -183, -36},
+        {0xFD87B5F28300CA0E, -157, -28},
+        {0xBCE5086492111AEB, -130, -20},
+        {0x8CBCCC096F5088CC, -103, -12},
+        {0xD1B71758E219652C, -77, -4},
+        {0x9C40000000000000, -50, 4},
+        {0xE8D4A51000000000, -24, 12},
+        {0xAD78EBC5AC620000, 3, 20},
+        {0x813F3978F8940984, 30, 28},
+        {0xC097CE7BC90715B3, 56, 36},
+        {0x8F7E32CE7BEA5C70, 83, 44},
+        {0xD5D238A4ABE98068, 109, 52},
+        {0x9F4F2726179A2245, 136, 60},
+        {0xED63A231D4C4FB27, 162, 68},
+        {0xB0DE65388CC8ADA8, 189, 76},
+        {0x83C7088E1AAB65DB, 216, 84},
+        {0xC45D1DF942711D9A, 242, 92},
+        {0x924D692CA61BE758, 269, 100},
+        {0xDA01EE641A708DEA, 295, 108},
+        {0xA26DA3999AEF774A, 322, 116},
+        {0xF209787BB47D6B85, 348, 124},
+        {0xB454E4A179DD1877, 375, 132},
+        {0x865B86925B9BC5C2, 402, 140},
+        {0xC83553C5C8965D3D, 428, 148},
+        {0x952AB45CFA97A0B3, 455, 156},
+        {0xDE469FBD99A05FE3, 481, 164},
+        {0xA59BC234DB398C25, 508, 172},
+        {0xF6C69A72A3989F5C, 534, 180},
+        {0xB7DCBF5354E9BECE, 561, 188},
+        {0x88FCF317F22241E2, 588, 196},
+        {0xCC20CE9BD35C78A5, 614, 204},
+        {0x98165AF37B2153DF, 641, 212},
+        {0xE2A0B5DC971F303A, 667, 220},
+        {0xA8D9D1535CE3B396, 694, 228},
+        {0xFB9B7CD9A4A7443C, 720, 236},
+        {0xBB764C4CA7A44410, 747, 244},
+        {0x8BAB8EEFB6409C1A, 774, 252},
+        {0xD01FEF10A657842C, 800, 260},
+        {0x9B10A4E5E9913129, 827, 268},
+        {0xE7109BFBA19C0C9D, 853, 276},
+        {0xAC2820D9623BF429, 880, 284},
+        {0x80444B5E7AA7CF85, 907, 292},
+        {0xBF21E44003ACDD2D, 933, 300},
+        {0x8E679C2F5E44FF8F, 960, 308},
+        {0xD433179D9C8CB841, 986, 316},
+        {0x9E19DB92B4E31BA9, 1013, 324}
+    };
+
+    FK_YAML_ASSERT(e >= -1500 && e <= 1500);
+    // k = ceil((alpha - e - 1) * log10(2))
+    const int f = alpha - e - 1;
+    const int k = (f * 78913) / (1 << 18) + static_cast<int>(f > 0);
+
+    const int index = (-cached_powers_min_dec_exp + k + (cached_powers_dec_step - 1)) / cached_powers_dec_step;
+    FK_YAML_ASSERT(index >= 0 && static_cast<std::size_t>(index) < sizeof(cached_powers) / sizeof(cached_powers[0]));
+
+    return cached_powers[index];
+}
+
+/// @brief Find the largest power of ten which is not greater than the given number.
+/// @param n A positive number.
+/// @param pow10 The largest power of ten.
+/// @return The number of decimal digits of `n`.
+inline int find_largest_pow10(uint32_t n, uint32_t& pow10) noexcept {
+    constexpr uint32_t pow10s[] = {1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u,
+                                   1000000000u};
+    int digits = 10;
+    while (digits > 1 && n < pow10s[digits - 1]) {
+        digits--;
+    }
+    pow10 = pow10s[digits - 1];
+    return digits;
+}
+
+/// @brief Move the last digit towards the value as long as the result stays within the boundaries.
+/// @param buf The buffer of generated digits.
+/// @param len The number of generated digits.
+/// @param dist The distance from the value to the upper boundary.
+/// @param delta The distance between the boundaries.
+/// @param rest The distance from the generated digits to the upper boundary.
+/// @param ten_k The unit of the last digit.
+inline void round_weed(char* buf, int len, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k) noexcept {
+    while (rest < dist && delta - rest >= ten_k && (rest + ten_k < dist || dist - rest > rest + ten_k - dist)) {
+        buf[len - 1]--;
+        rest += ten_k;
+    }
+}
+
+/// @brief Generate the shortest digits within the boundaries M- and M+ which are closest to the value w.
+/// @param buf The buffer for generated digits.
+/// @param len The number of generated digits.
+/// @param decimal_exponent The decimal exponent of the generated digits.
+/// @param m_minus The lower boundary.
+/// @param w The scaled value.
+/// @param m_plus The upper boundary.
+inline void digit_gen(
+    char* buf, int& len, int& decimal_exponent, const diyfp& m_minus, const diyfp& w, const diyfp& m_plus) noexcept {
+    FK_YAML_ASSERT(m_plus.e >= alpha && m_plus.e <= gamma);
+
+    uint64_t delta = diyfp::sub(m_plus, m_minus).f;
+    uint64_t dist = diyfp::sub(m_plus, w).f;
+
+    // split M+ = f * 2^e into the integral part p1 and the fractional part p2.
+    const diyfp one(uint64_t {1} << static_cast<uint32_t>(-m_plus.e), m_plus.e);
+    auto p1 = static_cast<uint32_t>(m_plus.f >> static_cast<uint32_t>(-one.e));
+    uint64_t p2 = m_plus.f & (one.f - 1);
+    FK_YAML_ASSERT(p1 > 0);
+
+    uint32_t pow10 = 0;
+    int n = find_largest_pow10(p1, pow10);
+
+    // generate the digits of the integral part.
+    while (n > 0) {
+        const uint32_t d = p1 / pow10;
+        p1 %= pow10;
+        buf[len++] = static_cast<char>('0' + d);
+        n--;
+
+        const uint64_t rest = (uint64_t {p1} << static_cast<uint32_t>(-one.e)) + p2;
+        if (rest <= delta) {
+            decimal_exponent += n;
+            round_weed(buf, len, dist, delta, rest, uint64_t {pow10} << static_cast<uint32_t>(-one.e));
+            return;
+        }
+        pow10 /= 10;
+    }
+
+    // generate the digits of the fractional part.
+    int m = 0;
+    for (;;) {
+        FK_YAML_ASSERT(p2 <= (std::numeric_limits<uint64_t>::max)() / 10);
+        p2 *= 10;
+        const uint64_t d = p2 >> static_cast<uint32_t>(-one.e);
+        p2 &= one.f - 1;
+        buf[len++] = static_cast<char>('0' + d);
+        m++;
+
+        delta *= 10;
+        dist *= 10;
+        if (p2 <= delta) {
+            break;
+        }
+    }
+    decimal_exponent -= m;
+    round_weed(buf, len, dist, delta, p2, one.f);
+}
+
+/// @brief Generate the decimal digits of a positive finite floating point value.
+/// @tparam FloatType The floating point number type, either float or double.
+/// @param buf The buffer for generated digits, which must have room for at least 17 characters.
+/// @param len The number of generated digits.
+/// @param decimal_exponent The decimal exponent such that value ~= digits * 10^decimal_exponent.
+/// @param value A positive finite floating point value.
+template <typename FloatType>
+inline void generate_digits(char* buf, int& len, int& decimal_exponent, FloatType value) noexcept {
+    const boundaries w = compute_boundaries(value);
+
+    const cached_power cached = get_cached_power_for_binary_exponent(w.plus.e);
+    const diyfp c_minus_k(cached.f, cached.e);
+
+    const diyfp scaled_w = diyfp::mul(w.w, c_minus_k);
+    const diyfp scaled_minus = diyfp::mul(w.minus, c_minus_k);
+    const diyfp scaled_plus = diyfp::mul(w.plus, c_minus_k);
+
+    // narrow the boundaries by 1 ulp to compensate for the errors of the cached power and the multiplications.
+    const diyfp m_minus(scaled_minus.f + 1, scaled_minus.e);
+    const diyfp m_plus(scaled_plus.f - 1, scaled_plus.e);
+
+    len = 0;
+    decimal_exponent = -cached.k;
+    digit_gen(buf, len, decimal_exponent, m_minus, scaled_w, m_plus);
+}
+
+/// @brief Write an exponent in the form of e+XX or e-XX (at least two digits).
+/// @param p The pointer to the position to write the exponent.
+/// @param e The decimal exponent.
+/// @return The pointer to the past-the-end of the written exponent.
+inline char* write_exponent(char* p, int e) noexcept {
+    *p++ = 'e';
+    if (e < 0) {
+        *p++ = '-';
+        e = -e;
+    }
+    else {
+        *p++ = '+';
+    }
+
+    if (e >= 100) {
+        *p++ = static_cast<char>('0' + e / 100);
+        e %= 100;
+    }
+    *p++ = static_cast<char>('0' + e / 10);
+    *p++ = static_cast<char>('0' + e % 10);
+    return p;
+}
+
+/// @brief Format decimal digits either in the fixed or the scientific notation, whichever is shorter, just like
+/// std::to_chars() does without any format specified.
+/// @param p The pointer to the buffer which contains the digits at its beginning.
+/// @param len The number of the digits.
+/// @param decimal_exponent The decimal exponent of the digits.
+/// @return The pointer to the past-the-end of the formatted characters.
+inline char* format_digits(char* p, int len, int decimal_exponent) noexcept {
+    // the exponent in the scientific notation, i.e., d.ddd * 10^sci_exponent
+    const int sci_exponent = decimal_exponent + len - 1;
+    const int abs_sci_exponent = sci_exponent < 0 ? -sci_exponent : sci_exponent;
+    const int sci_len = len + (len > 1 ? 1 : 0) + 2 + (abs_sci_exponent >= 100 ? 3 : 2);
+
+    // the number of digits in the integral part in the fixed notation.
+    const int int_digits = len + decimal_exponent;
+    int fixed_len = 0;
+    if (decimal_exponent >= 0) {
+        fixed_len = len + decimal_exponent;
+    }
+    else if (int_digits > 0) {
+        fixed_len = len + 1;
+    }
+    else {
+        fixed_len = 2 - int_digits + len;
+    }
+
+    if (fixed_len <= sci_len) {
+        if (decimal_exponent >= 0) {
+            // ddd000
+            std::memset(p + len, '0', static_cast<std::size_t>(decimal_exponent));
+        }
+        else if (int_digits > 0) {
+            // ddd.ddd
+            std::memmove(p + int_digits + 1, p + int_digits, static_cast<std::size_t>(len - int_digits));
+            p[int_digits] = '.';
+        }
+        else {
+            // 0.000ddd
+            const auto num_zeros = static_cast<std::size_t>(-int_digits);
+            std::memmove(p + 2 + num_zeros, p, static_cast<std::size_t>(len));
+            p[0] = '0';
+            p[1] = '.';
+            std::memset(p + 2, '0', num_zeros);
+        }
+        return p + fixed_len;
+    }
+
+    // d.ddde+XX
+    if (len > 1) {
+        std::memmove(p + 2, p + 1, static_cast<std::size_t>(len - 1));
+        p[1] = '.';
+        return write_exponent(p + len + 1, sci_exponent);
+    }
+    return write_exponent(p + 1, sci_exponent);
+}
+
+} // namespace grisu2
+
+#endif // !FK_YAML_HAS_TO_CHARS
+
+/// @brief Write the shortest decimal representation of a finite floating point value which is converted back to the
+/// same value, without depending on locales nor allocating memory.
+/// @note
+/// The notation is the same as std::to_chars() without any format specified, i.e., either the fixed or the scientific
+/// notation is chosen, whichever is shorter. The std::to_chars() function is used if available. Otherwise, the Grisu2
+/// algorithm is used, which may produce a slightly longer representation in rare cases.
+/// @tparam FloatType The floating point number type, either float or double.
+/// @param p_first The pointer to the buffer whose size is at least float_to_chars_buffer_size.
+/// @param value A finite floating point value.
+/// @return The pointer to the past-the-end of the written characters.
+template <typename FloatType>
+inline char* float_to_chars(char* p_first, FloatType value) noexcept {
+    static_assert(std::is_floating_point<FloatType>::value, "float_to_chars() accepts floating point types only.");
+    FK_YAML_ASSERT(std::isfinite(value));
+
+#if FK_YAML_HAS_TO_CHARS
+    const std::to_chars_result result = std::to_chars(p_first, p_first + float_to_chars_buffer_size, value);
+    FK_YAML_ASSERT(result.ec == std::errc {});
+    return result.ptr;
+#else
+    char* p = p_first;
+    if (std::signbit(value)) {
+        *p++ = '-';
+        value = -value;
+    }
+
+    if (value == 0) {
+        *p++ = '0';
+        return p;
+    }
+
+    int len = 0;
+    int decimal_exponent = 0;
+    grisu2::generate_digits(p, len, decimal_exponent, value);
+    return grisu2::format_digits(p, len, decimal_exponent);
+#endif
+}
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_CONVERSIONS_FLOAT_TO_CHARS_HPP */
@@ -11,6 +11,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <forward_list>
 #include <limits>
 #include <utility>
@@ -20,6 +21,7 @@
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/detail/types/node_t.hpp>
 #include <fkYAML/exception.hpp>
 
@@ -546,7 +548,34 @@ inline void from_node(const BasicNodeType& n, typename BasicNodeType::string_typ
     if FK_YAML_UNLIKELY (!n.is_string()) {
         throw type_error("The target node value type is not string type.", n.get_type());
     }
-    s = n.as_str();
+    // Read through a view since the string node value may refer to the input of deserialize_borrowed().
+    const str_view view = n.get_str_view();
+    s.assign(view.data(), view.size());
+}
+
+/// @brief Assigns the contents of a string view to a compatible string object which is constructible from a pointer
+/// and a length, e.g., std::string_view, so that it refers to the string node value instead of a temporary copy.
+/// @tparam StringType A type for string node values.
+/// @tparam CompatibleStringType A compatible string type.
+/// @param view A view into a string node value.
+/// @param s A compatible string object.
+template <
+    typename StringType, typename CompatibleStringType,
+    enable_if_t<std::is_constructible<CompatibleStringType, const char*, std::size_t>::value, int> = 0>
+inline void assign_str_view(str_view view, CompatibleStringType& s) {
+    s = CompatibleStringType(view.data(), view.size());
+}
+
+/// @brief Assigns the contents of a string view to a compatible string object through a string node value type.
+/// @tparam StringType A type for string node values.
+/// @tparam CompatibleStringType A compatible string type.
+/// @param view A view into a string node value.
+/// @param s A compatible string object.
+template <
+    typename StringType, typename CompatibleStringType,
+    enable_if_t<!std::is_constructible<CompatibleStringType, const char*, std::size_t>::value, int> = 0>
+inline void assign_str_view(str_view view, CompatibleStringType& s) {
+    s = StringType(view.data(), view.size());
 }
 
 /// @brief from_node function for compatible string type.
@@ -568,7 +597,7 @@ inline void from_node(const BasicNodeType& n, CompatibleStringType& s) {
     if FK_YAML_UNLIKELY (!n.is_string()) {
         throw type_error("The target node value type is not string type.", n.get_type());
     }
-    s = n.as_str();
+    assign_str_view<typename BasicNodeType::string_type>(n.get_str_view(), s);
 }
 
 /// @brief from_node function for std::pair objects whose element types must be either a basic_node template instance
@@ -26,8 +26,8 @@
 // Prefer std::to_chars() and std::from_chars() functions if available.
 #include <charconv>
 #else
-// Fallback to legacy string conversion functions otherwise.
-#include <string> // std::stof(), std::stod(), std::stold()
+// Fallback to the bundled allocation-free conversion otherwise.
+#include <fkYAML/detail/conversions/chars_to_float.hpp>
 #endif
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
@@ -737,28 +737,16 @@ inline bool atof_impl(const char* p_begin, const char* p_end, FloatType& f) noex
 
 #else
 
-/// @brief Converts a scalar into a `float` value.
-/// @warning `p_begin` and `p_end` must not be null. Validate them before calling this function.
-/// @param p_begin The pointer to the first element of the scalar.
-/// @param p_end The pointer to the past-the-end element of the scalar.
-/// @param f The output `float` value holder.
-/// @return true if the conversion completes successfully, false otherwise.
-inline bool atof_impl(const char* p_begin, const char* p_end, float& f) {
-    std::size_t idx = 0;
-    f = std::stof(std::string(p_begin, p_end), &idx);
-    return idx == static_cast<std::size_t>(p_end - p_begin);
-}
-
-/// @brief Converts a scalar into a `double` value.
+/// @brief Converts a scalar into a floating point value.
 /// @warning `p_begin` and `p_end` must not be null. Validate them before calling this function.
 /// @param p_begin The pointer to the first element of the scalar.
 /// @param p_end The pointer to the past-the-end element of the scalar.
-/// @param f The output `double` value holder.
+/// @param f The output floating point value holder.
 /// @return true if the conversion completes successfully, false otherwise.
-inline bool atof_impl(const char* p_begin, const char* p_end, double& f) {
-    std::size_t idx = 0;
-    f = std::stod(std::string(p_begin, p_end), &idx);
-    return idx == static_cast<std::size_t>(p_end - p_begin);
+template <typename FloatType>
+inline bool atof_impl(const char* p_begin, const char* p_end, FloatType& f) noexcept {
+    static_assert(std::is_floating_point<FloatType>::value, "atof_impl() accepts floating point types as an output type");
+    return chars_to_float(p_begin, p_end, f);
 }
 
 #endif // FK_YAML_HAS_TO_CHARS
@@ -771,7 +759,7 @@ inline bool atof_impl(const char* p_begin, const char* p_end, double& f) {
 /// @param f The output floating point value holder.
 /// @return true if the conversion completes successfully, false otherwise.
 template <typename CharItr, typename FloatType>
-inline bool atof(CharItr begin, CharItr end, FloatType& f) noexcept(noexcept(atof_impl(&*begin, &*begin, f))) {
+inline bool atof(CharItr begin, CharItr end, FloatType& f) noexcept {
     static_assert(is_iterator_of<CharItr, char>::value, "atof() accepts iterators for char type");
     static_assert(std::is_floating_point<FloatType>::value, "atof() accepts floating point types as an output type");
 
@@ -816,19 +804,7 @@ inline bool atof(CharItr begin, CharItr end, FloatType& f) noexcept(noexcept(ato
         }
     }
 
-#if FK_YAML_HAS_TO_CHARS
     return atof_impl(p_begin, p_end, f);
-#else
-    bool success = false;
-    try {
-        success = atof_impl(p_begin, p_end, f);
-    }
-    catch (const std::exception& /*unused*/) {
-        success = false;
-    }
-
-    return success;
-#endif
 }
 
 FK_YAML_DETAIL_NAMESPACE_END
@@ -88,12 +88,23 @@ struct external_node_constructor {
         n.m_value.p_str = create_object<typename BasicNodeType::string_type>(std::forward<Args>(args)...);
     }
 
+    /// @brief Make a string node which refers to a range of the input buffer without copying it.
+    /// @note The input buffer must outlive the node and all of its copies.
+    static void borrowed_string_scalar(BasicNodeType& n, const char* p_str, uint32_t len) {
+        destroy(n);
+        n.m_attrs |= node_attr_bits::string_bit;
+        n.m_attrs |= node_attr_bits::borrowed_str_bit;
+        n.m_value.p_borrowed_str = p_str;
+        n.m_borrowed_str_len = len;
+    }
+
 private:
     static void destroy(BasicNodeType& n) {
-        n.m_value.destroy(n.m_attrs & node_attr_mask::value);
-        // Clear both the value-type bits and the uint_bit style flag so that any
+        n.m_value.destroy(n.m_attrs);
+        // Clear the value-type bits and the style flags for values so that any
         // subsequent reassignment starts from a clean state.
-        n.m_attrs &= ~(node_attr_mask::value | node_attr_bits::uint_bit);
+        n.m_attrs &= ~(node_attr_mask::value | node_attr_bits::uint_bit | node_attr_bits::borrowed_str_bit |
+                       node_attr_bits::shared_bit);
     }
 };
 
@@ -12,10 +12,10 @@
 #include <cmath>
 #include <limits>
 #include <string>
-#include <sstream>
 #include <type_traits>
 
 #include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/conversions/float_to_chars.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
 
@@ -75,9 +75,10 @@ inline enable_if_t<std::is_floating_point<FloatType>::value> to_string(FloatType
         return;
     }
 
-    std::ostringstream oss;
-    oss << v;
-    s = oss.str();
+    // The shortest representation which is converted back to `v` is written without depending on locales.
+    char buf[float_to_chars_buffer_size];
+    const char* p_end = float_to_chars(&buf[0], v);
+    s.assign(&buf[0], static_cast<std::size_t>(p_end - &buf[0]));
 
     // If `v` is actually an integer and no scientific notation is used for serialization, ".0" must be appended.
     // The result would cause a roundtrip issue otherwise. https://github.com/fktn-k/fkYAML/issues/405
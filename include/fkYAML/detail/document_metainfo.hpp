@@ -9,8 +9,11 @@
 #ifndef FK_YAML_DETAIL_DOCUMENT_METAINFO_HPP
 #define FK_YAML_DETAIL_DOCUMENT_METAINFO_HPP
 
-#include <string>
+#include <atomic>
+#include <cstddef>
 #include <map>
+#include <string>
+#include <utility>
 
 #include <fkYAML/detail/macros/define_macros.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
@@ -18,6 +21,92 @@
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
+/// @brief An entry of anchor tables, which holds an anchored node and caches the result of its cyclic reference check.
+/// @note
+/// A cyclic reference can be introduced only by placing an anchor/alias node, or a container node holding one, into
+/// the anchored node. Such a change increments the structure version of the document which the changed node belongs
+/// to, or the version shared by nodes belonging to no document if it has none. A cached check result is valid only
+/// while both versions stay the same as when the check was performed, so changes in other documents never invalidate
+/// it.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+struct anchor_table_entry {
+    /// @brief Constructs a new anchor_table_entry object with an anchored node.
+    /// @param n An anchored node.
+    /// @param doc_version The structure version of the document which owns the anchor table.
+    anchor_table_entry(BasicNodeType&& n, const std::atomic<std::size_t>& doc_version) noexcept
+        : node(std::move(n)),
+          p_doc_version(&doc_version) {
+    }
+
+    /// @brief Increments the structure version shared by nodes belonging to no document.
+    static void notify_detached_structure_change() noexcept {
+        detached_structure_version().fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Get the current structure version for the anchored node.
+    /// @note Both versions only increase, so their sum changes whenever either of them changes.
+    /// @return The current structure version for the anchored node.
+    std::size_t current_structure_version() const noexcept {
+        return p_doc_version->load(std::memory_order_relaxed) +
+               detached_structure_version().load(std::memory_order_relaxed);
+    }
+
+    /// @brief Checks if the anchored node has been verified to contain no cyclic references.
+    /// @return true if the cached check result is still valid, false otherwise.
+    bool is_verified() const noexcept {
+        return verified_version.load(std::memory_order_relaxed) == current_structure_version();
+    }
+
+    /// @brief Caches the result of a successful cyclic reference check.
+    /// @param version The structure version obtained before the check is performed.
+    void mark_verified(std::size_t version) const noexcept {
+        verified_version.store(version, std::memory_order_relaxed);
+    }
+
+    /// @brief Registers an anchor/alias node which refers to this entry.
+    void add_ref() const noexcept {
+        ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Unregisters an anchor/alias node which refers to this entry.
+    /// @return true if no anchor/alias node refers to this entry any longer, false otherwise.
+    bool remove_ref() const noexcept {
+        return ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    /// @brief Checks if any anchor/alias node refers to this entry.
+    /// @return true if some anchor/alias node refers to this entry, false otherwise.
+    bool is_referenced() const noexcept {
+        return ref_count.load(std::memory_order_acquire) > 0;
+    }
+
+    /// @brief Marks this entry as released by its anchor node, which makes resolving the remaining aliases fail.
+    void release() noexcept {
+        is_released = true;
+        verified_version.store(0, std::memory_order_relaxed);
+    }
+
+    /// The anchored node.
+    BasicNodeType node;
+    /// The structure version of the document which owns the anchor table.
+    const std::atomic<std::size_t>* p_doc_version;
+    /// The structure version when the anchored node has been verified to contain no cyclic references.
+    mutable std::atomic<std::size_t> verified_version {0};
+    /// The number of anchor/alias nodes which refer to this entry.
+    mutable std::atomic<std::size_t> ref_count {0};
+    /// Whether the anchor node has been given another anchor name after the entry was created.
+    bool is_released {false};
+
+private:
+    /// @brief Get the structure version shared by nodes belonging to no document.
+    /// @return Reference to the structure version for nodes belonging to no document.
+    static std::atomic<std::size_t>& detached_structure_version() noexcept {
+        static std::atomic<std::size_t> version {0};
+        return version;
+    }
+};
+
 /// @brief The set of directives for a YAML document.
 template <typename BasicNodeType, typename = enable_if_t<is_basic_node<BasicNodeType>::value>>
 struct document_metainfo {
@@ -32,7 +121,17 @@ struct document_metainfo {
     /// The map of handle-prefix pairs.
     std::map<std::string /*handle*/, std::string /*prefix*/> named_handle_map;
     /// The map of anchor node which allows for key duplication.
-    std::multimap<std::string /*anchor name*/, BasicNodeType> anchor_table {};
+    std::multimap<std::string /*anchor name*/, anchor_table_entry<BasicNodeType>> anchor_table {};
+    /// The number of anchor table entries released while aliases still refer to them.
+    std::size_t num_released_anchors {0};
+    /// The structure version of this document, which starts with 1 so that no anchor table entry is verified
+    /// initially.
+    std::atomic<std::size_t> structure_version {1};
+
+    /// @brief Increments the structure version of this document.
+    void notify_structure_change() noexcept {
+        structure_version.fetch_add(1, std::memory_order_relaxed);
+    }
 };
 
 FK_YAML_DETAIL_NAMESPACE_END
@@ -0,0 +1,186 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_ENCODINGS_UTF8_VALIDATOR_HPP
+#define FK_YAML_DETAIL_ENCODINGS_UTF8_VALIDATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/encodings/utf_encodings.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/exception.hpp>
+
+#if FK_YAML_HAS_AVX2
+#include <immintrin.h>
+#elif FK_YAML_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief Reads the next byte of a multi-byte UTF-8 character.
+/// @tparam IterType An iterator type.
+/// @param current The iterator to the next byte. Will be advanced by one on success.
+/// @param end The end of the input.
+/// @param bytes_read The bytes of the current character which have been read so far. Used for error messages.
+/// @return The next byte.
+template <typename IterType>
+uint8_t read_utf8_byte_or_throw(IterType& current, IterType end, std::initializer_list<uint8_t> bytes_read) {
+    if FK_YAML_UNLIKELY (current == end) {
+        throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", bytes_read);
+    }
+
+    const auto byte = static_cast<uint8_t>(*current);
+    ++current;
+    return byte;
+}
+
+namespace utf8 {
+
+/// @brief Validates a UTF-8 character and advances the iterator past it.
+/// @tparam IterType An iterator type.
+/// @param current The iterator to the first byte of a UTF-8 character.
+/// @param end The end of the input.
+template <typename IterType>
+inline void validate_char(IterType& current, IterType end) {
+    const auto first = static_cast<uint8_t>(*current);
+    ++current;
+    const uint32_t num_bytes = get_num_bytes(first);
+
+    switch (num_bytes) {
+    case 1:
+        break;
+    case 2: {
+        const auto second = read_utf8_byte_or_throw(current, end, {first});
+        const bool is_valid = validate(first, second);
+        if FK_YAML_UNLIKELY (!is_valid) {
+            throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second});
+        }
+        break;
+    }
+    case 3: {
+        const auto second = read_utf8_byte_or_throw(current, end, {first});
+        const auto third = read_utf8_byte_or_throw(current, end, {first, second});
+        const bool is_valid = validate(first, second, third);
+        if FK_YAML_UNLIKELY (!is_valid) {
+            throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third});
+        }
+        break;
+    }
+    case 4: {
+        const auto second = read_utf8_byte_or_throw(current, end, {first});
+        const auto third = read_utf8_byte_or_throw(current, end, {first, second});
+        const auto fourth = read_utf8_byte_or_throw(current, end, {first, second, third});
+        const bool is_valid = validate(first, second, third, fourth);
+        if FK_YAML_UNLIKELY (!is_valid) {
+            throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third, fourth});
+        }
+        break;
+    }
+    default:           // LCOV_EXCL_LINE
+        unreachable(); // LCOV_EXCL_LINE
+    }
+}
+
+/// @brief Counts set bits in the given bit mask.
+/// @param bits A bit mask.
+/// @return The number of set bits.
+inline uint32_t count_set_bits(uint32_t bits) noexcept {
+    uint32_t count = 0;
+    while (bits != 0) {
+        bits &= bits - 1;
+        ++count;
+    }
+    return count;
+}
+
+/// @brief Skips ASCII characters in the given range while counting CRs (0x0D) in them.
+/// @note Checks 32 (AVX2), 16 (SSE2) or 8 (otherwise) bytes at once until a block contains a non-ASCII byte.
+/// @param current The beginning of the range.
+/// @param end The end of the range.
+/// @param num_crs The number of CRs. Will be increased by the number of skipped CRs.
+/// @return The pointer to the first non-ASCII byte, or `end` if the rest of the range is ASCII.
+inline const char* skip_ascii(const char* current, const char* end, std::size_t& num_crs) noexcept {
+#if FK_YAML_HAS_AVX2
+    const __m256i crs_32 = _mm256_set1_epi8(0x0D);
+    while (end - current >= 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current));
+        // the most significant bits are set only in non-ASCII bytes.
+        if (_mm256_movemask_epi8(block) != 0) {
+            break;
+        }
+        const auto cr_bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, crs_32)));
+        num_crs += count_set_bits(cr_bits);
+        current += 32;
+    }
+#endif
+
+#if FK_YAML_HAS_SSE2
+    const __m128i crs_16 = _mm_set1_epi8(0x0D);
+    while (end - current >= 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        if (_mm_movemask_epi8(block) != 0) {
+            break;
+        }
+        const auto cr_bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, crs_16)));
+        num_crs += count_set_bits(cr_bits);
+        current += 16;
+    }
+#endif
+
+    // portable fallback which checks 8 bytes at once with 64-bit integer operations.
+    constexpr uint64_t msb_mask = 0x8080808080808080u;
+    constexpr uint64_t lsb_mask = 0x0101010101010101u;
+    constexpr uint64_t crs_8 = 0x0D0D0D0D0D0D0D0Du;
+    while (end - current >= 8) {
+        uint64_t block = 0;
+        std::memcpy(&block, current, sizeof(block));
+        if ((block & msb_mask) != 0) {
+            break;
+        }
+        // a byte in `xored` is zero only if the corresponding byte is a CR.
+        const uint64_t xored = block ^ crs_8;
+        if FK_YAML_UNLIKELY (((xored - lsb_mask) & ~xored & msb_mask) != 0) {
+            for (int i = 0; i < 8; i++) {
+                num_crs += (current[i] == '\r') ? 1 : 0;
+            }
+        }
+        current += 8;
+    }
+
+    while (current != end && static_cast<uint8_t>(*current) < 0x80u) {
+        num_crs += (*current == '\r') ? 1 : 0;
+        ++current;
+    }
+
+    return current;
+}
+
+/// @brief Validates UTF-8 encoded bytes and counts CRs (0x0D) in them in a single scan.
+/// @note Throws an invalid_encoding exception at the first invalid UTF-8 character.
+/// @param begin The beginning of the bytes.
+/// @param end The end of the bytes.
+/// @return The number of CRs in the bytes.
+inline std::size_t validate_and_count_crs(const char* begin, const char* end) {
+    std::size_t num_crs = 0;
+    const char* current = begin;
+    while ((current = skip_ascii(current, end, num_crs)) != end) {
+        validate_char(current, end);
+    }
+    return num_crs;
+}
+
+} // namespace utf8
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_ENCODINGS_UTF8_VALIDATOR_HPP */
@@ -112,151 +112,166 @@ public:
     static ::std::string escape(const char* begin, const char* end, bool& is_escaped) {
         ::std::string escaped {};
         escaped.reserve(std::distance(begin, end));
+        if (escape(begin, end, escaped)) {
+            is_escaped = true;
+        }
+        return escaped;
+    } // LCOV_EXCL_LINE
+
+    /// @brief Escapes characters in the given range and appends the result to the output.
+    /// @tparam OutputType The type of the output, which accepts string literals and characters with operator+=.
+    /// @param begin The beginning of the characters to be escaped.
+    /// @param end The end of the characters to be escaped.
+    /// @param out The output to which the escaped characters are appended.
+    /// @return true if any character has been escaped, false otherwise.
+    template <typename OutputType>
+    static bool escape(const char* begin, const char* end, OutputType& out) {
+        bool is_escaped = false;
         for (; begin != end; ++begin) {
             switch (*begin) {
             case 0x01:
-                escaped += "\\u0001";
+                out += "\\u0001";
                 is_escaped = true;
                 break;
             case 0x02:
-                escaped += "\\u0002";
+                out += "\\u0002";
                 is_escaped = true;
                 break;
             case 0x03:
-                escaped += "\\u0003";
+                out += "\\u0003";
                 is_escaped = true;
                 break;
             case 0x04:
-                escaped += "\\u0004";
+                out += "\\u0004";
                 is_escaped = true;
                 break;
             case 0x05:
-                escaped += "\\u0005";
+                out += "\\u0005";
                 is_escaped = true;
                 break;
             case 0x06:
-                escaped += "\\u0006";
+                out += "\\u0006";
                 is_escaped = true;
                 break;
             case '\a':
-                escaped += "\\a";
+                out += "\\a";
                 is_escaped = true;
                 break;
             case '\b':
-                escaped += "\\b";
+                out += "\\b";
                 is_escaped = true;
                 break;
             case '\t':
-                escaped += "\\t";
+                out += "\\t";
                 is_escaped = true;
                 break;
             case '\n':
-                escaped += "\\n";
+                out += "\\n";
                 is_escaped = true;
                 break;
             case '\v':
-                escaped += "\\v";
+                out += "\\v";
                 is_escaped = true;
                 break;
             case '\f':
-                escaped += "\\f";
+                out += "\\f";
                 is_escaped = true;
                 break;
             case '\r':
-                escaped += "\\r";
+                out += "\\r";
                 is_escaped = true;
                 break;
             case 0x0E:
-                escaped += "\\u000E";
+                out += "\\u000E";
                 is_escaped = true;
                 break;
             case 0x0F:
-                escaped += "\\u000F";
+                out += "\\u000F";
                 is_escaped = true;
                 break;
             case 0x10:
-                escaped += "\\u0010";
+                out += "\\u0010";
                 is_escaped = true;
                 break;
             case 0x11:
-                escaped += "\\u0011";
+                out += "\\u0011";
                 is_escaped = true;
                 break;
             case 0x12:
-                escaped += "\\u0012";
+                out += "\\u0012";
                 is_escaped = true;
                 break;
             case 0x13:
-                escaped += "\\u0013";
+                out += "\\u0013";
                 is_escaped = true;
                 break;
             case 0x14:
-                escaped += "\\u0014";
+                out += "\\u0014";
                 is_escaped = true;
                 break;
             case 0x15:
-                escaped += "\\u0015";
+                out += "\\u0015";
                 is_escaped = true;
                 break;
             case 0x16:
-                escaped += "\\u0016";
+                out += "\\u0016";
                 is_escaped = true;
                 break;
             case 0x17:
-                escaped += "\\u0017";
+                out += "\\u0017";
                 is_escaped = true;
                 break;
             case 0x18:
-                escaped += "\\u0018";
+                out += "\\u0018";
                 is_escaped = true;
                 break;
             case 0x19:
-                escaped += "\\u0019";
+                out += "\\u0019";
                 is_escaped = true;
                 break;
             case 0x1A:
-                escaped += "\\u001A";
+                out += "\\u001A";
                 is_escaped = true;
                 break;
             case 0x1B:
-                escaped += "\\e";
+                out += "\\e";
                 is_escaped = true;
                 break;
             case 0x1C:
-                escaped += "\\u001C";
+                out += "\\u001C";
                 is_escaped = true;
                 break;
             case 0x1D:
-                escaped += "\\u001D";
+                out += "\\u001D";
                 is_escaped = true;
                 break;
             case 0x1E:
-                escaped += "\\u001E";
+                out += "\\u001E";
                 is_escaped = true;
                 break;
             case 0x1F:
-                escaped += "\\u001F";
+                out += "\\u001F";
                 is_escaped = true;
                 break;
             case '\"':
-                escaped += "\\\"";
+                out += "\\\"";
                 is_escaped = true;
                 break;
             case '\\':
-                escaped += "\\\\";
+                out += "\\\\";
                 is_escaped = true;
                 break;
             default:
                 const std::ptrdiff_t diff = static_cast<int>(std::distance(begin, end));
                 if (diff > 1) {
                     if (*begin == static_cast<char>(0xC2u) && *(begin + 1) == static_cast<char>(0x85u)) {
-                        escaped += "\\N";
+                        out += "\\N";
                         std::advance(begin, 1);
                         is_escaped = true;
                         break;
                     }
                     if (*begin == static_cast<char>(0xC2u) && *(begin + 1) == static_cast<char>(0xA0u)) {
-                        escaped += "\\_";
+                        out += "\\_";
                         std::advance(begin, 1);
                         is_escaped = true;
                         break;
@@ -265,26 +280,26 @@ public:
                     if (diff > 2) {
                         if (*begin == static_cast<char>(0xE2u) && *(begin + 1) == static_cast<char>(0x80u) &&
                             *(begin + 2) == static_cast<char>(0xA8u)) {
-                            escaped += "\\L";
+                            out += "\\L";
                             std::advance(begin, 2);
                             is_escaped = true;
                             break;
                         }
                         if (*begin == static_cast<char>(0xE2u) && *(begin + 1) == static_cast<char>(0x80u) &&
                             *(begin + 2) == static_cast<char>(0xA9u)) {
-                            escaped += "\\P";
+                            out += "\\P";
                             std::advance(begin, 2);
                             is_escaped = true;
                             break;
                         }
                     }
                 }
-                escaped += *begin;
+                out += *begin;
                 break;
             }
         }
-        return escaped;
-    } // LCOV_EXCL_LINE
+        return is_escaped;
+    }
 
 private:
     static bool convert_hexchar_to_byte(char source, uint8_t& byte) {
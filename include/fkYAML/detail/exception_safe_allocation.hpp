@@ -14,20 +14,60 @@
 
 #include <fkYAML/detail/macros/define_macros.hpp>
 #include <fkYAML/detail/assert.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
+/// @brief Provides the allocator type used to allocate `ObjT` objects on the heap.
+/// @note Objects which are not allocator-aware are allocated with std::allocator.
+/// @tparam ObjT Object type.
+template <typename ObjT, typename = void>
+struct object_allocator {
+    /// The allocator type for `ObjT` objects.
+    using type = std::allocator<ObjT>;
+
+    /// @brief Get the allocator which has been used to allocate the given object.
+    /// @return The allocator for the object.
+    static type get(const ObjT& /*unused*/) noexcept {
+        return type {};
+    }
+};
+
+/// @brief A partial specialization of object_allocator for allocator-aware types such as containers and strings.
+/// @note Such objects are allocated with their own allocators so that the objects and their contents are placed in
+/// the same memory resource.
+/// @tparam ObjT Object type.
+template <typename ObjT>
+struct object_allocator<ObjT, void_t<typename ObjT::allocator_type>> {
+    /// The allocator type for `ObjT` objects.
+    using type = typename std::allocator_traits<typename ObjT::allocator_type>::template rebind_alloc<ObjT>;
+
+    /// @brief Get the allocator which has been used to allocate the given object.
+    /// @param obj An object allocated by create_object().
+    /// @return The allocator for the object.
+    static type get(const ObjT& obj) noexcept {
+        return type(obj.get_allocator());
+    }
+};
+
 /// @brief Helper struct which ensures destruction/deallocation of heap-allocated objects.
 /// @tparam ObjT Object type.
 /// @tparam AllocTraits Allocator traits type for the object.
 template <typename ObjT, typename AllocTraits>
 struct tidy_guard {
+    /// The allocator type for the object.
+    using allocator_type = typename AllocTraits::allocator_type;
+
     tidy_guard() = delete;
 
     /// @brief Construct a tidy_guard with a pointer to the object.
-    /// @param p_obj
-    tidy_guard(ObjT* p_obj) noexcept
-        : p_obj(p_obj) {
+    /// @param alloc The allocator which has been used to allocate the object.
+    /// @param p_obj A pointer to the allocated object.
+    /// @param is_constructed Whether the object has already been constructed.
+    tidy_guard(const allocator_type& alloc, ObjT* p_obj, bool is_constructed = false) noexcept
+        : alloc(alloc),
+          p_obj(p_obj),
+          is_constructed(is_constructed) {
     }
 
     // move-only
@@ -44,8 +84,9 @@ struct tidy_guard {
     /// @brief Destroys this tidy_guard object. Destruction/deallocation happen if the pointer is not null.
     ~tidy_guard() {
         if FK_YAML_UNLIKELY (p_obj != nullptr) {
-            typename AllocTraits::allocator_type alloc {};
-            AllocTraits::destroy(alloc, p_obj);
+            if (is_constructed) {
+                AllocTraits::destroy(alloc, p_obj);
+            }
             AllocTraits::deallocate(alloc, p_obj, 1);
             p_obj = nullptr;
         }
@@ -70,25 +111,42 @@ struct tidy_guard {
         return ret;
     }
 
+    /// @brief The allocator used to allocate the object.
+    allocator_type alloc;
     /// @brief The pointer to the object.
     ObjT* p_obj {nullptr};
+    /// @brief Whether the object has been constructed.
+    bool is_constructed {false};
 };
 
 /// @brief Allocates and constructs an `ObjT` object with given arguments.
+/// @note An allocator-aware object is placed in memory given by its own allocator.
 /// @tparam ObjT The object type.
 /// @tparam ...Args The argument types.
 /// @param ...args The arguments for construction.
 /// @return An address of allocated memory on the heap.
 template <typename ObjT, typename... Args>
 inline ObjT* create_object(Args&&... args) {
-    using alloc_type = std::allocator<ObjT>;
+    using alloc_type = typename object_allocator<ObjT>::type;
     using alloc_traits_type = std::allocator_traits<alloc_type>;
 
     alloc_type alloc {};
-    tidy_guard<ObjT, alloc_traits_type> tg {alloc_traits_type::allocate(alloc, 1)};
+    tidy_guard<ObjT, alloc_traits_type> tg {alloc, alloc_traits_type::allocate(alloc, 1)};
     alloc_traits_type::construct(alloc, tg.get(), std::forward<Args>(args)...);
+    tg.is_constructed = true;
 
     FK_YAML_ASSERT(tg);
+
+    // An object moved from another one may have a different allocator. (e.g., a container in another arena)
+    // Relocate it into memory from its own allocator so that destroy_object() can deallocate it correctly.
+    alloc_type obj_alloc = object_allocator<ObjT>::get(*tg.get());
+    if FK_YAML_UNLIKELY (obj_alloc != alloc) {
+        tidy_guard<ObjT, alloc_traits_type> relocated {obj_alloc, alloc_traits_type::allocate(obj_alloc, 1)};
+        alloc_traits_type::construct(obj_alloc, relocated.get(), std::move(*tg.get()));
+        relocated.is_constructed = true;
+        return relocated.release();
+    }
+
     return tg.release();
 }
 
@@ -98,9 +156,11 @@ inline ObjT* create_object(Args&&... args) {
 template <typename ObjT>
 inline void destroy_object(ObjT* p_obj) {
     FK_YAML_ASSERT(p_obj != nullptr);
-    std::allocator<ObjT> alloc;
-    std::allocator_traits<decltype(alloc)>::destroy(alloc, p_obj);
-    std::allocator_traits<decltype(alloc)>::deallocate(alloc, p_obj, 1);
+    using alloc_traits_type = std::allocator_traits<typename object_allocator<ObjT>::type>;
+
+    typename object_allocator<ObjT>::type alloc = object_allocator<ObjT>::get(*p_obj);
+    alloc_traits_type::destroy(alloc, p_obj);
+    alloc_traits_type::deallocate(alloc, p_obj, 1);
 }
 
 FK_YAML_DETAIL_NAMESPACE_END
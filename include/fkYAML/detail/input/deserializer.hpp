@@ -12,6 +12,8 @@
 #include <algorithm>
 #include <deque>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fkYAML/detail/macros/define_macros.hpp>
@@ -25,6 +27,7 @@
 #include <fkYAML/detail/node_attrs.hpp>
 #include <fkYAML/detail/node_property.hpp>
 #include <fkYAML/detail/types/lexical_token_t.hpp>
+#include <fkYAML/deserialization_limits.hpp>
 #include <fkYAML/exception.hpp>
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
@@ -49,6 +52,8 @@ class basic_deserializer {
     using sequence_type = typename basic_node_type::sequence_type;
     /** A type for mapping node value containers. */
     using mapping_type = typename basic_node_type::mapping_type;
+    /** A type for entries of anchor tables. */
+    using anchor_entry_type = anchor_table_entry<basic_node_type>;
 
     /// @brief Definition of state types of parse contexts.
     enum class context_state_t : std::uint8_t {
@@ -129,6 +134,21 @@ public:
     basic_deserializer() = default;
 
 public:
+    /// @brief Set whether string scalars which need no transformation refer to the input buffer.
+    /// @note
+    /// Strings are borrowed only if the input adapter lexes the input in place. The input must then outlive the
+    /// resulting nodes and all of their copies.
+    /// @param borrows_input true to let string scalars refer to the input buffer, false otherwise.
+    void set_borrows_input(bool borrows_input) noexcept {
+        m_borrows_input = borrows_input;
+    }
+
+    /// @brief Set the limits checked for each document while deserializing inputs.
+    /// @param limits The limits on the structure of each document.
+    void set_limits(const deserialization_limits& limits) noexcept {
+        m_limits = limits;
+    }
+
     /// @brief Deserialize a single YAML document into a YAML node.
     /// @note
     /// If the input consists of multiple YAML documents, this function only parses the first.
@@ -140,10 +160,11 @@ public:
     template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
     basic_node_type deserialize(InputAdapterType&& input_adapter) { // NOLINT(cppcoreguidelines-missing-std-forward)
         const str_view input_view = input_adapter.get_buffer_view();
-        lexer_type lexer(input_view);
+        m_borrows_strings = m_borrows_input && views_input(input_adapter);
+        prepare(input_view);
 
         lexical_token_t type {lexical_token_t::END_OF_BUFFER};
-        return deserialize_document(lexer, type);
+        return deserialize_document(m_lexer, type);
     }
 
     /// @brief Deserialize multiple YAML documents into YAML nodes.
@@ -154,13 +175,14 @@ public:
     // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
     std::vector<basic_node_type> deserialize_docs(InputAdapterType&& input_adapter) {
         const str_view input_view = input_adapter.get_buffer_view();
-        lexer_type lexer(input_view);
+        m_borrows_strings = m_borrows_input && views_input(input_adapter);
+        prepare(input_view);
 
         std::vector<basic_node_type> nodes {};
         lexical_token_t type {lexical_token_t::END_OF_BUFFER};
 
         do {
-            nodes.emplace_back(deserialize_document(lexer, type));
+            nodes.emplace_back(deserialize_document(m_lexer, type));
             // Break the loop if the last end-of-document marker is followed by the end-of-buffer token,
             // which indicates that there are no more documents to parse.
             // ```yaml
@@ -171,8 +193,8 @@ public:
             if (type == lexical_token_t::END_OF_DOCUMENT) {
                 // A next document may start from the directive part. Ensure '%' is lexed as a directive token
                 // during the lookahead; otherwise it can be cached as a plain scalar and break parsing.
-                lexer.set_document_state(true);
-                if (lexer.peek_next_token().type == lexical_token_t::END_OF_BUFFER) {
+                m_lexer.set_document_state(true);
+                if (m_lexer.peek_next_token().type == lexical_token_t::END_OF_BUFFER) {
                     break;
                 }
             }
@@ -182,6 +204,42 @@ public:
     } // LCOV_EXCL_LINE
 
 private:
+    /// @brief Prepare for deserializing a new input.
+    /// @note
+    /// The states are reset here rather than relying on the end of the last deserialization, which may have been
+    /// interrupted by an exception. The storage for the parse context stack and the buffers in the lexer and the
+    /// scalar parser are kept so that deserializing multiple inputs with the same object saves allocations.
+    /// @param input_view View into the input buffer.
+    void prepare(str_view input_view) {
+        m_lexer.reset(input_view);
+        m_scalar_parser.set_borrows_input(m_borrows_strings);
+        m_context_stack.clear();
+        m_flow_context_depth = 0;
+        m_flow_token_state = flow_token_state_t::NEEDS_VALUE_OR_SUFFIX;
+        m_needs_anchor_impl = false;
+        m_needs_tag_impl = false;
+        m_anchor_name = m_tag_name = m_root_anchor_name = m_root_tag_name = {};
+    }
+
+private:
+    /// @brief Check if the buffer view of the input adapter refers to the input itself.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @param input_adapter An input adapter object.
+    /// @return true if the buffer view refers to the input itself, false otherwise.
+    template <typename InputAdapterType, enable_if_t<has_views_input<InputAdapterType>::value, int> = 0>
+    static bool views_input(const InputAdapterType& input_adapter) noexcept {
+        return input_adapter.views_input();
+    }
+
+    /// @brief Check if the buffer view of the input adapter refers to the input itself.
+    /// @note Input adapters without views_input() are assumed to own their buffers.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @return false always.
+    template <typename InputAdapterType, enable_if_t<!has_views_input<InputAdapterType>::value, int> = 0>
+    static bool views_input(const InputAdapterType& /*unused*/) noexcept {
+        return false;
+    }
+
     /// @brief Deserialize a YAML document into a YAML node.
     /// @param lexer The lexical analyzer to be used.
     /// @param last_type The variable to store the last lexical token type.
@@ -191,7 +249,14 @@ private:
 
         basic_node_type root;
         mp_current_node = &root;
-        mp_meta = root.mp_meta;
+
+        // All the nodes in a document share a single metainfo object.
+        mp_meta = std::make_shared<doc_metainfo_type>();
+        m_alias_count = m_alias_expansion = 0;
+        m_expanded_sizes.clear();
+        m_doc_prop.reset();
+        m_doc_prop.set_meta(mp_meta);
+        apply_directive_set(root);
 
         // parse directives first.
         deserialize_directives(lexer, token);
@@ -326,11 +391,18 @@ private:
             m_context_stack.pop_back();
         }
 
+        if (m_limits.max_expanded_nodes > 0) {
+            check_expanded_nodes(count_expanded_nodes(root, nullptr), lexer);
+        }
+
         // reset parameters for the next call.
         mp_current_node = nullptr;
         mp_meta.reset();
+        m_doc_prop.reset();
         m_needs_tag_impl = false;
         m_needs_anchor_impl = false;
+        // node properties for a root block collection must not be left for the next document.
+        m_root_anchor_name = m_root_tag_name = {};
         m_flow_context_depth = 0;
         m_flow_token_state = flow_token_state_t::NEEDS_VALUE_OR_SUFFIX;
         m_context_stack.clear();
@@ -441,6 +513,12 @@ private:
         uint32_t indent = first_indent;
 
         do {
+            // Every collection has its own context, so the nesting depth can exceed the limit only if so does the
+            // size of the context stack.
+            if (m_limits.max_depth > 0 && m_context_stack.size() > m_limits.max_depth) {
+                check_nesting_depth(0, line, indent);
+            }
+
             switch (token.type) {
             case lexical_token_t::EXPLICIT_KEY_PREFIX: {
                 if FK_YAML_UNLIKELY (m_context_stack.empty()) {
@@ -921,6 +999,11 @@ private:
                     m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING, mp_current_node);
                     m_flow_token_state = flow_token_state_t::NEEDS_VALUE_OR_SUFFIX;
 
+                    if (m_limits.max_depth > 0) {
+                        // The completed collection gets nested in the new mapping.
+                        check_nesting_depth(count_nesting_depth(key_node), line, indent);
+                    }
+
                     add_new_key(std::move(key_node), line, indent);
                 }
                 else {
@@ -1045,6 +1128,11 @@ private:
                     m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING, mp_current_node);
                     m_flow_token_state = flow_token_state_t::NEEDS_VALUE_OR_SUFFIX;
 
+                    if (m_limits.max_depth > 0) {
+                        // The completed collection gets nested in the new mapping.
+                        check_nesting_depth(count_nesting_depth(key_node), line, indent);
+                    }
+
                     add_new_key(std::move(key_node), line, indent);
                 }
                 else {
@@ -1088,27 +1176,33 @@ private:
                     throw parse_error("The given anchor name must appear prior to the alias node.", line, indent);
                 }
 
+                // An alias node references the last anchor with the same name.
+                auto itr = mp_meta->anchor_table.equal_range(anchor_name).first;
+                std::advance(itr, anchor_counts - 1);
+                const auto& anchor_entry = itr->second;
+
                 basic_node_type node {};
                 node.m_attrs |= detail::node_attr_bits::alias_bit;
-                node.m_prop.anchor = anchor_name;
+                node.mp_prop.set_anchor(anchor_name);
+                node.m_value.p_anchor = &itr->second;
+                itr->second.add_ref();
                 detail::node_attr_bits::set_anchor_offset(anchor_counts - 1, node.m_attrs);
 
                 apply_directive_set(node);
                 apply_node_properties(node);
 
-                deserialize_scalar(lexer, std::move(node), indent, line, token);
-
                 // Check if the alias node is self-referential.
                 // If so, throw a parse error to avoid infinite recursion and stack overflow during deserialization.
-                auto itr = mp_meta->anchor_table.equal_range(anchor_name).first;
-                std::advance(itr, anchor_counts - 1);
-                const auto& anchor = itr->second;
-                const bool is_self_referential = anchor.contains_self_referential_alias(anchor_name, anchor_counts - 1);
-                if FK_YAML_UNLIKELY (is_self_referential) {
+                if FK_YAML_UNLIKELY (is_under_construction(anchor_entry)) {
                     const std::string msg = format("Self-referential alias (*%s) is found.", anchor_name.c_str());
                     throw parse_error(msg.c_str(), line, indent);
                 }
 
+                if (m_limits.max_aliases > 0 || m_limits.max_expanded_nodes > 0) {
+                    count_alias(anchor_entry, line, indent);
+                }
+
+                deserialize_scalar(lexer, std::move(node), indent, line, token);
                 continue;
             }
             case lexical_token_t::PLAIN_SCALAR:
@@ -1119,7 +1213,8 @@ private:
                     tag_type = tag_resolver_type::resolve_tag(m_tag_name, mp_meta);
                 }
 
-                basic_node_type node = scalar_parser_type(line, indent).parse_flow(token.type, tag_type, token.str);
+                m_scalar_parser.set_position(line, indent);
+                basic_node_type node = m_scalar_parser.parse_flow(token.type, tag_type, token.str);
                 apply_directive_set(node);
                 apply_node_properties(node);
 
@@ -1133,9 +1228,9 @@ private:
                     tag_type = tag_resolver_type::resolve_tag(m_tag_name, mp_meta);
                 }
 
+                m_scalar_parser.set_position(line, indent);
                 basic_node_type node =
-                    scalar_parser_type(line, indent)
-                        .parse_block(token.type, tag_type, token.str, lexer.get_block_scalar_header());
+                    m_scalar_parser.parse_block(token.type, tag_type, token.str, lexer.get_block_scalar_header());
                 apply_directive_set(node);
                 apply_node_properties(node);
 
@@ -1170,6 +1265,10 @@ private:
             throw parse_error("An unclosed flow collection found at the end of input", line, indent);
         }
 
+        if (m_limits.max_depth > 0 && m_context_stack.size() > m_limits.max_depth) {
+            check_nesting_depth(0, line, indent);
+        }
+
         last_type = token.type;
     }
 
@@ -1589,8 +1688,8 @@ private:
 
     /// @brief Set YAML directive properties to the given node.
     /// @param node A basic_node_type object to be set YAML directive properties.
-    void apply_directive_set(basic_node_type& node) noexcept {
-        node.mp_meta = mp_meta;
+    void apply_directive_set(basic_node_type& node) {
+        node.mp_prop.set_document(m_doc_prop);
     }
 
     /// @brief Closes the implicit single pair mapping wrapping a flow sequence entry, if one is open.
@@ -1653,6 +1752,194 @@ private:
         }
     }
 
+    /// @brief Checks if the anchored node of the given anchor table entry is still being deserialized.
+    /// @note
+    /// An alias must appear after its anchor, so an anchored node can contain an alias to itself only if the alias
+    /// appears before the anchored node is completed. Checking the nodes under construction is therefore enough to
+    /// detect self-referential aliases. This costs O(nesting depth) for each alias regardless of the size of the
+    /// anchored node, whereas searching the anchored node for the alias would make alias-heavy documents parse in
+    /// O(aliases * anchored node size).
+    /// @param entry An anchor table entry referenced by an alias node.
+    /// @return true if the anchored node is still being deserialized, false otherwise.
+    bool is_under_construction(const anchor_entry_type& entry) const noexcept {
+        const auto refers_to_entry = [&entry](const basic_node_type* p_node) {
+            return p_node == &entry.node || (p_node->is_anchor() && p_node->m_value.p_anchor == &entry);
+        };
+
+        if (mp_current_node != nullptr && refers_to_entry(mp_current_node)) {
+            return true;
+        }
+        for (const parse_context& context : m_context_stack) {
+            if (context.p_node != nullptr && refers_to_entry(context.p_node)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Checks if the nesting depth of the collections under construction exceeds the limit.
+    /// @param inner_depth The nesting depth of a completed node to be added to the current collection.
+    /// @param line The current line.
+    /// @param indent The current indentation width.
+    void check_nesting_depth(std::size_t inner_depth, uint32_t line, uint32_t indent) const {
+        std::size_t depth = inner_depth;
+        for (const parse_context& context : m_context_stack) {
+            switch (context.state) {
+            case context_state_t::BLOCK_MAPPING:
+            case context_state_t::BLOCK_SEQUENCE:
+            case context_state_t::FLOW_SEQUENCE:
+            case context_state_t::FLOW_SEQUENCE_KEY:
+            case context_state_t::FLOW_MAPPING:
+            case context_state_t::FLOW_MAPPING_KEY:
+                ++depth;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if FK_YAML_UNLIKELY (depth > m_limits.max_depth) {
+            const std::string msg =
+                format("The nesting depth of collections exceeds the limit (%zu).", m_limits.max_depth);
+            throw limit_exceeded(msg.c_str(), line, indent);
+        }
+    }
+
+    /// @brief Counts the collections in which the deepest node in the given node is nested, including the given node.
+    /// @note Aliases do not add the nesting depths of their anchored nodes.
+    /// @param node A node whose nesting depth is counted.
+    /// @return The nesting depth of the node. 0 if the node is not a collection.
+    static std::size_t count_nesting_depth(const basic_node_type& node) {
+        std::size_t max_depth = 0;
+        std::vector<std::pair<const basic_node_type*, std::size_t>> items {{&node, 1}};
+
+        while (!items.empty()) {
+            const std::pair<const basic_node_type*, std::size_t> item = items.back();
+            items.pop_back();
+
+            const basic_node_type* p_node = item.first;
+            if (p_node->is_alias()) {
+                continue;
+            }
+            if (p_node->is_anchor()) {
+                p_node = &p_node->m_value.p_anchor->node;
+            }
+
+            if (p_node->is_sequence()) {
+                max_depth = std::max(max_depth, item.second);
+                for (const basic_node_type& elem : p_node->as_seq()) {
+                    items.emplace_back(&elem, item.second + 1);
+                }
+            }
+            else if (p_node->is_mapping()) {
+                max_depth = std::max(max_depth, item.second);
+                for (const auto& pair : p_node->as_map()) {
+                    items.emplace_back(&pair.first, item.second + 1);
+                    items.emplace_back(&pair.second, item.second + 1);
+                }
+            }
+        }
+
+        return max_depth;
+    }
+
+    /// @brief Counts an alias node to the anchored node of the given entry against the limits.
+    /// @param entry An anchor table entry referenced by the alias node.
+    /// @param line The line where the alias node is found.
+    /// @param indent The indentation width in the line where the alias node is found.
+    void count_alias(const anchor_entry_type& entry, uint32_t line, uint32_t indent) {
+        ++m_alias_count;
+        if FK_YAML_UNLIKELY (m_limits.max_aliases > 0 && m_alias_count > m_limits.max_aliases) {
+            const std::string msg = format("The number of aliases exceeds the limit (%zu).", m_limits.max_aliases);
+            throw limit_exceeded(msg.c_str(), line, indent);
+        }
+
+        if (m_limits.max_expanded_nodes > 0) {
+            // The expanded nodes of the aliases alone are a lower bound of the expanded nodes of the document. This
+            // detects documents like "billion laughs" without expanding them.
+            const auto itr = m_expanded_sizes.find(&entry);
+            m_alias_expansion +=
+                (itr != m_expanded_sizes.end()) ? itr->second : count_expanded_nodes(entry.node, &entry);
+            if FK_YAML_UNLIKELY (m_alias_expansion > m_limits.max_expanded_nodes) {
+                const std::string msg =
+                    format("The number of expanded nodes exceeds the limit (%zu).", m_limits.max_expanded_nodes);
+                throw limit_exceeded(msg.c_str(), line, indent);
+            }
+        }
+    }
+
+    /// @brief Checks if the number of expanded nodes in the current document exceeds the limit.
+    /// @param expanded_nodes The number of expanded nodes in the current document.
+    /// @param lexer The lexical analyzer used for the current document.
+    void check_expanded_nodes(std::size_t expanded_nodes, const lexer_type& lexer) const {
+        if FK_YAML_UNLIKELY (expanded_nodes > m_limits.max_expanded_nodes) {
+            const std::string msg =
+                format("The number of expanded nodes exceeds the limit (%zu).", m_limits.max_expanded_nodes);
+            throw limit_exceeded(msg.c_str(), lexer.get_lines_processed(), lexer.get_last_token_begin_pos());
+        }
+    }
+
+    /// @brief Counts the nodes in the given node, where each alias node counts as the nodes of its anchored node.
+    /// @note
+    /// The counts for the anchored nodes found in the walk are memoized, and an alias can refer only to an anchored
+    /// node completed before it. So each alias costs O(1) and every node in a document is walked at most once for
+    /// the aliases to its enclosing anchored nodes plus once for the whole document.
+    /// @param node A node whose expanded nodes are counted.
+    /// @param p_entry The anchor table entry whose anchored node is `node`, if any.
+    /// @return The number of the expanded nodes.
+    std::size_t count_expanded_nodes(const basic_node_type& node, const anchor_entry_type* p_entry) {
+        // An item either refers to a node to be counted, or marks the end of the anchored node of p_entry.
+        struct walk_item {
+            const basic_node_type* p_node;
+            const anchor_entry_type* p_entry;
+            std::size_t count_at_begin;
+        };
+
+        std::vector<walk_item> items {};
+        std::size_t count = 0;
+        if (p_entry != nullptr) {
+            items.push_back({nullptr, p_entry, 0});
+        }
+        items.push_back({&node, nullptr, 0});
+
+        while (!items.empty()) {
+            const walk_item item = items.back();
+            items.pop_back();
+
+            if (item.p_node == nullptr) {
+                m_expanded_sizes[item.p_entry] = count - item.count_at_begin;
+                continue;
+            }
+
+            const basic_node_type* p_node = item.p_node;
+            if (p_node->is_anchor() || p_node->is_alias()) {
+                const anchor_entry_type* p_anchor = p_node->m_value.p_anchor;
+                const auto itr = m_expanded_sizes.find(p_anchor);
+                if (itr != m_expanded_sizes.end()) {
+                    count += itr->second;
+                    continue;
+                }
+                items.push_back({nullptr, p_anchor, count});
+                p_node = &p_anchor->node;
+            }
+
+            ++count;
+            if (p_node->is_sequence()) {
+                for (const basic_node_type& elem : p_node->as_seq()) {
+                    items.push_back({&elem, nullptr, 0});
+                }
+            }
+            else if (p_node->is_mapping()) {
+                for (const auto& pair : p_node->as_map()) {
+                    items.push_back({&pair.first, nullptr, 0});
+                    items.push_back({&pair.second, nullptr, 0});
+                }
+            }
+        }
+
+        return count;
+    }
+
     /// @brief Update the target YAML version with an input string.
     /// @param version_str A YAML version string.
     yaml_version_type convert_yaml_version(str_view version_str) noexcept {
@@ -1660,6 +1947,10 @@ private:
     }
 
 private:
+    /// The lexical analyzer for the current input.
+    lexer_type m_lexer {};
+    /// The parser for scalars in the current input.
+    scalar_parser_type m_scalar_parser {0, 0};
     /// The currently focused YAML node.
     basic_node_type* mp_current_node {nullptr};
     /// The stack of parse contexts.
@@ -1668,12 +1959,18 @@ private:
     uint32_t m_flow_context_depth {0};
     /// The set of YAML directives.
     std::shared_ptr<doc_metainfo_type> mp_meta {};
+    /// The property set shared by the nodes without their own tags or anchors in the current document.
+    node_property_ptr<basic_node_type> m_doc_prop {};
     /// A flag to determine the need for YAML anchor node implementation.
     bool m_needs_anchor_impl {false};
     /// A flag to determine the need for a corresponding node with the last YAML tag.
     bool m_needs_tag_impl {false};
     /// A flag to determine the need for a value separator or a flow suffix to follow.
     flow_token_state_t m_flow_token_state {flow_token_state_t::NEEDS_VALUE_OR_SUFFIX};
+    /// Whether string scalars are requested to refer to the input buffer.
+    bool m_borrows_input {false};
+    /// Whether string scalars refer to the input buffer in the current deserialization.
+    bool m_borrows_strings {false};
     /// The last YAML anchor name.
     str_view m_anchor_name;
     /// The last tag name.
@@ -1682,6 +1979,14 @@ private:
     str_view m_root_anchor_name;
     /// The root tag name. (maybe empty and unused)
     str_view m_root_tag_name;
+    /// The limits checked for each document.
+    deserialization_limits m_limits {};
+    /// The number of alias nodes found so far in the current document.
+    std::size_t m_alias_count {0};
+    /// The total number of nodes which the alias nodes found so far in the current document expand into.
+    std::size_t m_alias_expansion {0};
+    /// The expanded sizes of the anchored nodes in the current document which have been computed so far.
+    std::unordered_map<const anchor_entry_type*, std::size_t> m_expanded_sizes {};
 };
 
 FK_YAML_DETAIL_NAMESPACE_END
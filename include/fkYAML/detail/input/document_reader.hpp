@@ -0,0 +1,304 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_DOCUMENT_READER_HPP
+#define FK_YAML_DETAIL_INPUT_DOCUMENT_READER_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/encodings/utf_encode_detector.hpp>
+#include <fkYAML/detail/encodings/utf_encode_t.hpp>
+#include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/document_splitter.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/deserialization_limits.hpp>
+#include <fkYAML/exception.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A class which reads YAML documents one by one from an input stream or a C-style file handle.
+/// @note
+/// Unlike deserialize_docs(), the input is read line by line only up to the next document boundary, i.e., a
+/// document end marker (`...`) or the next directives end marker (`---`), so that each document becomes available
+/// as soon as it is complete and only one document is buffered at a time. Since document markers at the beginning of
+/// a line cannot be contents of any node, the boundaries are detected without parsing contents.
+/// @note
+/// Only UTF-8 encoded inputs are read incrementally. UTF-16 or UTF-32 encoded inputs are read at once on the first
+/// call to next_document() and the resulting documents are handed out one by one.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_document_reader {
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_document_reader only accepts basic_node<...>");
+
+    /** A type for the target basic_node. */
+    using basic_node_type = BasicNodeType;
+    /** A type for the deserializer. */
+    using deserializer_type = basic_deserializer<basic_node_type>;
+
+public:
+    /// @brief Construct a new basic_document_reader object for an input stream.
+    /// @param is An input stream. It must outlive this object.
+    explicit basic_document_reader(std::istream& is)
+        : mp_istream(&is) {
+        if FK_YAML_UNLIKELY (!is.good()) {
+            throw fkyaml::exception("Invalid stream.");
+        }
+    }
+
+    /// @brief Construct a new basic_document_reader object for a C-style file handle.
+    /// @note This class doesn't call fopen() nor fclose(). It's user's responsibility to call those functions.
+    /// @param file A file handle. It must outlive this object.
+    explicit basic_document_reader(std::FILE* file)
+        : mp_file(file) {
+        if FK_YAML_UNLIKELY (!file) {
+            throw fkyaml::exception("Invalid FILE object pointer.");
+        }
+    }
+
+    // allow only move construct/assignment
+    basic_document_reader(const basic_document_reader&) = delete;
+    basic_document_reader& operator=(const basic_document_reader&) = delete;
+    basic_document_reader(basic_document_reader&&) = default;
+    basic_document_reader& operator=(basic_document_reader&&) = default;
+    ~basic_document_reader() = default;
+
+public:
+    /// @brief Set the limits checked for each document read afterwards.
+    /// @note UTF-16 or UTF-32 encoded inputs are deserialized at once on the first call to next_document(), so the
+    /// limits must be set before that call to be applied to such inputs.
+    /// @param limits The limits on the structure of each document.
+    void set_limits(const deserialization_limits& limits) noexcept {
+        m_deserializer.set_limits(limits);
+    }
+
+    /// @brief Read the next YAML document from the input.
+    /// @note
+    /// The line and column numbers in parse errors are counted from the beginning of the document.
+    /// Once this function throws an exception, the state of this object is unspecified.
+    /// @param doc The variable to store the root node of the next YAML document.
+    /// @return true if a document has been read, false if there are no more documents in the input.
+    bool next_document(basic_node_type& doc) {
+        if FK_YAML_UNLIKELY (m_is_first_call) {
+            m_is_first_call = false;
+            prepare();
+        }
+
+        if FK_YAML_UNLIKELY (m_encode_type != utf_encode_t::UTF_8) {
+            if (m_num_docs == m_pending_docs.size()) {
+                m_pending_docs.clear();
+                return false;
+            }
+            doc = std::move(m_pending_docs[m_num_docs++]);
+            return true;
+        }
+
+        if (m_is_at_end) {
+            return false;
+        }
+
+        m_doc_buffer.clear();
+        bool is_started = false;
+
+        while (fetch_line()) {
+            if (is_document_marker(m_line, '-')) {
+                if (is_started) {
+                    // the marker starts the next document, which is processed in the next call.
+                    m_has_unread_line = true;
+                    return deserialize(doc);
+                }
+                is_started = true;
+                m_doc_buffer += m_line;
+                continue;
+            }
+
+            if (is_document_marker(m_line, '.')) {
+                if (is_started) {
+                    m_doc_buffer += m_line;
+                    return deserialize(doc);
+                }
+                // a document end marker without any document, which can be followed by directives.
+                m_doc_buffer.clear();
+                continue;
+            }
+
+            if (!is_started && m_line[0] != '%' && !is_blank_or_comment(m_line)) {
+                is_started = true;
+            }
+            m_doc_buffer += m_line;
+        }
+
+        m_is_at_end = true;
+
+        // an input without any document contents is deserialized into a null node just like deserialize_docs().
+        if (is_started || m_num_docs == 0) {
+            return deserialize(doc);
+        }
+        return false;
+    }
+
+private:
+    /// @brief Detect the encoding type of the input from its first line, and read the whole input at once if it's
+    /// not UTF-8 encoded.
+    void prepare() {
+        if (!read_first_line()) {
+            // The input is empty. Let it be deserialized as an empty UTF-8 document.
+            return;
+        }
+
+        // the inner curly braces are necessary for older compilers
+        std::array<uint8_t, 4> bytes {{}};
+        bytes.fill(0xFFu);
+        for (std::size_t i = 0; i < 4 && i < m_line.size(); i++) {
+            bytes[i] = static_cast<uint8_t>(m_line[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        bool has_bom = false;
+        m_encode_type = detect_encoding_type(bytes, has_bom);
+
+        if FK_YAML_UNLIKELY (m_encode_type != utf_encode_t::UTF_8) {
+            read_rest();
+            m_pending_docs = m_deserializer.deserialize_docs(input_adapter(m_line));
+            m_line.clear();
+            m_line.shrink_to_fit();
+            return;
+        }
+
+        if (has_bom && m_line.size() >= 3) {
+            m_line.erase(0, 3);
+        }
+        m_has_unread_line = true;
+    }
+
+    /// @brief Deserialize the buffered document.
+    /// @param doc The variable to store the root node of the document.
+    /// @return true always.
+    bool deserialize(basic_node_type& doc) {
+        doc = m_deserializer.deserialize(input_adapter(m_doc_buffer));
+        ++m_num_docs;
+        return true;
+    }
+
+    /// @brief Get the next line either from the unread line or the input.
+    /// @return true if a line is available in m_line, false otherwise.
+    bool fetch_line() {
+        if (m_has_unread_line) {
+            m_has_unread_line = false;
+            return true;
+        }
+        return read_line();
+    }
+
+    /// @brief Read the first line from the input without assuming any encoding.
+    /// @return true if a line has been read into m_line, false otherwise.
+    bool read_first_line() {
+        if (mp_istream) {
+            return read_line();
+        }
+
+        // Read byte by byte since UTF-16 or UTF-32 encoded lines may contain null characters.
+        m_line.clear();
+        int ch = 0;
+        while ((ch = std::fgetc(mp_file)) != EOF) {
+            m_line.push_back(static_cast<char>(ch));
+            if (ch == '\n') {
+                break;
+            }
+        }
+        return !m_line.empty();
+    }
+
+    /// @brief Read the next line including a trailing newline code, if any, from the input.
+    /// @return true if a line has been read into m_line, false otherwise.
+    bool read_line() {
+        m_line.clear();
+
+        if (mp_istream) {
+            std::getline(*mp_istream, m_line);
+            if (mp_istream->eof()) {
+                // the last line without a newline code.
+                return !m_line.empty();
+            }
+            if FK_YAML_UNLIKELY (mp_istream->fail()) {
+                return false;
+            }
+            m_line.push_back('\n');
+            return true;
+        }
+
+        bool has_read = false;
+        char tmp_buf[256] {};
+        while (std::fgets(&tmp_buf[0], sizeof(tmp_buf), mp_file) != nullptr) {
+            has_read = true;
+            const std::size_t size = std::strlen(&tmp_buf[0]);
+            m_line.append(&tmp_buf[0], size);
+            if (size > 0 && tmp_buf[size - 1] == '\n') {
+                break;
+            }
+        }
+        return has_read;
+    }
+
+    /// @brief Append the rest of the input to m_line.
+    void read_rest() {
+        char tmp_buf[256] {};
+        constexpr std::size_t buf_size = sizeof(tmp_buf) / sizeof(tmp_buf[0]);
+
+        if (mp_istream) {
+            while (!mp_istream->eof()) {
+                mp_istream->read(&tmp_buf[0], buf_size);
+                const auto read_size = static_cast<std::size_t>(mp_istream->gcount());
+                if (read_size == 0) {
+                    break;
+                }
+                m_line.append(&tmp_buf[0], read_size);
+            }
+            return;
+        }
+
+        std::size_t read_size = 0;
+        while ((read_size = std::fread(&tmp_buf[0], sizeof(char), buf_size, mp_file)) > 0) {
+            m_line.append(&tmp_buf[0], read_size);
+        }
+    }
+
+private:
+    /// The pointer to the input stream, if any.
+    std::istream* mp_istream {nullptr};
+    /// The pointer to the input file handle, if any.
+    std::FILE* mp_file {nullptr};
+    /// The encoding type of the input.
+    utf_encode_t m_encode_type {utf_encode_t::UTF_8};
+    /// The deserializer reused for every document.
+    deserializer_type m_deserializer {};
+    /// The buffer for the current line.
+    std::string m_line {};
+    /// The buffer for the current document.
+    std::string m_doc_buffer {};
+    /// The documents read at once from an input which is not UTF-8 encoded.
+    std::vector<basic_node_type> m_pending_docs {};
+    /// The number of documents read so far.
+    std::size_t m_num_docs {0};
+    /// Whether next_document() has not been called yet.
+    bool m_is_first_call {true};
+    /// Whether m_line holds a line which has been read but not processed yet.
+    bool m_has_unread_line {false};
+    /// Whether the whole input has been read.
+    bool m_is_at_end {false};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_DOCUMENT_READER_HPP */
@@ -0,0 +1,142 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_DOCUMENT_SPLITTER_HPP
+#define FK_YAML_DETAIL_INPUT_DOCUMENT_SPLITTER_HPP
+
+#include <cstring>
+#include <vector>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/str_view.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief Check if the line begins with a document marker, i.e., `---` or `...`.
+/// @param line A line to be checked.
+/// @param marker_char The character of the document marker to be checked.
+/// @return true if the line begins with the document marker, false otherwise.
+inline bool is_document_marker(str_view line, char marker_char) noexcept {
+    if (line.size() < 3 || line[0] != marker_char || line[1] != marker_char || line[2] != marker_char) {
+        return false;
+    }
+    if (line.size() == 3) {
+        return true;
+    }
+
+    switch (line[3]) {
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// @brief Check if the line has no contents other than white spaces and a comment.
+/// @param line A line to be checked.
+/// @return true if the line has no contents, false otherwise.
+inline bool is_blank_or_comment(str_view line) noexcept {
+    for (const char c : line) {
+        switch (c) {
+        case ' ':
+        case '\t':
+        case '\r':
+            continue;
+        case '\n':
+        case '#':
+            return true;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Check if a line which begins with a document marker has some contents after the marker.
+/// @param line A line which begins with a document marker.
+/// @return true if the line has some contents after the marker, false otherwise.
+inline bool has_contents_after_marker(str_view line) noexcept {
+    return line.size() > 3 && !is_blank_or_comment(str_view {line.begin() + 3, line.end()});
+}
+
+/// @brief Check if a line which begins with a document marker has a directive-like content (`%`) after the marker.
+/// @param line A line which begins with a document marker.
+/// @return true if the first content after the marker begins with `%`, false otherwise.
+inline bool has_directive_after_marker(str_view line) noexcept {
+    for (std::size_t i = 3; i < line.size(); i++) {
+        switch (line[i]) {
+        case ' ':
+        case '\t':
+            continue;
+        default:
+            return line[i] == '%';
+        }
+    }
+    return false;
+}
+
+/// @brief Split an input buffer into chunks of whole YAML documents without parsing their contents.
+/// @note
+/// Since document markers at the beginning of a line cannot be contents of any node, a chunk is ended just before a
+/// directives end marker (`---`) which follows some document contents. Directives and comments after a document end
+/// marker (`...`) are kept together with the next document, and so are empty documents between directives end
+/// markers. If a document marker is followed by `%` on the same line, the whole input is returned as the only chunk
+/// since such a marker is handled differently at the beginning of a chunk than in the middle of the whole input. For
+/// valid YAML inputs, deserializing chunks one by one therefore results in the same documents as deserializing the
+/// whole buffer at once.
+/// @param input An input buffer.
+/// @param min_chunk_size The minimum byte size of a chunk except the last one. Adjacent documents are put in a chunk
+/// until it gets at least this size, so that small documents are not processed one by one.
+/// @return The chunks in the order of the input buffer. At least one chunk is always returned.
+inline std::vector<str_view> split_into_documents(str_view input, std::size_t min_chunk_size) {
+    std::vector<str_view> chunks {};
+    const char* p_chunk_begin = input.begin();
+
+    // whether the current document has some contents other than directives, comments and blank lines.
+    bool has_contents = false;
+    const char* p_line = input.begin();
+    while (p_line != input.end()) {
+        const auto* p_newline =
+            static_cast<const char*>(std::memchr(p_line, '\n', static_cast<std::size_t>(input.end() - p_line)));
+        const char* p_next = (p_newline != nullptr) ? p_newline + 1 : input.end();
+        const str_view cur_line {p_line, p_next};
+
+        if (is_document_marker(cur_line, '-')) {
+            if FK_YAML_UNLIKELY (has_directive_after_marker(cur_line)) {
+                return {input};
+            }
+            if (has_contents && static_cast<std::size_t>(p_line - p_chunk_begin) >= min_chunk_size) {
+                chunks.emplace_back(p_chunk_begin, p_line);
+                p_chunk_begin = p_line;
+            }
+            has_contents = has_contents_after_marker(cur_line);
+        }
+        else if (is_document_marker(cur_line, '.')) {
+            if FK_YAML_UNLIKELY (has_directive_after_marker(cur_line)) {
+                return {input};
+            }
+            has_contents = false;
+        }
+        else if (!has_contents && !is_blank_or_comment(cur_line)) {
+            // directives are detected after indentation as the lexer does.
+            has_contents = cur_line[cur_line.find_first_not_of(" \t")] != '%';
+        }
+
+        p_line = p_next;
+    }
+
+    chunks.emplace_back(p_chunk_begin, input.end());
+    return chunks;
+}
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_DOCUMENT_SPLITTER_HPP */
@@ -0,0 +1,1470 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_EVENT_PARSER_HPP
+#define FK_YAML_DETAIL_INPUT_EVENT_PARSER_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/input/block_scalar_header.hpp>
+#include <fkYAML/detail/input/lexical_analyzer.hpp>
+#include <fkYAML/detail/input/scalar_parser.hpp>
+#include <fkYAML/detail/meta/input_adapter_traits.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/str_view.hpp>
+#include <fkYAML/detail/string_formatter.hpp>
+#include <fkYAML/detail/types/lexical_token_t.hpp>
+#include <fkYAML/event_handler.hpp>
+#include <fkYAML/exception.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A class which parses YAML documents into a stream of events without creating nodes.
+/// @note
+/// The memory usage does not depend on the size of documents but only on the nesting depth of collections and the
+/// number of anchors. Therefore, this parser does not check duplicate mapping keys. A flow collection which may be an
+/// implicit key (e.g., `[foo, bar]: baz` or `[[foo]: bar]`) is not known to be a key until the token after it is
+/// found, so its events are buffered until then. Since the YAML specification restricts implicit keys to a single
+/// line of at most 1024 characters, events are buffered only for such a limited part of the input.
+/// @tparam BasicNodeType A basic_node template instance type used to parse scalar contents.
+template <typename BasicNodeType>
+class basic_event_parser {
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_event_parser only accepts basic_node<...>");
+
+    /** A type for the target basic_node. */
+    using basic_node_type = BasicNodeType;
+    /** A type for the lexical analyzer. */
+    using lexer_type = lexical_analyzer;
+    /** A type for the scalar parser. */
+    using scalar_parser_type = scalar_parser<basic_node_type>;
+
+    /// The line value used while no node property is stored, which is greater than any line.
+    static constexpr uint32_t no_props_line = static_cast<uint32_t>(-1);
+    /// The maximum length of implicit keys, which is defined in the YAML specification.
+    static constexpr uint32_t max_implicit_key_length = 1024;
+
+    /// @brief Definition of state types of parse contexts.
+    enum class context_state_t : std::uint8_t {
+        BLOCK_MAPPING_KEY,          //!< A block mapping which expects a key.
+        BLOCK_MAPPING_EXPLICIT_KEY, //!< A block mapping which expects contents of an explicit key after `? `.
+        BLOCK_MAPPING_SEPARATOR,    //!< A block mapping which expects `:` after an explicit key.
+        BLOCK_MAPPING_VALUE,        //!< A block mapping which expects a value after `:`.
+        BLOCK_SEQUENCE_ENTRY,       //!< A block sequence which expects an entry after `- `.
+        BLOCK_SEQUENCE,             //!< A block sequence which expects `- ` for the next entry.
+        FLOW_SEQUENCE_ENTRY,        //!< A flow sequence which expects an entry or `]`.
+        FLOW_SEQUENCE,              //!< A flow sequence which expects `,` or `]` after an entry.
+        FLOW_MAPPING_KEY,           //!< A flow mapping which expects a key or `}`.
+        FLOW_MAPPING_SEPARATOR,     //!< A flow mapping which expects `:`, `,` or `}` after a key.
+        FLOW_MAPPING_VALUE,         //!< A flow mapping which expects a value after `:`.
+        FLOW_MAPPING,               //!< A flow mapping which expects `,` or `}` after a value.
+        FLOW_PAIR_VALUE,            //!< A single pair mapping in a flow sequence which expects a value.
+        FLOW_PAIR,                  //!< A single pair mapping in a flow sequence which has got a value.
+    };
+
+    /// @brief Context information set for parsing.
+    struct parse_context {
+        /// @brief Construct a new parse_context object.
+        /// @param line The line where the current entry begins. (count from zero)
+        /// @param indent The indentation width of the collection. (count from zero)
+        /// @param state The parse context type.
+        parse_context(uint32_t line, uint32_t indent, context_state_t state) noexcept
+            : line(line),
+              indent(indent),
+              state(state) {
+        }
+
+        /// The line where the current entry begins. (count from zero)
+        uint32_t line {0};
+        /// The indentation width of the collection. (count from zero)
+        uint32_t indent {0};
+        /// The parse context type.
+        context_state_t state {context_state_t::BLOCK_MAPPING_KEY};
+        /// Whether the current block mapping entry has begun with `? ` or `: `.
+        bool is_explicit {false};
+    };
+
+    /// @brief Node properties waiting for the node which they belong to.
+    struct node_properties {
+        /// @brief Checks if neither an anchor nor a tag is stored.
+        /// @return true if no property is stored, false otherwise.
+        bool empty() const noexcept {
+            return !has_anchor && !has_tag;
+        }
+
+        /// The anchor name.
+        str_view anchor {};
+        /// The tag name.
+        str_view tag {};
+        /// The line where the properties begin.
+        uint32_t line {no_props_line};
+        /// The indentation width where the properties begin.
+        uint32_t indent {0};
+        /// Whether an anchor name is stored.
+        bool has_anchor {false};
+        /// Whether a tag name is stored.
+        bool has_tag {false};
+    };
+
+    /// @brief Definition of event types reported to handlers.
+    enum class event_t : std::uint8_t {
+        START_MAPPING,  //!< The beginning of a mapping.
+        END_MAPPING,    //!< The end of a mapping.
+        START_SEQUENCE, //!< The beginning of a sequence.
+        END_SEQUENCE,   //!< The end of a sequence.
+        SCALAR,         //!< A scalar.
+        ALIAS,          //!< An alias.
+        ANCHOR,         //!< An anchor of the next node.
+        TAG,            //!< A tag of the next node.
+    };
+
+    /// @brief An event buffered while a flow collection may be an implicit key.
+    struct buffered_event {
+        /// The event type.
+        event_t type {event_t::SCALAR};
+        /// The name of an anchor, a tag or an alias, which refers to the input.
+        str_view name {};
+        /// The offset of scalar contents in the buffer for them.
+        std::size_t contents_begin {0};
+        /// The size of scalar contents.
+        std::size_t contents_size {0};
+        /// The scalar style.
+        scalar_style style {scalar_style::PLAIN};
+        /// The line where the event has been found.
+        uint32_t line {0};
+        /// The indentation width where the event has been found.
+        uint32_t indent {0};
+    };
+
+    /// @brief A flow collection which may be an implicit key until the token after it is found.
+    struct key_candidate {
+        /// @brief Construct a new key_candidate object.
+        /// @param event_index The index of the first buffered event of the collection.
+        /// @param line The line where the collection begins.
+        /// @param indent The indentation width where the collection begins.
+        /// @param flow_depth The depth of flow contexts inside the collection.
+        /// @param num_outer_contexts The number of the contexts which the collection is nested in.
+        /// @param is_block_key Whether the collection may be an implicit key of a block mapping.
+        key_candidate(
+            std::size_t event_index, uint32_t line, uint32_t indent, uint32_t flow_depth,
+            std::size_t num_outer_contexts, bool is_block_key)
+            : event_index(event_index),
+              line(line),
+              indent(indent),
+              flow_depth(flow_depth),
+              num_outer_contexts(num_outer_contexts),
+              is_block_key(is_block_key) {
+        }
+
+        /// The index of the first buffered event of the collection.
+        std::size_t event_index {0};
+        /// The line where the collection begins.
+        uint32_t line {0};
+        /// The indentation width where the collection begins.
+        uint32_t indent {0};
+        /// The depth of flow contexts inside the collection.
+        uint32_t flow_depth {0};
+        /// The number of the contexts which the collection is nested in.
+        std::size_t num_outer_contexts {0};
+        /// Whether the collection may be an implicit key of a block mapping. If so, its node properties and position
+        /// are checked after the token after it is found since they depend on whether it is a key.
+        bool is_block_key {false};
+        /// The node properties which were waiting for the collection in the block context.
+        node_properties props {};
+        /// The node properties on the previous lines of props in the block context.
+        node_properties collection_props {};
+    };
+
+public:
+    /// @brief Parses all the YAML documents in the input and reports events to the handler.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @tparam HandlerType The type of an event handler object.
+    /// @param input_adapter An input adapter object for the input source buffer.
+    /// @param handler An event handler object.
+    /// @return true if the whole input has been parsed, false if the handler has aborted parsing.
+    template <
+        typename InputAdapterType, typename HandlerType,
+        enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    bool parse(InputAdapterType&& input_adapter, HandlerType& handler) {
+        const str_view input_view = input_adapter.get_buffer_view();
+        lexer_type lexer(input_view);
+
+        lexical_token_t type {lexical_token_t::END_OF_BUFFER};
+        do {
+            if (!parse_document(lexer, handler, type)) {
+                return false;
+            }
+            if (type == lexical_token_t::END_OF_DOCUMENT) {
+                // See basic_deserializer::deserialize_docs() for the reason why the document state is set here.
+                lexer.set_document_state(true);
+                if (lexer.peek_next_token().type == lexical_token_t::END_OF_BUFFER) {
+                    break;
+                }
+            }
+        } while (type != lexical_token_t::END_OF_BUFFER);
+
+        return true;
+    }
+
+private:
+    /// @brief Parses a YAML document and reports events to the handler.
+    /// @param lexer The lexical analyzer to be used.
+    /// @param handler An event handler object.
+    /// @param last_type The variable to store the last lexical token type.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_document(lexer_type& lexer, HandlerType& handler, lexical_token_t& last_type) {
+        m_context_stack.clear();
+        m_flow_context_depth = 0;
+        m_is_root_parsed = false;
+        m_is_at_document_end = false;
+        m_follows_flow_collection = false;
+        clear_node_properties();
+        m_key_candidates.clear();
+        m_events.clear();
+        m_event_contents.clear();
+        m_anchors.clear();
+        m_collection_anchors.clear();
+        m_next_anchor = str_view();
+
+        lexical_token token {};
+        parse_directives(lexer, token);
+
+        if (!handler.start_document()) {
+            return false;
+        }
+
+        for (;;) {
+            m_line = lexer.get_lines_processed();
+            m_indent = lexer.get_last_token_begin_pos();
+
+            if (!m_key_candidates.empty()) {
+                bool is_key = false;
+                if (!resolve_key_candidates(handler, token.type, is_key)) {
+                    return false;
+                }
+                if (is_key) {
+                    // the key separator has been consumed by the key.
+                    m_follows_flow_collection = false;
+                    token = lexer.get_next_token();
+                    continue;
+                }
+            }
+
+            bool follows_flow_collection = false;
+            bool continues = true;
+            switch (token.type) {
+            case lexical_token_t::ANCHOR_PREFIX:
+            case lexical_token_t::TAG_PREFIX:
+                continues = unwind_block_contexts(handler, false);
+                set_node_property(token);
+                token = lexer.get_next_token();
+                break;
+            case lexical_token_t::SEQUENCE_BLOCK_PREFIX:
+                continues = parse_block_sequence_entry(handler);
+                token = lexer.get_next_token();
+                break;
+            case lexical_token_t::EXPLICIT_KEY_PREFIX:
+                continues = parse_explicit_key(handler);
+                token = lexer.get_next_token();
+                break;
+            case lexical_token_t::KEY_SEPARATOR:
+                continues = parse_key_separator(handler);
+                token = lexer.get_next_token();
+                break;
+            case lexical_token_t::VALUE_SEPARATOR:
+                continues = parse_value_separator(handler);
+                token = lexer.get_next_token();
+                break;
+            case lexical_token_t::SEQUENCE_FLOW_BEGIN:
+            case lexical_token_t::MAPPING_FLOW_BEGIN:
+                continues = parse_flow_collection_begin(lexer, handler, token.type);
+                token = lexer.get_next_token();
+                break;
+            case lexical_token_t::SEQUENCE_FLOW_END:
+            case lexical_token_t::MAPPING_FLOW_END:
+                continues = parse_flow_collection_end(lexer, handler, token.type);
+                follows_flow_collection = true;
+                token = lexer.get_next_token();
+                break;
+            case lexical_token_t::ALIAS_PREFIX:
+            case lexical_token_t::PLAIN_SCALAR:
+            case lexical_token_t::SINGLE_QUOTED_SCALAR:
+            case lexical_token_t::DOUBLE_QUOTED_SCALAR:
+                // the token is replaced with the next one to check if the scalar is an implicit key.
+                continues = parse_flow_scalar(lexer, handler, token);
+                break;
+            case lexical_token_t::BLOCK_LITERAL_SCALAR:
+            case lexical_token_t::BLOCK_FOLDED_SCALAR:
+                continues = parse_block_scalar(lexer, handler, token);
+                token = lexer.get_next_token();
+                break;
+            // these tokens end parsing the current YAML document.
+            case lexical_token_t::END_OF_BUFFER:
+            case lexical_token_t::END_OF_DIRECTIVES:
+            case lexical_token_t::END_OF_DOCUMENT:
+                if FK_YAML_UNLIKELY (m_flow_context_depth > 0) {
+                    if (token.type == lexical_token_t::END_OF_BUFFER) {
+                        throw parse_error("An unclosed flow collection found at the end of input", m_line, m_indent);
+                    }
+                    throw parse_error("An invalid document marker found in a flow collection", m_line, m_indent);
+                }
+                last_type = token.type;
+                return end_document(handler);
+            // no way to come here while lexically analyzing document contents.
+            case lexical_token_t::YAML_VER_DIRECTIVE: // LCOV_EXCL_LINE
+            case lexical_token_t::TAG_DIRECTIVE:      // LCOV_EXCL_LINE
+            case lexical_token_t::INVALID_DIRECTIVE:  // LCOV_EXCL_LINE
+                detail::unreachable();                // LCOV_EXCL_LINE
+            }
+
+            if (!continues) {
+                return false;
+            }
+            m_follows_flow_collection = follows_flow_collection;
+        }
+    }
+
+    /// @brief Parses the YAML directives if specified.
+    /// @note Directives are only validated since tags are reported as they are written in the input.
+    /// @param lexer The lexical analyzer to be used.
+    /// @param last_token Storage for the first token after directives.
+    void parse_directives(lexer_type& lexer, lexical_token& last_token) {
+        bool is_version_specified = false;
+        bool is_primary_handle_specified = false;
+        bool is_secondary_handle_specified = false;
+        bool lacks_end_of_directives_marker = false;
+        lexer.set_document_state(true);
+
+        for (;;) {
+            const lexical_token token = lexer.get_next_token();
+
+            switch (token.type) {
+            case lexical_token_t::YAML_VER_DIRECTIVE:
+                if FK_YAML_UNLIKELY (is_version_specified) {
+                    throw parse_error(
+                        "YAML version cannot be specified more than once.",
+                        lexer.get_lines_processed(),
+                        lexer.get_last_token_begin_pos());
+                }
+                is_version_specified = true;
+                lacks_end_of_directives_marker = true;
+                break;
+            case lexical_token_t::TAG_DIRECTIVE: {
+                const std::size_t handle_size = lexer.get_tag_handle().size();
+                if FK_YAML_UNLIKELY (
+                    (handle_size == 1 && is_primary_handle_specified) ||
+                    (handle_size == 2 && is_secondary_handle_specified)) {
+                    throw parse_error(
+                        handle_size == 1 ? "Primary handle cannot be specified more than once."
+                                         : "Secondary handle cannot be specified more than once.",
+                        lexer.get_lines_processed(),
+                        lexer.get_last_token_begin_pos());
+                }
+                is_primary_handle_specified |= (handle_size == 1);
+                is_secondary_handle_specified |= (handle_size == 2);
+                lacks_end_of_directives_marker = true;
+                break;
+            }
+            case lexical_token_t::INVALID_DIRECTIVE:
+                // ignored as basic_deserializer does.
+                break;
+            case lexical_token_t::END_OF_DIRECTIVES:
+                lacks_end_of_directives_marker = false;
+                break;
+            default:
+                if FK_YAML_UNLIKELY (lacks_end_of_directives_marker) {
+                    throw parse_error(
+                        "The end of directives marker (---) is missing after directives.",
+                        lexer.get_lines_processed(),
+                        lexer.get_last_token_begin_pos());
+                }
+                last_token = token;
+                lexer.set_document_state(false);
+                return;
+            }
+        }
+    }
+
+    /// @brief Parses a block sequence entry prefix (`- `).
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_block_sequence_entry(HandlerType& handler) {
+        if FK_YAML_UNLIKELY (m_flow_context_depth > 0) {
+            throw parse_error("invalid block sequence entry is found.", m_line, m_indent);
+        }
+        if (!unwind_block_contexts(handler, true)) {
+            return false;
+        }
+
+        if (!m_context_stack.empty()) {
+            parse_context& context = m_context_stack.back();
+            const bool is_block_sequence = context.state == context_state_t::BLOCK_SEQUENCE ||
+                                           context.state == context_state_t::BLOCK_SEQUENCE_ENTRY;
+            if (is_block_sequence && context.indent == m_indent) {
+                // the next entry of the current block sequence.
+                if (context.state == context_state_t::BLOCK_SEQUENCE_ENTRY && !emit_empty_scalar(handler)) {
+                    return false;
+                }
+                context.state = context_state_t::BLOCK_SEQUENCE_ENTRY;
+                context.line = m_line;
+                return true;
+            }
+
+            if (context.state == context_state_t::BLOCK_MAPPING_VALUE) {
+                // a block sequence as a mapping value can be at the same indentation as the key, but cannot begin on
+                // the same line as an implicit key.
+                if FK_YAML_UNLIKELY (context.line == m_line && !context.is_explicit) {
+                    throw parse_error("invalid block sequence entry is found.", m_line, m_indent);
+                }
+            }
+            else {
+                check_node_position();
+            }
+        }
+        else {
+            check_node_position();
+        }
+
+        if (!emit_node_properties(handler) || !report(handler, event_t::START_SEQUENCE)) {
+            return false;
+        }
+        m_context_stack.emplace_back(m_line, m_indent, context_state_t::BLOCK_SEQUENCE_ENTRY);
+        return true;
+    }
+
+    /// @brief Parses an explicit mapping key prefix (`? `).
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_explicit_key(HandlerType& handler) {
+        if (m_flow_context_depth > 0) {
+            // keys in flow mappings are explicit anyway.
+            if FK_YAML_UNLIKELY (m_context_stack.back().state != context_state_t::FLOW_MAPPING_KEY) {
+                throw parse_error("An explicit key is not allowed in this context.", m_line, m_indent);
+            }
+            return true;
+        }
+
+        if (!unwind_block_contexts(handler, false) || !begin_block_mapping_entry(handler, m_line, m_indent)) {
+            return false;
+        }
+
+        parse_context& context = m_context_stack.back();
+        context.state = context_state_t::BLOCK_MAPPING_EXPLICIT_KEY;
+        context.is_explicit = true;
+        return true;
+    }
+
+    /// @brief Parses a mapping value indicator (`:`) which does not follow an implicit key on the same line.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_key_separator(HandlerType& handler) {
+        // A flow collection which may be an implicit key has already consumed a key separator following it on the same
+        // line unless the collection has got too long to be an implicit key.
+        const bool follows_flow_key = m_follows_flow_collection && m_flow_collection_end_line == m_line;
+
+        if (m_flow_context_depth > 0) {
+            parse_context& context = m_context_stack.back();
+            switch (context.state) {
+            case context_state_t::FLOW_MAPPING_KEY:
+                // an empty key like `{: bar}`
+                if (!emit_empty_scalar(handler)) {
+                    return false;
+                }
+                context.state = context_state_t::FLOW_MAPPING_VALUE;
+                return true;
+            case context_state_t::FLOW_MAPPING_SEPARATOR:
+                context.state = context_state_t::FLOW_MAPPING_VALUE;
+                return true;
+            case context_state_t::FLOW_SEQUENCE_ENTRY:
+                // a single pair mapping with an empty key like `[: bar]`
+                if (!report(handler, event_t::START_MAPPING) || !emit_empty_scalar(handler)) {
+                    return false;
+                }
+                m_context_stack.emplace_back(m_line, m_indent, context_state_t::FLOW_PAIR_VALUE);
+                return true;
+            default:
+                if FK_YAML_UNLIKELY (follows_flow_key && context.state == context_state_t::FLOW_SEQUENCE) {
+                    throw parse_error(
+                        "An implicit key must be on a single line and at most 1024 characters long.", m_line, m_indent);
+                }
+                throw parse_error("A key separator is not allowed in this context.", m_line, m_indent);
+            }
+        }
+
+        if FK_YAML_UNLIKELY (follows_flow_key) {
+            throw parse_error(
+                "An implicit key must be on a single line and at most 1024 characters long.", m_line, m_indent);
+        }
+        if (!unwind_block_contexts(handler, false)) {
+            return false;
+        }
+
+        if (!m_context_stack.empty()) {
+            parse_context& context = m_context_stack.back();
+            if (is_block_mapping(context.state) && context.indent == m_indent) {
+                switch (context.state) {
+                case context_state_t::BLOCK_MAPPING_VALUE:
+                    if FK_YAML_UNLIKELY (context.line == m_line) {
+                        throw parse_error("A key separator is not allowed in this context.", m_line, m_indent);
+                    }
+                    // the previous entry has no value.
+                    if (!emit_empty_scalar(handler)) {
+                        return false;
+                    }
+                    // an empty key like `: bar`
+                    if (!emit_empty_scalar(handler)) {
+                        return false;
+                    }
+                    break;
+                case context_state_t::BLOCK_MAPPING_KEY:
+                case context_state_t::BLOCK_MAPPING_EXPLICIT_KEY:
+                    if (!emit_empty_scalar(handler)) {
+                        return false;
+                    }
+                    break;
+                default: // context_state_t::BLOCK_MAPPING_SEPARATOR
+                    break;
+                }
+
+                context.state = context_state_t::BLOCK_MAPPING_VALUE;
+                context.line = m_line;
+                context.is_explicit = true;
+                return true;
+            }
+        }
+
+        // a new block mapping which begins with an empty key.
+        check_node_position();
+        if (!emit_node_properties(handler) || !report(handler, event_t::START_MAPPING) || !emit_empty_scalar(handler)) {
+            return false;
+        }
+        m_context_stack.emplace_back(m_line, m_indent, context_state_t::BLOCK_MAPPING_VALUE);
+        m_context_stack.back().is_explicit = true;
+        return true;
+    }
+
+    /// @brief Parses a value separator (`,`) in flow collections.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_value_separator(HandlerType& handler) {
+        if FK_YAML_UNLIKELY (m_flow_context_depth == 0) {
+            throw parse_error("invalid value separator is found.", m_line, m_indent);
+        }
+
+        if (is_flow_pair(m_context_stack.back().state) && !close_context(handler)) {
+            return false;
+        }
+
+        parse_context& context = m_context_stack.back();
+        switch (context.state) {
+        case context_state_t::FLOW_SEQUENCE_ENTRY:
+            // an empty entry is allowed only if it has node properties like `[!!null , foo]`
+            if FK_YAML_UNLIKELY (!has_node_properties()) {
+                throw parse_error("invalid value separator is found.", m_line, m_indent);
+            }
+            return emit_empty_scalar(handler);
+        case context_state_t::FLOW_SEQUENCE:
+            context.state = context_state_t::FLOW_SEQUENCE_ENTRY;
+            return true;
+        case context_state_t::FLOW_MAPPING_KEY:
+            if FK_YAML_UNLIKELY (!has_node_properties()) {
+                throw parse_error("invalid value separator is found.", m_line, m_indent);
+            }
+            if (!emit_empty_scalar(handler) || !emit_empty_scalar(handler)) {
+                return false;
+            }
+            return true;
+        case context_state_t::FLOW_MAPPING_SEPARATOR:
+        case context_state_t::FLOW_MAPPING_VALUE:
+            if (!emit_empty_scalar(handler)) {
+                return false;
+            }
+            context.state = context_state_t::FLOW_MAPPING_KEY;
+            return true;
+        case context_state_t::FLOW_MAPPING:
+            context.state = context_state_t::FLOW_MAPPING_KEY;
+            return true;
+        default:                   // LCOV_EXCL_LINE
+            detail::unreachable(); // LCOV_EXCL_LINE
+        }
+    }
+
+    /// @brief Parses the beginning of a flow collection (`[` or `{`).
+    /// @param lexer The lexical analyzer to be used.
+    /// @param handler An event handler object.
+    /// @param type The type of the token.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_flow_collection_begin(lexer_type& lexer, HandlerType& handler, lexical_token_t type) {
+        if (!unwind_block_contexts(handler, false)) {
+            return false;
+        }
+
+        if (m_flow_context_depth == 0) {
+            // The collection may be an implicit key like `[foo]: bar`. Its node properties and position are checked
+            // when the token after it is found. (see resolve_key_candidates())
+            m_key_candidates.emplace_back(m_events.size(), m_line, m_indent, 1, m_context_stack.size(), true);
+            m_key_candidates.back().props = m_props;
+            m_key_candidates.back().collection_props = m_collection_props;
+            clear_node_properties();
+        }
+        else {
+            check_node_position();
+            if (m_context_stack.back().state == context_state_t::FLOW_SEQUENCE_ENTRY) {
+                // The collection may be the key of a single pair mapping like `[[foo]: bar]`.
+                m_key_candidates.emplace_back(
+                    m_events.size(), m_line, m_indent, m_flow_context_depth + 1, m_context_stack.size(), false);
+            }
+            if (!emit_node_properties(handler)) {
+                return false;
+            }
+        }
+
+        const bool is_sequence = type == lexical_token_t::SEQUENCE_FLOW_BEGIN;
+        if (!report(handler, is_sequence ? event_t::START_SEQUENCE : event_t::START_MAPPING)) {
+            return false;
+        }
+
+        m_context_stack.emplace_back(
+            m_line,
+            m_indent,
+            is_sequence ? context_state_t::FLOW_SEQUENCE_ENTRY : context_state_t::FLOW_MAPPING_KEY);
+        if (m_flow_context_depth++ == 0) {
+            lexer.set_context_state(true);
+        }
+        return true;
+    }
+
+    /// @brief Parses the end of a flow collection (`]` or `}`).
+    /// @param lexer The lexical analyzer to be used.
+    /// @param handler An event handler object.
+    /// @param type The type of the token.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_flow_collection_end(lexer_type& lexer, HandlerType& handler, lexical_token_t type) {
+        const bool is_sequence = type == lexical_token_t::SEQUENCE_FLOW_END;
+        if FK_YAML_UNLIKELY (m_flow_context_depth == 0) {
+            throw parse_error(
+                is_sequence ? "Flow sequence ending is found outside the flow context."
+                            : "Flow mapping ending is found outside the flow context.",
+                m_line,
+                m_indent);
+        }
+
+        if (is_sequence && is_flow_pair(m_context_stack.back().state) && !close_context(handler)) {
+            return false;
+        }
+
+        const context_state_t state = m_context_stack.back().state;
+        const bool is_matched = is_sequence ? (state == context_state_t::FLOW_SEQUENCE_ENTRY ||
+                                               state == context_state_t::FLOW_SEQUENCE)
+                                            : (state == context_state_t::FLOW_MAPPING_KEY ||
+                                               state == context_state_t::FLOW_MAPPING_SEPARATOR ||
+                                               state == context_state_t::FLOW_MAPPING_VALUE ||
+                                               state == context_state_t::FLOW_MAPPING);
+        if FK_YAML_UNLIKELY (!is_matched) {
+            throw parse_error(
+                is_sequence ? "No corresponding flow sequence beginning is found."
+                            : "No corresponding flow mapping beginning is found.",
+                m_line,
+                m_indent);
+        }
+
+        // The position of a collection which may be an implicit block mapping key is checked after the token after it.
+        const bool is_block_key_candidate = !m_key_candidates.empty() &&
+                                            m_key_candidates.back().flow_depth == m_flow_context_depth &&
+                                            m_key_candidates.back().is_block_key;
+        if (!(is_block_key_candidate ? end_context(handler) : close_context(handler))) {
+            return false;
+        }
+        m_flow_collection_end_line = m_line;
+        if (--m_flow_context_depth == 0) {
+            lexer.set_context_state(false);
+        }
+        return true;
+    }
+
+    /// @brief Parses a flow scalar or an alias, which may be an implicit mapping key.
+    /// @param lexer The lexical analyzer to be used.
+    /// @param handler An event handler object.
+    /// @param token The scalar token. Will be replaced with the next token which has to be handled next.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_flow_scalar(lexer_type& lexer, HandlerType& handler, lexical_token& token) {
+        if (!unwind_block_contexts(handler, false)) {
+            return false;
+        }
+
+        const bool is_alias = token.type == lexical_token_t::ALIAS_PREFIX;
+        if (is_alias) {
+            if FK_YAML_UNLIKELY (m_props.has_tag || m_collection_props.has_tag) {
+                throw parse_error("Tag cannot be specified to an alias node", m_line, m_indent);
+            }
+            if FK_YAML_UNLIKELY (m_props.has_anchor || m_collection_props.has_anchor) {
+                throw parse_error("Anchor cannot be specified to an alias node.", m_line, m_indent);
+            }
+        }
+
+        const scalar_style style = to_scalar_style(token.type);
+        const str_view contents =
+            is_alias ? token.str : m_scalar_parser.parse_contents(m_line, m_indent, token.type, token.str, {});
+
+        // the scalar contents stays valid while the next token is scanned.
+        token = lexer.get_next_token();
+        const bool is_key_sep_followed =
+            token.type == lexical_token_t::KEY_SEPARATOR && m_line == lexer.get_lines_processed();
+
+        if (is_key_sep_followed) {
+            if (m_flow_context_depth == 0) {
+                const uint32_t key_indent = has_node_properties_on_current_line() ? m_props.indent : m_indent;
+                if (!begin_block_mapping_entry(handler, m_line, key_indent)) {
+                    return false;
+                }
+                if (!emit_scalar(handler, is_alias, contents, style)) {
+                    return false;
+                }
+                m_context_stack.back().state = context_state_t::BLOCK_MAPPING_VALUE;
+                token = lexer.get_next_token();
+                return true;
+            }
+
+            if (m_context_stack.back().state == context_state_t::FLOW_SEQUENCE_ENTRY) {
+                // a single pair mapping like `[foo: bar]`
+                if (!report(handler, event_t::START_MAPPING) || !emit_scalar(handler, is_alias, contents, style)) {
+                    return false;
+                }
+                m_context_stack.emplace_back(m_line, m_indent, context_state_t::FLOW_PAIR_VALUE);
+                token = lexer.get_next_token();
+                return true;
+            }
+
+            // Otherwise, the key separator is handled afterwards as a flow mapping key separator.
+        }
+
+        check_node_position();
+        if (!emit_scalar(handler, is_alias, contents, style)) {
+            return false;
+        }
+        complete_node();
+        return true;
+    }
+
+    /// @brief Parses a block scalar.
+    /// @param lexer The lexical analyzer to be used.
+    /// @param handler An event handler object.
+    /// @param token The block scalar token.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool parse_block_scalar(lexer_type& lexer, HandlerType& handler, const lexical_token& token) {
+        if (!unwind_block_contexts(handler, false)) {
+            return false;
+        }
+        check_node_position();
+
+        const str_view contents = m_scalar_parser.parse_contents(
+            m_line, m_indent, token.type, token.str, lexer.get_block_scalar_header());
+        if (!emit_scalar(handler, false, contents, to_scalar_style(token.type))) {
+            return false;
+        }
+        complete_node();
+        return true;
+    }
+
+    /// @brief Closes all the remaining contexts at the end of a document.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool end_document(HandlerType& handler) {
+        m_is_at_document_end = true;
+        while (!m_context_stack.empty()) {
+            if (!close_context(handler)) {
+                return false;
+            }
+        }
+        if (!m_is_root_parsed && !emit_empty_scalar(handler)) {
+            return false;
+        }
+        return handler.end_document();
+    }
+
+    /// @brief Decides whether buffered flow collections are implicit keys at the current token.
+    /// @param handler An event handler object.
+    /// @param type The type of the current token.
+    /// @param is_key The variable to store whether the current token is a key separator after an implicit key.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool resolve_key_candidates(HandlerType& handler, lexical_token_t type, bool& is_key) {
+        if (m_key_candidates.back().flow_depth > m_flow_context_depth) {
+            // The last candidate has just been closed, and is a key if followed by `:` on the same line.
+            const key_candidate candidate = m_key_candidates.back();
+            m_key_candidates.pop_back();
+            is_key = type == lexical_token_t::KEY_SEPARATOR && m_line == m_flow_collection_end_line;
+            if (!(is_key ? accept_key_candidate(handler, candidate) : reject_key_candidate(handler, candidate, true))) {
+                return false;
+            }
+        }
+
+        // The outer candidates which have got too long cannot be implicit keys any more.
+        while (!m_key_candidates.empty()) {
+            const key_candidate& front = m_key_candidates.front();
+            if (front.line == m_line && m_indent - front.indent <= max_implicit_key_length) {
+                break;
+            }
+            const key_candidate candidate = front;
+            m_key_candidates.erase(m_key_candidates.begin());
+            if (!reject_key_candidate(handler, candidate, false)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Reports a closed flow collection as an implicit key.
+    /// @param handler An event handler object.
+    /// @param candidate The flow collection which has been found to be an implicit key.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool accept_key_candidate(HandlerType& handler, key_candidate candidate) {
+        if (candidate.is_block_key) {
+            // all the nested candidates have been resolved, so the events are reported right away.
+            swap_key_candidate_state(candidate);
+            const uint32_t key_indent = has_node_properties_on_current_line() ? m_props.indent : m_indent;
+            const bool continues = begin_block_mapping_entry(handler, m_line, key_indent) &&
+                                   emit_node_properties(handler) && flush_events(handler);
+            swap_key_candidate_state(candidate);
+            m_context_stack.back().state = context_state_t::BLOCK_MAPPING_VALUE;
+            return continues;
+        }
+
+        // a single pair mapping whose key is the collection.
+        buffered_event event {};
+        event.type = event_t::START_MAPPING;
+        event.line = candidate.line;
+        event.indent = candidate.indent;
+        m_events.insert(m_events.begin() + static_cast<std::ptrdiff_t>(candidate.event_index), event);
+
+        m_context_stack.back().state = context_state_t::FLOW_SEQUENCE_ENTRY;
+        m_context_stack.emplace_back(m_line, m_indent, context_state_t::FLOW_PAIR_VALUE);
+        return flush_events(handler);
+    }
+
+    /// @brief Reports a flow collection which has been found not to be an implicit key.
+    /// @param handler An event handler object.
+    /// @param candidate The flow collection which is not an implicit key.
+    /// @param is_closed Whether the collection has been closed.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool reject_key_candidate(HandlerType& handler, key_candidate candidate, bool is_closed) {
+        if (candidate.is_block_key) {
+            swap_key_candidate_state(candidate);
+            check_node_position(candidate.num_outer_contexts);
+
+            // The node properties precede all the buffered events, so they must not be buffered after them for the
+            // nested candidates.
+            std::vector<key_candidate> nested_candidates {};
+            nested_candidates.swap(m_key_candidates);
+            const bool continues = emit_node_properties(handler);
+            m_key_candidates.swap(nested_candidates);
+
+            swap_key_candidate_state(candidate);
+            if (!continues) {
+                return false;
+            }
+            if (is_closed) {
+                complete_node();
+            }
+        }
+        return flush_events(handler);
+    }
+
+    /// @brief Swaps the current position and node properties with those of a flow collection in the block context.
+    /// @param candidate A flow collection which may be an implicit block mapping key.
+    void swap_key_candidate_state(key_candidate& candidate) noexcept {
+        std::swap(m_line, candidate.line);
+        std::swap(m_indent, candidate.indent);
+        std::swap(m_props, candidate.props);
+        std::swap(m_collection_props, candidate.collection_props);
+    }
+
+    /// @brief Prepares the current block mapping for a new entry, or begins a new block mapping.
+    /// @param handler An event handler object.
+    /// @param line The line of the new entry.
+    /// @param indent The indentation width of the new entry.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool begin_block_mapping_entry(HandlerType& handler, uint32_t line, uint32_t indent) {
+        if (!m_context_stack.empty()) {
+            parse_context& context = m_context_stack.back();
+            if (is_block_mapping(context.state) && context.indent == indent) {
+                switch (context.state) {
+                case context_state_t::BLOCK_MAPPING_EXPLICIT_KEY:
+                    // the previous entry has neither a key nor a value.
+                    if (!emit_empty_scalar(handler) || !emit_empty_scalar(handler)) {
+                        return false;
+                    }
+                    break;
+                case context_state_t::BLOCK_MAPPING_SEPARATOR:
+                case context_state_t::BLOCK_MAPPING_VALUE:
+                    // the previous entry has no value.
+                    if (!emit_empty_scalar(handler)) {
+                        return false;
+                    }
+                    break;
+                default: // context_state_t::BLOCK_MAPPING_KEY
+                    break;
+                }
+
+                context.state = context_state_t::BLOCK_MAPPING_KEY;
+                context.line = line;
+                context.is_explicit = false;
+                return true;
+            }
+
+            if FK_YAML_UNLIKELY (
+                context.state == context_state_t::BLOCK_MAPPING_VALUE && context.line == line && !context.is_explicit) {
+                throw parse_error("Multiple mapping keys are specified on the same line.", line, indent);
+            }
+        }
+
+        check_node_position();
+
+        // node properties on the previous lines belong to the new block mapping, not to the first key.
+        if (!emit_properties(handler, take_node_properties(m_props.line < line)) ||
+            !report(handler, event_t::START_MAPPING)) {
+            return false;
+        }
+        m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING_KEY);
+        return true;
+    }
+
+    /// @brief Closes block collections which end before the current token in the block context.
+    /// @param handler An event handler object.
+    /// @param is_sequence_entry Whether the current token is a block sequence entry prefix.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool unwind_block_contexts(HandlerType& handler, bool is_sequence_entry) {
+        // node properties have already triggered unwinding if they are followed by the current token.
+        if (m_flow_context_depth > 0 || has_node_properties_on_current_line()) {
+            return true;
+        }
+
+        while (!m_context_stack.empty()) {
+            const parse_context& context = m_context_stack.back();
+            const bool is_block_sequence = context.state == context_state_t::BLOCK_SEQUENCE ||
+                                           context.state == context_state_t::BLOCK_SEQUENCE_ENTRY;
+            // A block sequence at the same indentation as the current token ends unless the token is its entry:
+            // ```yaml
+            // foo:
+            // - bar
+            // baz: 123 # ends the sequence
+            // ```
+            const bool ends = context.indent > m_indent ||
+                              (is_block_sequence && !is_sequence_entry && context.indent == m_indent);
+            if (!ends) {
+                break;
+            }
+            if (!close_context(handler)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Closes the current context, reporting empty nodes for entries which lack them.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool close_context(HandlerType& handler) {
+        if (!end_context(handler)) {
+            return false;
+        }
+        complete_node();
+        return true;
+    }
+
+    /// @brief Ends the current context without updating the state of the parent context.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool end_context(HandlerType& handler) {
+        const bool has_props = has_node_properties();
+        bool is_sequence = false;
+
+        switch (m_context_stack.back().state) {
+        case context_state_t::BLOCK_MAPPING_EXPLICIT_KEY:
+            if (!emit_empty_scalar(handler) || !emit_empty_scalar(handler)) {
+                return false;
+            }
+            break;
+        case context_state_t::BLOCK_MAPPING_SEPARATOR:
+        case context_state_t::BLOCK_MAPPING_VALUE:
+        case context_state_t::FLOW_MAPPING_SEPARATOR:
+        case context_state_t::FLOW_MAPPING_VALUE:
+        case context_state_t::FLOW_PAIR_VALUE:
+            if (!emit_empty_scalar(handler)) {
+                return false;
+            }
+            break;
+        case context_state_t::FLOW_MAPPING_KEY:
+            // an entry only with node properties like `{!!null }`
+            if (has_props && (!emit_empty_scalar(handler) || !emit_empty_scalar(handler))) {
+                return false;
+            }
+            break;
+        case context_state_t::BLOCK_SEQUENCE_ENTRY:
+            is_sequence = true;
+            if (!emit_empty_scalar(handler)) {
+                return false;
+            }
+            break;
+        case context_state_t::FLOW_SEQUENCE_ENTRY:
+            // an entry only with node properties like `[!!null ]`
+            is_sequence = true;
+            if (has_props && !emit_empty_scalar(handler)) {
+                return false;
+            }
+            break;
+        case context_state_t::BLOCK_SEQUENCE:
+        case context_state_t::FLOW_SEQUENCE:
+            is_sequence = true;
+            break;
+        default: // mappings which have got values
+            break;
+        }
+
+        if (!report(handler, is_sequence ? event_t::END_SEQUENCE : event_t::END_MAPPING)) {
+            return false;
+        }
+        m_context_stack.pop_back();
+        return true;
+    }
+
+    /// @brief Updates the state of the current context after a node has been parsed in it.
+    void complete_node() noexcept {
+        if (m_context_stack.empty()) {
+            m_is_root_parsed = true;
+            return;
+        }
+
+        context_state_t& state = m_context_stack.back().state;
+        switch (state) {
+        case context_state_t::BLOCK_MAPPING_EXPLICIT_KEY:
+            state = context_state_t::BLOCK_MAPPING_SEPARATOR;
+            break;
+        case context_state_t::BLOCK_MAPPING_VALUE:
+            state = context_state_t::BLOCK_MAPPING_KEY;
+            break;
+        case context_state_t::BLOCK_SEQUENCE_ENTRY:
+            state = context_state_t::BLOCK_SEQUENCE;
+            break;
+        case context_state_t::FLOW_SEQUENCE_ENTRY:
+            state = context_state_t::FLOW_SEQUENCE;
+            break;
+        case context_state_t::FLOW_MAPPING_KEY:
+            state = context_state_t::FLOW_MAPPING_SEPARATOR;
+            break;
+        case context_state_t::FLOW_MAPPING_VALUE:
+            state = context_state_t::FLOW_MAPPING;
+            break;
+        case context_state_t::FLOW_PAIR_VALUE:
+            state = context_state_t::FLOW_PAIR;
+            break;
+        default:                   // LCOV_EXCL_LINE
+            detail::unreachable(); // LCOV_EXCL_LINE
+        }
+    }
+
+    /// @brief Checks if a node (other than an implicit block mapping key) can begin at the current position.
+    void check_node_position() const {
+        check_node_position(m_context_stack.size());
+    }
+
+    /// @brief Checks if a node (other than an implicit block mapping key) can begin at the current position in the
+    /// given number of the outermost contexts.
+    /// @param num_contexts The number of the contexts which the node is nested in.
+    void check_node_position(std::size_t num_contexts) const {
+        if (num_contexts == 0) {
+            if FK_YAML_UNLIKELY (m_is_root_parsed) {
+                throw parse_error("A document must not have more than one root node.", m_line, m_indent);
+            }
+            return;
+        }
+
+        // node properties on the same line are a part of the node.
+        const uint32_t indent = has_node_properties_on_current_line() ? m_props.indent : m_indent;
+
+        const parse_context& context = m_context_stack[num_contexts - 1];
+        switch (context.state) {
+        case context_state_t::BLOCK_MAPPING_VALUE:
+            if FK_YAML_UNLIKELY (context.line < m_line && indent <= context.indent) {
+                throw parse_error("bad indentation of a mapping entry.", m_line, m_indent);
+            }
+            break;
+        case context_state_t::BLOCK_MAPPING_EXPLICIT_KEY:
+        case context_state_t::BLOCK_SEQUENCE_ENTRY:
+            if FK_YAML_UNLIKELY (context.line < m_line && indent <= context.indent) {
+                throw parse_error("Detected invalid indentation.", m_line, m_indent);
+            }
+            break;
+        case context_state_t::FLOW_SEQUENCE_ENTRY:
+        case context_state_t::FLOW_MAPPING_KEY:
+        case context_state_t::FLOW_MAPPING_VALUE:
+        case context_state_t::FLOW_PAIR_VALUE:
+            break;
+        case context_state_t::FLOW_SEQUENCE:
+        case context_state_t::FLOW_PAIR:
+            throw parse_error("flow sequence entry is found without separated with a comma.", m_line, m_indent);
+        case context_state_t::FLOW_MAPPING_SEPARATOR:
+        case context_state_t::FLOW_MAPPING:
+            throw parse_error("Flow mapping entry is found without separated with a comma.", m_line, m_indent);
+        case context_state_t::BLOCK_MAPPING_KEY:
+        case context_state_t::BLOCK_MAPPING_SEPARATOR:
+            throw parse_error(
+                "The \":\" mapping value indicator must be followed after a mapping key.", m_line, m_indent);
+        case context_state_t::BLOCK_SEQUENCE:
+            throw parse_error("invalid block sequence entry is found.", m_line, m_indent);
+        }
+    }
+
+    /// @brief Reports node properties followed by a scalar or an alias.
+    /// @param handler An event handler object.
+    /// @param is_alias Whether the node is an alias.
+    /// @param contents The scalar contents or the anchor name referred by the alias.
+    /// @param style The scalar style.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool emit_scalar(HandlerType& handler, bool is_alias, str_view contents, scalar_style style) {
+        if (is_alias) {
+            return report(handler, event_t::ALIAS, contents);
+        }
+        return emit_node_properties(handler) && report(handler, event_t::SCALAR, contents, style);
+    }
+
+    /// @brief Reports an empty node as an empty plain scalar.
+    /// @note Node properties on the current line are left for the following node in the block context.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool emit_empty_scalar(HandlerType& handler) {
+        const bool owns_props = m_flow_context_depth > 0 || m_is_at_document_end || m_props.line < m_line;
+        if (!emit_properties(handler, take_node_properties(owns_props))) {
+            return false;
+        }
+        return report(handler, event_t::SCALAR, str_view(), scalar_style::PLAIN);
+    }
+
+    /// @brief Reports all the stored node properties if any and clears them.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool emit_node_properties(HandlerType& handler) {
+        return emit_properties(handler, take_node_properties(true));
+    }
+
+    /// @brief Reports the given node properties.
+    /// @param handler An event handler object.
+    /// @param props Node properties to be reported.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool emit_properties(HandlerType& handler, const node_properties& props) {
+        if (props.has_anchor && !report(handler, event_t::ANCHOR, props.anchor)) {
+            return false;
+        }
+        if (props.has_tag && !report(handler, event_t::TAG, props.tag)) {
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief Reports an event to the handler, or buffers it while a flow collection may be an implicit key.
+    /// @param handler An event handler object.
+    /// @param type The event type.
+    /// @param str The scalar contents, or the name of an anchor, a tag or an alias.
+    /// @param style The scalar style.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool report(
+        HandlerType& handler, event_t type, str_view str = str_view(), scalar_style style = scalar_style::PLAIN) {
+        if FK_YAML_LIKELY (m_key_candidates.empty()) {
+            return deliver(handler, type, str, style, m_line, m_indent);
+        }
+
+        buffered_event event {};
+        event.type = type;
+        event.style = style;
+        event.line = m_line;
+        event.indent = m_indent;
+        if (type == event_t::SCALAR) {
+            // scalar contents may be in the buffer of the scalar parser, which is reused for the next scalar.
+            event.contents_begin = m_event_contents.size();
+            event.contents_size = str.size();
+            if (!str.empty()) {
+                m_event_contents.append(str.data(), str.size());
+            }
+        }
+        else {
+            event.name = str;
+        }
+        m_events.push_back(event);
+        return true;
+    }
+
+    /// @brief Reports the buffered events which precede the remaining flow collections which may be implicit keys.
+    /// @param handler An event handler object.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool flush_events(HandlerType& handler) {
+        const std::size_t num_events =
+            m_key_candidates.empty() ? m_events.size() : m_key_candidates.front().event_index;
+        for (std::size_t i = 0; i < num_events; i++) {
+            const buffered_event& event = m_events[i];
+            const str_view str = (event.type == event_t::SCALAR)
+                                     ? str_view(m_event_contents.data() + event.contents_begin, event.contents_size)
+                                     : event.name;
+            if (!deliver(handler, event.type, str, event.style, event.line, event.indent)) {
+                return false;
+            }
+        }
+
+        m_events.erase(m_events.begin(), m_events.begin() + static_cast<std::ptrdiff_t>(num_events));
+        for (key_candidate& candidate : m_key_candidates) {
+            candidate.event_index -= num_events;
+        }
+        if (m_events.empty()) {
+            m_event_contents.clear();
+        }
+        return true;
+    }
+
+    /// @brief Reports an event to the handler after checking aliases against the anchors reported so far.
+    /// @param handler An event handler object.
+    /// @param type The event type.
+    /// @param str The scalar contents, or the name of an anchor, a tag or an alias.
+    /// @param style The scalar style.
+    /// @param line The line where the event has been found.
+    /// @param indent The indentation width where the event has been found.
+    /// @return true to continue parsing, false if the handler has aborted parsing.
+    template <typename HandlerType>
+    bool deliver(HandlerType& handler, event_t type, str_view str, scalar_style style, uint32_t line, uint32_t indent) {
+        switch (type) {
+        case event_t::START_MAPPING:
+        case event_t::START_SEQUENCE:
+            // an anchored collection cannot be referred to until it ends.
+            m_collection_anchors.push_back(m_next_anchor);
+            if (!m_next_anchor.empty()) {
+                m_anchors[m_next_anchor] = true;
+                m_next_anchor = str_view();
+            }
+            return (type == event_t::START_MAPPING) ? handler.start_mapping() : handler.start_sequence();
+        case event_t::END_MAPPING:
+        case event_t::END_SEQUENCE: {
+            const str_view anchor = m_collection_anchors.back();
+            m_collection_anchors.pop_back();
+            if (!anchor.empty()) {
+                m_anchors[anchor] = false;
+            }
+            return (type == event_t::END_MAPPING) ? handler.end_mapping() : handler.end_sequence();
+        }
+        case event_t::SCALAR:
+            if (!m_next_anchor.empty()) {
+                m_anchors[m_next_anchor] = false;
+                m_next_anchor = str_view();
+            }
+            return handler.scalar(str.data(), str.size(), style);
+        case event_t::ALIAS: {
+            // An alias refers to the last anchor with the same name as basic_deserializer does.
+            const auto itr = m_anchors.find(str);
+            if FK_YAML_UNLIKELY (itr == m_anchors.end()) {
+                throw parse_error("The given anchor name must appear prior to the alias node.", line, indent);
+            }
+            if FK_YAML_UNLIKELY (itr->second) {
+                const std::string name(str.begin(), str.end());
+                throw parse_error(format("Self-referential alias (*%s) is found.", name.c_str()).c_str(), line, indent);
+            }
+            return handler.alias(str.data(), str.size());
+        }
+        case event_t::ANCHOR:
+            m_next_anchor = str;
+            return handler.anchor(str.data(), str.size());
+        case event_t::TAG:
+            return handler.tag(str.data(), str.size());
+        default:                   // LCOV_EXCL_LINE
+            detail::unreachable(); // LCOV_EXCL_LINE
+        }
+    }
+
+    /// @brief Takes the stored node properties out.
+    /// @param includes_current Whether to take the properties which have not been moved to a collection.
+    /// @return The taken node properties.
+    node_properties take_node_properties(bool includes_current) {
+        node_properties props = m_collection_props;
+        m_collection_props = node_properties();
+        if (includes_current) {
+            merge_node_properties(props, m_props);
+            m_props = node_properties();
+        }
+        return props;
+    }
+
+    /// @brief Stores an anchor or a tag until the node which it belongs to is found.
+    /// @param token An anchor or tag token.
+    void set_node_property(const lexical_token& token) {
+        if (!m_props.empty() && m_props.line < m_line) {
+            // The properties on the previous lines belong to a collection whose first node has its own properties:
+            // ```yaml
+            // !!map
+            // !!str foo: bar
+            // ```
+            merge_node_properties(m_collection_props, m_props);
+            m_props = node_properties();
+        }
+
+        node_properties props {};
+        props.line = m_line;
+        props.indent = m_indent;
+        if (token.type == lexical_token_t::ANCHOR_PREFIX) {
+            props.anchor = token.str;
+            props.has_anchor = true;
+        }
+        else {
+            props.tag = token.str;
+            props.has_tag = true;
+        }
+        merge_node_properties(m_props, props);
+    }
+
+    /// @brief Merges node properties which belong to the same node.
+    /// @param dst The node properties to be merged into.
+    /// @param src The node properties to be merged from.
+    void merge_node_properties(node_properties& dst, const node_properties& src) const {
+        if (src.empty()) {
+            return;
+        }
+
+        if (src.has_anchor) {
+            if FK_YAML_UNLIKELY (dst.has_anchor) {
+                throw parse_error(
+                    "anchor name cannot be specified more than once to the same node.", m_line, m_indent);
+            }
+            dst.anchor = src.anchor;
+            dst.has_anchor = true;
+        }
+        if (src.has_tag) {
+            if FK_YAML_UNLIKELY (dst.has_tag) {
+                throw parse_error("tag name cannot be specified more than once to the same node.", m_line, m_indent);
+            }
+            dst.tag = src.tag;
+            dst.has_tag = true;
+        }
+        if (src.line < dst.line) {
+            dst.line = src.line;
+            dst.indent = src.indent;
+        }
+    }
+
+    /// @brief Clears the stored node properties.
+    void clear_node_properties() noexcept {
+        m_props = node_properties();
+        m_collection_props = node_properties();
+    }
+
+    /// @brief Checks if any node property is stored.
+    /// @return true if any node property is stored, false otherwise.
+    bool has_node_properties() const noexcept {
+        return !m_props.empty() || !m_collection_props.empty();
+    }
+
+    /// @brief Checks if node properties have been found on the current line.
+    /// @return true if node properties have been found on the current line, false otherwise.
+    bool has_node_properties_on_current_line() const noexcept {
+        return !m_props.empty() && m_props.line == m_line;
+    }
+
+    /// @brief Checks if the given state is of block mappings.
+    /// @param state A context state.
+    /// @return true if the given state is of block mappings, false otherwise.
+    static bool is_block_mapping(context_state_t state) noexcept {
+        return state == context_state_t::BLOCK_MAPPING_KEY || state == context_state_t::BLOCK_MAPPING_EXPLICIT_KEY ||
+               state == context_state_t::BLOCK_MAPPING_SEPARATOR || state == context_state_t::BLOCK_MAPPING_VALUE;
+    }
+
+    /// @brief Checks if the given state is of single pair mappings in flow sequences.
+    /// @param state A context state.
+    /// @return true if the given state is of single pair mappings, false otherwise.
+    static bool is_flow_pair(context_state_t state) noexcept {
+        return state == context_state_t::FLOW_PAIR_VALUE || state == context_state_t::FLOW_PAIR;
+    }
+
+    /// @brief Converts a scalar token type into a scalar style.
+    /// @param type A scalar token type.
+    /// @return The corresponding scalar style.
+    static scalar_style to_scalar_style(lexical_token_t type) noexcept {
+        switch (type) {
+        case lexical_token_t::SINGLE_QUOTED_SCALAR:
+            return scalar_style::SINGLE_QUOTED;
+        case lexical_token_t::DOUBLE_QUOTED_SCALAR:
+            return scalar_style::DOUBLE_QUOTED;
+        case lexical_token_t::BLOCK_LITERAL_SCALAR:
+            return scalar_style::LITERAL;
+        case lexical_token_t::BLOCK_FOLDED_SCALAR:
+            return scalar_style::FOLDED;
+        default:
+            return scalar_style::PLAIN;
+        }
+    }
+
+private:
+    /// The stack of parse contexts. Its size only depends on the nesting depth of collections.
+    std::vector<parse_context> m_context_stack {};
+    /// The parser for scalar contents, whose buffer is reused for all the scalars.
+    scalar_parser_type m_scalar_parser {0, 0};
+    /// The line of the current token.
+    uint32_t m_line {0};
+    /// The indentation width of the current token.
+    uint32_t m_indent {0};
+    /// The current depth of flow contexts.
+    uint32_t m_flow_context_depth {0};
+    /// The line where the last flow collection has been closed.
+    uint32_t m_flow_collection_end_line {0};
+    /// The node properties waiting for the next node.
+    node_properties m_props {};
+    /// The node properties on the previous lines of m_props, which belong to a collection beginning with m_props.
+    node_properties m_collection_props {};
+    /// Whether the root node of the current document has been parsed.
+    bool m_is_root_parsed {false};
+    /// Whether the end of the current document has been reached.
+    bool m_is_at_document_end {false};
+    /// Whether the last token has closed a flow collection.
+    bool m_follows_flow_collection {false};
+    /// The flow collections which may be implicit keys, from the outermost one.
+    std::vector<key_candidate> m_key_candidates {};
+    /// The events buffered while any flow collection may be an implicit key.
+    std::vector<buffered_event> m_events {};
+    /// The contents of the buffered scalar events.
+    std::string m_event_contents {};
+    /// The anchors reported in the current document, each of which is mapped to whether its node is under construction.
+    std::map<str_view, bool> m_anchors {};
+    /// The anchors of the collections which are under construction, where an empty name means no anchor.
+    std::vector<str_view> m_collection_anchors {};
+    /// The anchor reported for the next node.
+    str_view m_next_anchor {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_EVENT_PARSER_HPP */
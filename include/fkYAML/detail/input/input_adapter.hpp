@@ -9,6 +9,7 @@
 #ifndef FK_YAML_DETAIL_INPUT_INPUT_ADAPTER_HPP
 #define FK_YAML_DETAIL_INPUT_INPUT_ADAPTER_HPP
 
+#include <algorithm>
 #include <array>
 #include <cstdio>
 #include <cstring>
@@ -22,10 +23,12 @@
 #include <fkYAML/detail/encodings/utf_encode_detector.hpp>
 #include <fkYAML/detail/encodings/utf_encode_t.hpp>
 #include <fkYAML/detail/encodings/utf_encodings.hpp>
+#include <fkYAML/detail/encodings/utf8_validator.hpp>
 #include <fkYAML/detail/meta/input_adapter_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/exception.hpp>
+#include <fkYAML/mapped_file.hpp>
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
@@ -36,15 +39,29 @@ FK_YAML_DETAIL_NAMESPACE_BEGIN
 template <typename IterType, typename = void>
 class iterator_input_adapter;
 
-template <typename IterType>
-uint8_t read_utf8_byte_or_throw(IterType& current, IterType end, std::initializer_list<uint8_t> bytes_read) {
-    if FK_YAML_UNLIKELY (current == end) {
-        throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", bytes_read);
+/// @brief Appends UTF-8 encoded bytes to a buffer, dropping CRs (0x0D) in them.
+/// @param buffer The destination buffer.
+/// @param begin The beginning of the bytes.
+/// @param end The end of the bytes.
+inline void append_without_crs(std::string& buffer, const char* begin, const char* end) {
+    const char* current = begin;
+    const void* p_cr = nullptr;
+    while ((p_cr = std::memchr(current, '\r', static_cast<std::size_t>(end - current))) != nullptr) {
+        const char* p_cr_char = static_cast<const char*>(p_cr);
+        buffer.append(current, p_cr_char);
+        current = p_cr_char + 1;
     }
+    buffer.append(current, end);
+}
 
-    const auto byte = static_cast<uint8_t>(*current);
-    ++current;
-    return byte;
+/// @brief Validates UTF-8 encoded bytes in a buffer and drops CRs (0x0D) in them in place.
+/// @param buffer The buffer to be normalized.
+inline void normalize_utf8_buffer(std::string& buffer) {
+    const char* p_begin = buffer.data();
+    const std::size_t num_crs = utf8::validate_and_count_crs(p_begin, p_begin + buffer.size());
+    if FK_YAML_UNLIKELY (num_crs > 0) {
+        buffer.erase(std::remove(buffer.begin(), buffer.end(), '\r'), buffer.end());
+    }
 }
 
 /// @brief An input adapter for iterators of type char.
@@ -77,6 +94,7 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        m_views_input = false;
         if FK_YAML_UNLIKELY (m_begin == m_end) {
             return {};
         }
@@ -97,63 +115,56 @@ public:
         }
     }
 
+    /// @brief Check if the last view returned by get_buffer_view() refers to the input itself rather than a buffer
+    /// owned by this adapter, i.e., whether the view stays valid as long as the input does.
+    /// @return true if the view refers to the input itself, false otherwise.
+    bool views_input() const noexcept {
+        return m_views_input;
+    }
+
+    /// @brief Exchange the owned buffer with another string object.
+    /// @note
+    /// This lets a caller which parses many inputs hand a buffer with enough capacity over to this adapter and take it
+    /// back afterwards, so that normalizing the next input needs no allocation. The contents are cleared before use.
+    /// @param buffer A string object to be exchanged with the owned buffer.
+    void swap_buffer(std::string& buffer) noexcept {
+        m_buffer.swap(buffer);
+    }
+
 private:
     /// @brief The concrete implementation of get_buffer_view() for UTF-8 encoded inputs.
     /// @return View into the UTF-8 encoded input buffer contents.
     str_view get_buffer_view_utf8() {
         FK_YAML_ASSERT(m_encode_type == utf_encode_t::UTF_8);
 
+        if FK_YAML_LIKELY (m_is_contiguous) {
+            FK_YAML_ASSERT(m_begin != m_end);
+            const char* p_begin = &*m_begin;
+            const auto size = static_cast<std::size_t>(std::distance(m_begin, m_end));
+            const std::size_t num_crs = utf8::validate_and_count_crs(p_begin, p_begin + size);
+            if FK_YAML_LIKELY (num_crs == 0) {
+                // The input iterators (begin, end) can be used as-is during parsing.
+                m_views_input = true;
+                return str_view {p_begin, size};
+            }
+
+            m_buffer.reserve(size - num_crs);
+            append_without_crs(m_buffer, p_begin, p_begin + size);
+            return m_buffer;
+        }
+
         IterType current = m_begin;
         std::deque<IterType> cr_itrs {};
         while (current != m_end) {
-            const IterType char_itr = current;
-            const auto first = static_cast<uint8_t>(*current);
-            ++current;
-            const uint32_t num_bytes = utf8::get_num_bytes(first);
-
-            switch (num_bytes) {
-            case 1:
-                if FK_YAML_UNLIKELY (first == 0x0D /*CR*/) {
-                    cr_itrs.emplace_back(char_itr);
-                }
-                break;
-            case 2: {
-                const auto second = read_utf8_byte_or_throw(current, m_end, {first});
-                const bool is_valid = utf8::validate(first, second);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second});
-                }
-                break;
-            }
-            case 3: {
-                const auto second = read_utf8_byte_or_throw(current, m_end, {first});
-                const auto third = read_utf8_byte_or_throw(current, m_end, {first, second});
-                const bool is_valid = utf8::validate(first, second, third);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third});
-                }
-                break;
-            }
-            case 4: {
-                const auto second = read_utf8_byte_or_throw(current, m_end, {first});
-                const auto third = read_utf8_byte_or_throw(current, m_end, {first, second});
-                const auto fourth = read_utf8_byte_or_throw(current, m_end, {first, second, third});
-                const bool is_valid = utf8::validate(first, second, third, fourth);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third, fourth});
+            const auto byte = static_cast<uint8_t>(*current);
+            if FK_YAML_LIKELY (byte < 0x80u) {
+                if FK_YAML_UNLIKELY (byte == 0x0Du /*CR*/) {
+                    cr_itrs.emplace_back(current);
                 }
-                break;
-            }
-            default:           // LCOV_EXCL_LINE
-                unreachable(); // LCOV_EXCL_LINE
+                ++current;
+                continue;
             }
-        }
-
-        const bool is_contiguous_no_cr = cr_itrs.empty() && m_is_contiguous;
-        if FK_YAML_LIKELY (is_contiguous_no_cr) {
-            // The input iterators (begin, end) can be used as-is during parsing.
-            FK_YAML_ASSERT(m_begin != m_end);
-            return str_view {&*m_begin, static_cast<std::size_t>(std::distance(m_begin, m_end))};
+            utf8::validate_char(current, m_end);
         }
 
         m_buffer.reserve(std::distance(m_begin, m_end) - cr_itrs.size());
@@ -303,6 +314,8 @@ private:
     std::string m_buffer;
     /// Whether ItrType is a contiguous iterator.
     bool m_is_contiguous {false};
+    /// Whether the last buffer view refers to the input itself.
+    bool m_views_input {false};
 };
 
 #if FK_YAML_HAS_CHAR8_T
@@ -344,64 +357,38 @@ public:
             return {};
         }
 
-        IterType current = m_begin;
-        std::deque<IterType> cr_itrs {};
-        while (current != m_end) {
-            const IterType char_itr = current;
-            const auto first = static_cast<uint8_t>(*current);
-            ++current;
-            const uint32_t num_bytes = utf8::get_num_bytes(first);
+        m_buffer.clear();
 
-            switch (num_bytes) {
-            case 1:
-                if FK_YAML_UNLIKELY (first == 0x0D /*CR*/) {
-                    cr_itrs.emplace_back(char_itr);
-                }
-                break;
-            case 2: {
-                const auto second = read_utf8_byte_or_throw(current, m_end, {first});
-                const bool is_valid = utf8::validate(first, second);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second});
-                }
-                break;
-            }
-            case 3: {
-                const auto second = read_utf8_byte_or_throw(current, m_end, {first});
-                const auto third = read_utf8_byte_or_throw(current, m_end, {first, second});
-                const bool is_valid = utf8::validate(first, second, third);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third});
-                }
-                break;
-            }
-            case 4: {
-                const auto second = read_utf8_byte_or_throw(current, m_end, {first});
-                const auto third = read_utf8_byte_or_throw(current, m_end, {first, second});
-                const auto fourth = read_utf8_byte_or_throw(current, m_end, {first, second, third});
-                const bool is_valid = utf8::validate(first, second, third, fourth);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third, fourth});
-                }
-                break;
+        if FK_YAML_LIKELY (m_is_contiguous) {
+            // char8_t objects can be read through char pointers.
+            const auto* p_begin = reinterpret_cast<const char*>(&*m_begin);
+            const auto size = static_cast<std::size_t>(std::distance(m_begin, m_end));
+            const std::size_t num_crs = utf8::validate_and_count_crs(p_begin, p_begin + size);
+            if FK_YAML_LIKELY (num_crs == 0) {
+                return str_view {p_begin, size};
             }
-            default:           // LCOV_EXCL_LINE
-                unreachable(); // LCOV_EXCL_LINE
-            }
-        }
 
-        m_buffer.reserve(std::distance(m_begin, m_end) - cr_itrs.size());
-        current = m_begin;
-        for (const auto& cr_itr : cr_itrs) {
-            std::transform(
-                current, cr_itr, std::back_inserter(m_buffer), [](char8_t c) { return static_cast<char>(c); });
-            current = std::next(cr_itr);
+            m_buffer.reserve(size - num_crs);
+            append_without_crs(m_buffer, p_begin, p_begin + size);
+            return m_buffer;
         }
-        std::transform(current, m_end, std::back_inserter(m_buffer), [](char8_t c) { return static_cast<char>(c); });
+
+        m_buffer.reserve(std::distance(m_begin, m_end));
+        std::transform(m_begin, m_end, std::back_inserter(m_buffer), [](char8_t c) { return static_cast<char>(c); });
+        normalize_utf8_buffer(m_buffer);
 
         return m_buffer;
     }
 
+    /// @brief Exchange the owned buffer with another string object.
+    /// @note
+    /// This lets a caller which parses many inputs hand a buffer with enough capacity over to this adapter and take it
+    /// back afterwards, so that normalizing the next input needs no allocation. The contents are cleared before use.
+    /// @param buffer A string object to be exchanged with the owned buffer.
+    void swap_buffer(std::string& buffer) noexcept {
+        m_buffer.swap(buffer);
+    }
+
 private:
     /// The iterator at the beginning of input.
     IterType m_begin {};
@@ -452,6 +439,8 @@ public:
             return {};
         }
 
+        m_buffer.clear();
+
         const int shift_bits = (m_encode_type == utf_encode_t::UTF_16BE) ? 0 : 8;
 
         std::array<char16_t, 2> encoded_buffer {{0, 0}};
@@ -505,6 +494,15 @@ public:
         return m_buffer;
     }
 
+    /// @brief Exchange the owned buffer with another string object.
+    /// @note
+    /// This lets a caller which parses many inputs hand a buffer with enough capacity over to this adapter and take it
+    /// back afterwards, so that normalizing the next input needs no allocation. The contents are cleared before use.
+    /// @param buffer A string object to be exchanged with the owned buffer.
+    void swap_buffer(std::string& buffer) noexcept {
+        m_buffer.swap(buffer);
+    }
+
 private:
     /// The iterator at the beginning of input.
     IterType m_begin {};
@@ -553,6 +551,8 @@ public:
             return {};
         }
 
+        m_buffer.clear();
+
         int shift_bits[4] {0, 0, 0, 0};
         if (m_encode_type == utf_encode_t::UTF_32LE) {
             shift_bits[0] = 24;
@@ -585,6 +585,15 @@ public:
         return m_buffer;
     }
 
+    /// @brief Exchange the owned buffer with another string object.
+    /// @note
+    /// This lets a caller which parses many inputs hand a buffer with enough capacity over to this adapter and take it
+    /// back afterwards, so that normalizing the next input needs no allocation. The contents are cleared before use.
+    /// @param buffer A string object to be exchanged with the owned buffer.
+    void swap_buffer(std::string& buffer) noexcept {
+        m_buffer.swap(buffer);
+    }
+
 private:
     /// The iterator at the beginning of input.
     IterType m_begin {};
@@ -625,6 +634,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        m_buffer.clear();
+
         switch (m_encode_type) {
         case utf_encode_t::UTF_8:
             return get_buffer_view_utf8();
@@ -639,78 +650,34 @@ public:
         }
     }
 
+    /// @brief Exchange the owned buffer with another string object.
+    /// @note
+    /// This lets a caller which parses many inputs hand a buffer with enough capacity over to this adapter and take it
+    /// back afterwards, so that normalizing the next input needs no allocation. The contents are cleared before use.
+    /// @param buffer A string object to be exchanged with the owned buffer.
+    void swap_buffer(std::string& buffer) noexcept {
+        m_buffer.swap(buffer);
+    }
+
 private:
     /// @brief The concrete implementation of get_buffer_view() for UTF-8 encoded inputs.
     /// @return View into the UTF-8 encoded input buffer contents.
     str_view get_buffer_view_utf8() {
         FK_YAML_ASSERT(m_encode_type == utf_encode_t::UTF_8);
 
-        m_buffer.clear();
         char tmp_buf[256] {};
         constexpr std::size_t buf_size = sizeof(tmp_buf) / sizeof(tmp_buf[0]);
         std::size_t read_size = 0;
         while ((read_size = std::fread(&tmp_buf[0], sizeof(char), buf_size, m_file)) > 0) {
-            char* p_current = &tmp_buf[0];
-            char* p_end = p_current + read_size;
-
-            // copy tmp_buf to m_buffer, dropping CRs.
-            char* p_cr = p_current;
-            do {
-                if FK_YAML_UNLIKELY (*p_cr == '\r') {
-                    m_buffer.append(p_current, p_cr);
-                    p_current = p_cr + 1;
-                }
-                ++p_cr;
-            } while (p_cr != p_end);
-
-            m_buffer.append(p_current, p_end);
+            m_buffer.append(&tmp_buf[0], read_size);
         }
 
         if FK_YAML_UNLIKELY (m_buffer.empty()) {
             return {};
         }
 
-        auto current = m_buffer.begin();
-        auto end = m_buffer.end();
-        while (current != end) {
-            const auto first = static_cast<uint8_t>(*current);
-            ++current;
-            const uint32_t num_bytes = utf8::get_num_bytes(first);
-
-            switch (num_bytes) {
-            case 1:
-                break;
-            case 2: {
-                const auto second = read_utf8_byte_or_throw(current, end, {first});
-                const bool is_valid = utf8::validate(first, second);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second});
-                }
-                break;
-            }
-            case 3: {
-                const auto second = read_utf8_byte_or_throw(current, end, {first});
-                const auto third = read_utf8_byte_or_throw(current, end, {first, second});
-                const bool is_valid = utf8::validate(first, second, third);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third});
-                }
-                break;
-            }
-            case 4: {
-                const auto second = read_utf8_byte_or_throw(current, end, {first});
-                const auto third = read_utf8_byte_or_throw(current, end, {first, second});
-                const auto fourth = read_utf8_byte_or_throw(current, end, {first, second, third});
-                const bool is_valid = utf8::validate(first, second, third, fourth);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third, fourth});
-                }
-                break;
-            }
-            default:           // LCOV_EXCL_LINE
-                unreachable(); // LCOV_EXCL_LINE
-            }
-        }
+        // validate the contents and drop CRs in a single scan.
+        normalize_utf8_buffer(m_buffer);
 
         return m_buffer;
     }
@@ -858,6 +825,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        m_buffer.clear();
+
         switch (m_encode_type) {
         case utf_encode_t::UTF_8:
             return get_buffer_view_utf8();
@@ -872,13 +841,21 @@ public:
         }
     }
 
+    /// @brief Exchange the owned buffer with another string object.
+    /// @note
+    /// This lets a caller which parses many inputs hand a buffer with enough capacity over to this adapter and take it
+    /// back afterwards, so that normalizing the next input needs no allocation. The contents are cleared before use.
+    /// @param buffer A string object to be exchanged with the owned buffer.
+    void swap_buffer(std::string& buffer) noexcept {
+        m_buffer.swap(buffer);
+    }
+
 private:
     /// @brief The concrete implementation of get_buffer_view() for UTF-8 encoded inputs.
     /// @return View into the UTF-8 encoded input buffer contents.
     str_view get_buffer_view_utf8() {
         FK_YAML_ASSERT(m_encode_type == utf_encode_t::UTF_8);
 
-        m_buffer.clear();
         char tmp_buf[256] {};
         do {
             m_istream->read(&tmp_buf[0], 256);
@@ -887,67 +864,15 @@ private:
                 break;
             }
 
-            char* p_current = &tmp_buf[0];
-            char* p_end = p_current + read_size;
-
-            // copy tmp_buf to m_buffer, dropping CRs.
-            char* p_cr = p_current;
-            do {
-                if FK_YAML_UNLIKELY (*p_cr == '\r') {
-                    m_buffer.append(p_current, p_cr);
-                    p_current = p_cr + 1;
-                }
-                ++p_cr;
-            } while (p_cr != p_end);
-
-            m_buffer.append(p_current, p_end);
+            m_buffer.append(&tmp_buf[0], read_size);
         } while (!m_istream->eof());
 
         if FK_YAML_UNLIKELY (m_buffer.empty()) {
             return {};
         }
 
-        auto current = m_buffer.begin();
-        auto end = m_buffer.end();
-        while (current != end) {
-            const auto first = static_cast<uint8_t>(*current);
-            ++current;
-            const uint32_t num_bytes = utf8::get_num_bytes(first);
-
-            switch (num_bytes) {
-            case 1:
-                break;
-            case 2: {
-                const auto second = read_utf8_byte_or_throw(current, end, {first});
-                const bool is_valid = utf8::validate(first, second);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second});
-                }
-                break;
-            }
-            case 3: {
-                const auto second = read_utf8_byte_or_throw(current, end, {first});
-                const auto third = read_utf8_byte_or_throw(current, end, {first, second});
-                const bool is_valid = utf8::validate(first, second, third);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third});
-                }
-                break;
-            }
-            case 4: {
-                const auto second = read_utf8_byte_or_throw(current, end, {first});
-                const auto third = read_utf8_byte_or_throw(current, end, {first, second});
-                const auto fourth = read_utf8_byte_or_throw(current, end, {first, second, third});
-                const bool is_valid = utf8::validate(first, second, third, fourth);
-                if FK_YAML_UNLIKELY (!is_valid) {
-                    throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first, second, third, fourth});
-                }
-                break;
-            }
-            default:           // LCOV_EXCL_LINE
-                unreachable(); // LCOV_EXCL_LINE
-            }
-        }
+        // validate the contents and drop CRs in a single scan.
+        normalize_utf8_buffer(m_buffer);
 
         return m_buffer;
     }
@@ -1106,7 +1031,7 @@ inline iterator_input_adapter<ItrType> input_adapter(ItrType begin, ItrType end)
         using char_ptr_t = remove_cvref_t<typename std::iterator_traits<ItrType>::pointer>;
         char_ptr_t p_begin = &*begin;
         char_ptr_t p_second_last = &*std::next(begin, size - 1);
-        is_contiguous = (p_second_last - p_begin == size);
+        is_contiguous = (p_second_last - p_begin == size - 1);
     }
     return create_iterator_input_adapter(begin, end, is_contiguous);
 }
@@ -1173,6 +1098,14 @@ inline file_input_adapter input_adapter(std::FILE* file) {
     return file_input_adapter(file, encode_type);
 }
 
+/// @brief A factory method for iterator_input_adapter objects with memory-mapped files.
+/// @note The file contents are lexed in place unless they need to be decoded or normalized.
+/// @param file A memory-mapped file. It must outlive the resulting input adapter object.
+/// @return iterator_input_adapter<const char*> An iterator_input_adapter object for the file contents.
+inline iterator_input_adapter<const char*> input_adapter(const fkyaml::mapped_file& file) {
+    return create_iterator_input_adapter(file.data(), file.data() + file.size(), true);
+}
+
 /// @brief A factory method for stream_input_adapter objects with std::istream objects.
 /// @param stream An input stream.
 /// @return stream_input_adapter A stream_input_adapter object.
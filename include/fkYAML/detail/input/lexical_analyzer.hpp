@@ -11,15 +11,16 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <deque>
 
 #include <fkYAML/detail/macros/define_macros.hpp>
 #include <fkYAML/detail/assert.hpp>
 #include <fkYAML/detail/char_class.hpp>
 #include <fkYAML/detail/encodings/uri_encoding.hpp>
-#include <fkYAML/detail/encodings/utf_encodings.hpp>
 #include <fkYAML/detail/input/block_scalar_header.hpp>
 #include <fkYAML/detail/input/position_tracker.hpp>
+#include <fkYAML/detail/input/structural_scanner.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/detail/types/lexical_token_t.hpp>
@@ -56,8 +57,7 @@ struct lexical_token {
 class lexical_analyzer {
     struct token_info {
         lexical_token token;
-        uint32_t begin_pos {0};
-        uint32_t begin_line {0};
+        const char* p_begin {nullptr};
     };
 
     // whether the current context is flow(1) or block(0)
@@ -66,15 +66,36 @@ class lexical_analyzer {
     static constexpr uint32_t document_directive_bit = 1u << 1u;
 
 public:
+    /// @brief Construct a new lexical_analyzer object without any input buffer.
+    /// @note reset() must be called with an input buffer before getting tokens.
+    lexical_analyzer() = default;
+
     /// @brief Construct a new lexical_analyzer object.
     /// @param input_buffer An input buffer.
     explicit lexical_analyzer(str_view input_buffer) noexcept
         : m_begin_itr(input_buffer.begin()),
           m_cur_itr(input_buffer.begin()),
-          m_end_itr(input_buffer.end()) {
+          m_end_itr(input_buffer.end()),
+          m_last_token_begin_itr(input_buffer.begin()) {
         m_pos_tracker.set_target_buffer(input_buffer);
     }
 
+    /// @brief Restart lexical analysis from the beginning of another input buffer.
+    /// @note All the states for the last input are discarded, but the storage for pending tokens is kept for reuse.
+    /// @param input_buffer An input buffer.
+    void reset(str_view input_buffer) noexcept {
+        m_begin_itr = m_cur_itr = m_last_token_begin_itr = input_buffer.begin();
+        m_token_begin_itr = nullptr;
+        m_end_itr = input_buffer.end();
+        m_pos_tracker.set_target_buffer(input_buffer);
+        m_yaml_version = {};
+        m_tag_handle = {};
+        m_tag_prefix = {};
+        m_block_scalar_header = {};
+        m_state = 0;
+        m_pending_token_queue.clear();
+    }
+
     /// @brief Get the next lexical token by scanning the left of the input buffer.
     /// @return lexical_token The next lexical token.
     lexical_token get_next_token() {
@@ -87,8 +108,7 @@ public:
             info = process_token();
         }
 
-        m_last_token_begin_pos = info.begin_pos;
-        m_last_token_begin_line = info.begin_line;
+        m_last_token_begin_itr = info.p_begin;
         return info.token;
     }
 
@@ -106,13 +126,15 @@ public:
     /// @brief Get the beginning position of a last token.
     /// @return uint32_t The beginning position of a last token.
     uint32_t get_last_token_begin_pos() const noexcept {
-        return m_last_token_begin_pos;
+        m_pos_tracker.update_position(m_last_token_begin_itr);
+        return m_pos_tracker.get_cur_pos_in_line();
     }
 
     /// @brief Get the number of lines already processed.
     /// @return uint32_t The number of lines already processed.
     uint32_t get_lines_processed() const noexcept {
-        return m_last_token_begin_line;
+        m_pos_tracker.update_position(m_last_token_begin_itr);
+        return m_pos_tracker.get_lines_read();
     }
 
     /// @brief Get the YAML version specification.
@@ -162,10 +184,8 @@ private:
         skip_white_spaces_and_newline_codes();
 
         m_token_begin_itr = m_cur_itr;
-        m_pos_tracker.update_position(m_cur_itr);
         token_info info {};
-        info.begin_pos = m_pos_tracker.get_cur_pos_in_line();
-        info.begin_line = m_pos_tracker.get_lines_read();
+        info.p_begin = m_cur_itr;
 
         if (m_cur_itr == m_end_itr) {
             info.token.type = lexical_token_t::END_OF_BUFFER;
@@ -279,7 +299,7 @@ private:
                 break;
             }
 
-            if (m_pos_tracker.get_cur_pos_in_line() == 0) {
+            if (is_at_line_begin()) {
                 if ((m_end_itr - m_cur_itr) > 2) {
                     const bool is_dir_end = std::equal(m_token_begin_itr, m_cur_itr + 3, "---");
                     if (is_dir_end) {
@@ -321,7 +341,7 @@ private:
             info.token = {lexical_token_t::SINGLE_QUOTED_SCALAR, determine_single_quoted_scalar_range()};
             return info;
         case '.': {
-            if (m_pos_tracker.get_cur_pos_in_line() == 0) {
+            if (is_at_line_begin()) {
                 const auto rem_size = m_end_itr - m_cur_itr;
                 if FK_YAML_LIKELY (rem_size > 2) {
                     const bool is_doc_end = std::equal(m_cur_itr, m_cur_itr + 3, "...");
@@ -919,9 +939,7 @@ private:
     str_view determine_plain_scalar_range() {
         const str_view sv {m_token_begin_itr, m_end_itr};
 
-        // flow indicators are checked only within a flow context.
-        const str_view filter = (m_state & flow_context_bit) ? "\t\n :{}[]," : "\t\n :";
-        std::size_t pos = sv.find_first_of(filter);
+        std::size_t pos = find_plain_scalar_delimiter(sv, 0);
         if FK_YAML_UNLIKELY (pos == str_view::npos) {
             check_scalar_content(sv);
             m_cur_itr = m_end_itr;
@@ -938,8 +956,9 @@ private:
                     indent = get_current_indent_level(&sv[pos]);
                 }
 
-                constexpr str_view space_filter {" \t\n"};
-                const std::size_t non_space_pos = sv.find_first_not_of(space_filter, pos);
+                const char* p_non_space = find_first_in<non_white_spaces_or_newlines>(&sv[pos], sv.end());
+                const std::size_t non_space_pos =
+                    (p_non_space == sv.end()) ? str_view::npos : static_cast<std::size_t>(p_non_space - sv.begin());
                 const std::size_t last_newline_pos = sv.find_last_of('\n', non_space_pos);
                 FK_YAML_ASSERT(last_newline_pos != str_view::npos);
 
@@ -1024,7 +1043,7 @@ private:
                 break;
             }
 
-            pos = sv.find_first_of(filter, pos + 1);
+            pos = find_plain_scalar_delimiter(sv, pos + 1);
         } while (pos != str_view::npos);
 
         str_view plain_scalar = sv.substr(0, pos);
@@ -1033,6 +1052,19 @@ private:
         return plain_scalar;
     }
 
+    /// @brief Finds the first character which may end a plain scalar.
+    /// @note Flow indicators are taken into account only within a flow context.
+    /// @param sv The remaining input buffer contents from the beginning of a plain scalar.
+    /// @param pos The position from which to search.
+    /// @return The position of the found character, or str_view::npos if not found.
+    std::size_t find_plain_scalar_delimiter(const str_view& sv, std::size_t pos) const noexcept {
+        const char* p_first = sv.begin() + pos;
+        const char* p_found = (m_state & flow_context_bit)
+                                  ? find_first_in<flow_plain_scalar_delimiters>(p_first, sv.end())
+                                  : find_first_in<block_plain_scalar_delimiters>(p_first, sv.end());
+        return (p_found == sv.end()) ? str_view::npos : static_cast<std::size_t>(p_found - sv.begin());
+    }
+
     /// @brief Scan a block style string token either in the literal or folded style.
     /// @param base_indent The base indent level of the block scalar.
     /// @param indicated_indent The indicated indent level in the block scalar header. 0 means it's not indicated.
@@ -1100,7 +1132,8 @@ private:
             emit_error("The first non-empty line in the block scalar is less indented.");
         }
 
-        std::size_t last_newline_pos = sv.find('\n', cur_itr - m_token_begin_itr + 1);
+        // cur_itr points to the character next to the first non-space one, which may already be a newline.
+        std::size_t last_newline_pos = sv.find('\n', cur_itr - m_token_begin_itr);
         if (last_newline_pos == str_view::npos) {
             last_newline_pos = remain_input_len;
         }
@@ -1155,14 +1188,9 @@ private:
         const char* p_current = scalar.begin();
         const char* p_end = scalar.end();
 
-        while (p_current != p_end) {
-            const uint32_t num_bytes = utf8::get_num_bytes(static_cast<uint8_t>(*p_current));
-            if (num_bytes > 1) {
-                // Multibyte characters are already checked in the input_adapter module.
-                p_current += num_bytes;
-                continue;
-            }
-
+        // Multibyte characters are already checked in the input_adapter module and never contain bytes in the C0
+        // control block, so only C0 control characters need to be examined here.
+        while ((p_current = find_first_in<c0_control_chars>(p_current, p_end)) != p_end) {
             switch (*p_current++) {
             // 0x00(NULL) has already been handled above.
             case 0x01:
@@ -1289,39 +1317,27 @@ private:
         return header;
     }
 
+    /// @brief Check if the current token begins at the beginning of a line.
+    /// @return true if the current token begins at the beginning of a line, false otherwise.
+    bool is_at_line_begin() const noexcept {
+        return m_token_begin_itr == m_begin_itr || *(m_token_begin_itr - 1) == '\n';
+    }
+
     /// @brief Skip white spaces (half-width spaces and tabs) from the current position.
     void skip_white_spaces() {
-        m_cur_itr = std::find_if_not(m_cur_itr, m_end_itr, [](char c) { return (c == ' ' || c == '\t'); });
+        m_cur_itr = find_first_in<non_white_spaces>(m_cur_itr, m_end_itr);
     }
 
     /// @brief Skip white spaces and newline codes (CR/LF) from the current position.
     void skip_white_spaces_and_newline_codes() {
-        if (m_cur_itr != m_end_itr) {
-            m_cur_itr = std::find_if_not(m_cur_itr, m_end_itr, [](char c) {
-                switch (c) {
-                case ' ':
-                case '\t':
-                case '\n':
-                    return true;
-                default:
-                    return false;
-                }
-            });
-        }
+        m_cur_itr = find_first_in<non_white_spaces_or_newlines>(m_cur_itr, m_end_itr);
     }
 
     /// @brief Skip the rest in the current line.
     void skip_until_line_end() {
-        while (m_cur_itr != m_end_itr) {
-            switch (*m_cur_itr) {
-            case '\n':
-                ++m_cur_itr;
-                return;
-            default:
-                ++m_cur_itr;
-                break;
-            }
-        }
+        const auto* p_newline =
+            static_cast<const char*>(std::memchr(m_cur_itr, '\n', static_cast<std::size_t>(m_end_itr - m_cur_itr)));
+        m_cur_itr = (p_newline != nullptr) ? p_newline + 1 : m_end_itr;
     }
 
     /// @brief Emits an error with the given message.
@@ -1350,10 +1366,8 @@ private:
     str_view m_tag_prefix;
     /// The last block scalar header.
     block_scalar_header m_block_scalar_header {};
-    /// The beginning position of the last lexical token. (zero origin)
-    uint32_t m_last_token_begin_pos {0};
-    /// The beginning line of the last lexical token. (zero origin)
-    uint32_t m_last_token_begin_line {0};
+    /// The iterator to the beginning of the last lexical token.
+    const char* m_last_token_begin_itr {};
     /// The current depth of flow context.
     uint32_t m_state {0};
     /// The queue of pending tokens.
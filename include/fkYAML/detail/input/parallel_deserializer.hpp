@@ -0,0 +1,219 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_PARALLEL_DESERIALIZER_HPP
+#define FK_YAML_DETAIL_INPUT_PARALLEL_DESERIALIZER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/document_splitter.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/meta/input_adapter_traits.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/deserialization_limits.hpp>
+#include <fkYAML/exception.hpp>
+#include <fkYAML/node_arena.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A class which deserializes multiple YAML documents concurrently on worker threads.
+/// @note
+/// The input buffer is split into chunks of whole documents at document markers without parsing contents (see
+/// split_into_documents()), and each chunk is deserialized by its own basic_deserializer object. The resulting
+/// documents are returned in the order of the input. Each chunk but the last one is deserialized together with the
+/// directives end marker (`---`) which follows it, so that a chunk which ends in the middle of a node, e.g., in an
+/// unclosed flow collection, fails as it does in the whole input. If any chunk fails to be deserialized with an
+/// fkyaml::exception, the whole input is deserialized again in the calling thread so that errors are reported exactly
+/// as deserialize_docs() does, e.g., with line numbers counted from the beginning of the whole input. Any other
+/// exception (e.g., std::bad_alloc) is rethrown in the calling thread as it is.
+/// @note
+/// Since node_arena objects are not thread-safe, node values are allocated from the heap while documents are
+/// deserialized on multiple threads.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_parallel_deserializer {
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_parallel_deserializer only accepts basic_node<...>");
+
+    /** A type for the target basic_node. */
+    using basic_node_type = BasicNodeType;
+    /** A type for the deserializer. */
+    using deserializer_type = basic_deserializer<basic_node_type>;
+
+    /// The number of chunks assigned to each thread on average. More chunks balance loads among threads better at the
+    /// cost of more overhead to start deserializing each chunk.
+    static constexpr std::size_t chunks_per_thread = 8;
+
+public:
+    /// @brief Construct a new basic_parallel_deserializer object.
+    /// @param num_threads The maximum number of threads including the calling thread. If 0, the number of concurrent
+    /// threads supported by the system is used.
+    explicit basic_parallel_deserializer(std::size_t num_threads = 0) noexcept
+        : m_num_threads(num_threads) {
+        if (m_num_threads == 0) {
+            m_num_threads = std::thread::hardware_concurrency();
+            if (m_num_threads == 0) {
+                m_num_threads = 1;
+            }
+        }
+    }
+
+public:
+    /// @brief Set the limits checked for each document while deserializing inputs.
+    /// @param limits The limits on the structure of each document.
+    void set_limits(const deserialization_limits& limits) noexcept {
+        m_limits = limits;
+    }
+
+    /// @brief Deserialize multiple YAML documents into YAML nodes.
+    /// @tparam InputAdapterType The type of an adapter object.
+    /// @param input_adapter An input adapter object for the input source buffer.
+    /// @return std::vector<basic_node_type> Root YAML nodes for deserialized YAML documents.
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    std::vector<basic_node_type> deserialize_docs(InputAdapterType&& input_adapter) {
+        const str_view input_view = input_adapter.get_buffer_view();
+        if (m_num_threads == 1) {
+            return deserialize_chunk(input_view);
+        }
+
+        const std::vector<str_view> chunks =
+            split_into_documents(input_view, input_view.size() / (m_num_threads * chunks_per_thread));
+        if (chunks.size() == 1) {
+            return deserialize_chunk(input_view);
+        }
+
+        std::vector<std::vector<basic_node_type>> results(chunks.size());
+        std::atomic<std::size_t> next_chunk {0};
+        std::atomic<bool> has_failed {false};
+        std::exception_ptr p_unexpected_error {nullptr};
+        std::mutex error_mutex {};
+
+        // No more chunks are handed out once an error occurs since the whole input will be deserialized again or the
+        // error will be rethrown.
+        auto worker = [&]() {
+            while (!has_failed.load(std::memory_order_relaxed)) {
+                const std::size_t index = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                if (index >= chunks.size()) {
+                    break;
+                }
+
+                try {
+                    if (index + 1 == chunks.size()) {
+                        results[index] = deserialize_chunk(chunks[index]);
+                    }
+                    else if (!deserialize_chunk_before_marker(chunks[index], results[index])) {
+                        has_failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+                catch (const fkyaml::exception& /*unused*/) {
+                    has_failed.store(true, std::memory_order_relaxed);
+                }
+                catch (...) {
+                    const std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!p_unexpected_error) {
+                        p_unexpected_error = std::current_exception();
+                    }
+                    has_failed.store(true, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        const std::size_t num_workers = (chunks.size() < m_num_threads) ? chunks.size() : m_num_threads;
+        std::vector<std::thread> threads {};
+        threads.reserve(num_workers - 1);
+        for (std::size_t i = 1; i < num_workers; i++) {
+            try {
+                threads.emplace_back(worker);
+            }
+            catch (const std::system_error& /*unused*/) {
+                // go on with the threads which have been started so far.
+                break;
+            }
+        }
+
+        // Deactivate an arena in the calling thread too, so that all the nodes are allocated in the same way.
+        node_arena* const p_active_arena = active_node_arena();
+        active_node_arena() = nullptr;
+        worker();
+        active_node_arena() = p_active_arena;
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        if FK_YAML_UNLIKELY (has_failed.load(std::memory_order_relaxed)) {
+            results.clear();
+            if (p_unexpected_error) {
+                std::rethrow_exception(p_unexpected_error);
+            }
+            return deserialize_chunk(input_view);
+        }
+
+        std::size_t num_docs = 0;
+        for (const std::vector<basic_node_type>& docs : results) {
+            num_docs += docs.size();
+        }
+
+        std::vector<basic_node_type> nodes {};
+        nodes.reserve(num_docs);
+        for (std::vector<basic_node_type>& docs : results) {
+            for (basic_node_type& doc : docs) {
+                nodes.emplace_back(std::move(doc));
+            }
+        }
+        return nodes;
+    }
+
+private:
+    /// @brief Deserialize the documents in a chunk.
+    /// @param chunk A chunk of whole YAML documents.
+    /// @return std::vector<basic_node_type> Root YAML nodes for deserialized YAML documents.
+    std::vector<basic_node_type> deserialize_chunk(str_view chunk) const {
+        deserializer_type deserializer;
+        deserializer.set_limits(m_limits);
+        return deserializer.deserialize_docs(input_adapter(chunk.begin(), chunk.end()));
+    }
+
+    /// @brief Deserialize the documents in a chunk which is followed by a directives end marker (`---`).
+    /// @note
+    /// The chunk is deserialized together with the marker so that the end of its last document is detected in the
+    /// same way as in the whole input. For example, a flow collection which is left open before the marker is
+    /// rejected instead of being closed at the end of the chunk. The empty document which the marker begins is
+    /// dropped from the result.
+    /// @param chunk A chunk of whole YAML documents followed by a directives end marker in the input buffer.
+    /// @param docs Storage for root YAML nodes for deserialized YAML documents.
+    /// @return true if the marker begins an empty document, false if it has been scanned as a part of the contents of
+    /// the chunk, in which case the chunk needs to be deserialized as a part of the whole input.
+    bool deserialize_chunk_before_marker(str_view chunk, std::vector<basic_node_type>& docs) const {
+        docs = deserialize_chunk(str_view {chunk.begin(), chunk.end() + 3});
+        if FK_YAML_UNLIKELY (docs.size() < 2 || !docs.back().is_null()) {
+            return false;
+        }
+        docs.pop_back();
+        return true;
+    }
+
+    /// The maximum number of threads including the calling thread.
+    std::size_t m_num_threads {1};
+    /// The limits checked for each document.
+    deserialization_limits m_limits {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_PARALLEL_DESERIALIZER_HPP */
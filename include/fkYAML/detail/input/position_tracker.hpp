@@ -10,6 +10,7 @@
 #define FK_YAML_DETAIL_INPUT_POSITION_TRACKER_HPP
 
 #include <algorithm>
+#include <cstring>
 
 #include <fkYAML/detail/macros/define_macros.hpp>
 #include <fkYAML/detail/str_view.hpp>
@@ -17,72 +18,88 @@
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
 /// @brief A position tracker of the target buffer.
+/// @note
+/// The current position is kept as a raw pointer into the target buffer, and the line/column information is computed
+/// only when it's requested. Since the computation resumes from the last resolved position, requesting positions
+/// in ascending order costs a single pass over the buffer in total.
 class position_tracker {
 public:
     void set_target_buffer(str_view buffer) noexcept {
-        m_begin = m_last = buffer.begin();
-        m_end = buffer.end();
+        m_begin = m_current = m_resolved = m_line_begin = buffer.begin();
+        m_lines_read = 0;
     }
 
-    /// @brief Update the set of the current position information.
-    /// @note This function doesn't support cases where cur_pos has moved backward from the last call.
-    /// @param cur_pos The iterator to the current element of the buffer.
-    void update_position(const char* p_current) {
-        const auto diff = static_cast<uint32_t>(p_current - m_last);
-        if (diff == 0) {
-            return;
-        }
-
-        m_cur_pos += diff;
-        const uint32_t prev_lines_read = m_lines_read;
-        m_lines_read += static_cast<uint32_t>(std::count(m_last, p_current, '\n'));
-        m_last = p_current;
-
-        if (prev_lines_read == m_lines_read) {
-            m_cur_pos_in_line += diff;
-            return;
-        }
-
-        uint32_t count = 0;
-        const char* p_begin = m_begin;
-        while (--p_current != p_begin) {
-            if (*p_current == '\n') {
-                break;
-            }
-            count++;
-        }
-        m_cur_pos_in_line = count;
+    /// @brief Update the current position.
+    /// @note The line/column information is not computed here, but lazily when it's requested.
+    /// @param p_current The iterator to the current element of the buffer.
+    void update_position(const char* p_current) noexcept {
+        m_current = p_current;
     }
 
+    /// @brief Get the current position from the beginning of the buffer.
+    /// @return uint32_t The current position from the beginning of the buffer.
     uint32_t get_cur_pos() const noexcept {
-        return m_cur_pos;
+        return static_cast<uint32_t>(m_current - m_begin);
     }
 
     /// @brief Get the current position in the current line.
     /// @return uint32_t The current position in the current line.
     uint32_t get_cur_pos_in_line() const noexcept {
-        return m_cur_pos_in_line;
+        resolve();
+        return static_cast<uint32_t>(m_current - m_line_begin);
     }
 
     /// @brief Get the number of lines which have already been read.
     /// @return uint32_t The number of lines which have already been read.
     uint32_t get_lines_read() const noexcept {
+        resolve();
         return m_lines_read;
     }
 
 private:
+    /// @brief Compute the line information at the current position from the last resolved one.
+    void resolve() const noexcept {
+        if (m_current == m_resolved) {
+            return;
+        }
+
+        if FK_YAML_LIKELY (m_current > m_resolved) {
+            const char* p_cur = m_resolved;
+            while (p_cur != m_current) {
+                const auto* p_newline =
+                    static_cast<const char*>(std::memchr(p_cur, '\n', static_cast<std::size_t>(m_current - p_cur)));
+                if (p_newline == nullptr) {
+                    break;
+                }
+                ++m_lines_read;
+                p_cur = m_line_begin = p_newline + 1;
+            }
+        }
+        else {
+            // positions may move backward when tokens have been looked ahead.
+            m_lines_read -= static_cast<uint32_t>(std::count(m_current, m_resolved, '\n'));
+            if (m_current < m_line_begin) {
+                const char* p_cur = m_current;
+                while (p_cur != m_begin && *(p_cur - 1) != '\n') {
+                    --p_cur;
+                }
+                m_line_begin = p_cur;
+            }
+        }
+
+        m_resolved = m_current;
+    }
+
     /// The iterator to the beginning element in the target buffer.
     const char* m_begin {};
-    /// The iterator to the past-the-end element in the target buffer.
-    const char* m_end {};
-    /// The iterator to the last updated element in the target buffer.
-    const char* m_last {};
-    /// The current position from the beginning of an input buffer.
-    uint32_t m_cur_pos {0};
-    /// The current position in the current line.
-    uint32_t m_cur_pos_in_line {0};
-    /// The number of lines which have already been read.
-    uint32_t m_lines_read {0};
+    /// The iterator to the current element in the target buffer.
+    const char* m_current {};
+    /// The iterator to the element at which the line information has been computed.
+    mutable const char* m_resolved {};
+    /// The iterator to the beginning of the line which contains the resolved element.
+    mutable const char* m_line_begin {};
+    /// The number of lines which have already been read until the resolved element.
+    mutable uint32_t m_lines_read {0};
 };
 
 FK_YAML_DETAIL_NAMESPACE_END
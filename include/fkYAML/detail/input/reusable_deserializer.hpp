@@ -0,0 +1,169 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_REUSABLE_DESERIALIZER_HPP
+#define FK_YAML_DETAIL_INPUT_REUSABLE_DESERIALIZER_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/meta/input_adapter_traits.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/deserialization_limits.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A class which deserializes many YAML inputs one after another with the same internal buffers.
+/// @note
+/// basic_node::deserialize() and its families construct a deserializer for each call, so that the parse context
+/// stack, the lexer's token queue, the scalar parser's buffer and the input adapter's normalized buffer are allocated
+/// from scratch every time. An object of this class keeps them between calls instead, which saves allocations when
+/// deserializing a lot of small inputs. Each call starts from a clean state, even if the last call has thrown an
+/// exception, so results never depend on previous inputs.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class basic_reusable_deserializer {
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_reusable_deserializer only accepts basic_node<...>");
+
+    /** A type for the target basic_node. */
+    using basic_node_type = BasicNodeType;
+    /** A type for the deserializer. */
+    using deserializer_type = basic_deserializer<basic_node_type>;
+
+public:
+    /// @brief Construct a new basic_reusable_deserializer object.
+    basic_reusable_deserializer() = default;
+
+    // allow only move construct/assignment
+    basic_reusable_deserializer(const basic_reusable_deserializer&) = delete;
+    basic_reusable_deserializer& operator=(const basic_reusable_deserializer&) = delete;
+    basic_reusable_deserializer(basic_reusable_deserializer&&) = default;
+    basic_reusable_deserializer& operator=(basic_reusable_deserializer&&) = default;
+    ~basic_reusable_deserializer() = default;
+
+public:
+    /// @brief Deserialize the first YAML document in the input into a basic_node object.
+    /// @tparam InputType Type of a compatible input.
+    /// @param input An input source in the YAML format.
+    /// @return The resulting basic_node object deserialized from the input source.
+    template <typename InputType>
+    basic_node_type deserialize(InputType&& input) {
+        auto adapter = input_adapter(std::forward<InputType>(input));
+        return deserialize_impl(adapter);
+    }
+
+    /// @brief Deserialize the first YAML document in the input ranged by the iterators into a basic_node object.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param begin An iterator to the first element of an input sequence.
+    /// @param end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    template <typename ItrType>
+    basic_node_type deserialize(ItrType begin, ItrType end) {
+        auto adapter = input_adapter(std::move(begin), std::move(end));
+        return deserialize_impl(adapter);
+    }
+
+    /// @brief Deserialize all YAML documents in the input into basic_node objects.
+    /// @tparam InputType Type of a compatible input.
+    /// @param input An input source in the YAML format.
+    /// @return The resulting basic_node objects deserialized from the input.
+    template <typename InputType>
+    std::vector<basic_node_type> deserialize_docs(InputType&& input) {
+        auto adapter = input_adapter(std::forward<InputType>(input));
+        return deserialize_docs_impl(adapter);
+    }
+
+    /// @brief Deserialize all YAML documents in the input ranged by the iterators into basic_node objects.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param begin An iterator to the first element of an input sequence.
+    /// @param end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node objects deserialized from the pair of iterators.
+    template <typename ItrType>
+    std::vector<basic_node_type> deserialize_docs(ItrType begin, ItrType end) {
+        auto adapter = input_adapter(std::move(begin), std::move(end));
+        return deserialize_docs_impl(adapter);
+    }
+
+    /// @brief Set the limits checked for each document in the subsequent calls.
+    /// @note The limits are kept by reset().
+    /// @param limits The limits on the structure of each document.
+    void set_limits(const deserialization_limits& limits) noexcept {
+        m_limits = limits;
+        m_deserializer.set_limits(limits);
+    }
+
+    /// @brief Release all the internal buffers kept for reuse.
+    /// @note
+    /// This object is usable as it is after this call, just like a newly constructed one. Call this function when
+    /// an unusually large input has grown the internal buffers and the memory should be given back.
+    void reset() {
+        m_deserializer = deserializer_type();
+        m_deserializer.set_limits(m_limits);
+        m_input_buffer = std::string();
+    }
+
+private:
+    /// @brief Deserialize the first YAML document with the kept input buffer.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @param adapter An input adapter object.
+    /// @return The resulting basic_node object.
+    template <typename InputAdapterType>
+    basic_node_type deserialize_impl(InputAdapterType& adapter) {
+        swap_input_buffer(adapter);
+        basic_node_type node = m_deserializer.deserialize(adapter);
+        swap_input_buffer(adapter);
+        return node;
+    }
+
+    /// @brief Deserialize all YAML documents with the kept input buffer.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @param adapter An input adapter object.
+    /// @return The resulting basic_node objects.
+    template <typename InputAdapterType>
+    std::vector<basic_node_type> deserialize_docs_impl(InputAdapterType& adapter) {
+        swap_input_buffer(adapter);
+        std::vector<basic_node_type> docs = m_deserializer.deserialize_docs(adapter);
+        swap_input_buffer(adapter);
+        return docs;
+    }
+
+    /// @brief Exchange the kept input buffer with the owned buffer of the input adapter.
+    /// @note
+    /// Resulting nodes never refer to the owned buffer of an input adapter, so the buffer can be taken back once
+    /// deserialization finishes. If deserialization throws an exception, the buffer is just lost with the adapter.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @param adapter An input adapter object.
+    template <typename InputAdapterType, enable_if_t<has_swap_buffer<InputAdapterType>::value, int> = 0>
+    void swap_input_buffer(InputAdapterType& adapter) noexcept {
+        adapter.swap_buffer(m_input_buffer);
+    }
+
+    /// @brief Exchange the kept input buffer with the owned buffer of the input adapter.
+    /// @note Input adapters without swap_buffer() are assumed to manage their buffers on their own.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    template <typename InputAdapterType, enable_if_t<!has_swap_buffer<InputAdapterType>::value, int> = 0>
+    void swap_input_buffer(InputAdapterType& /*unused*/) noexcept {
+    }
+
+private:
+    /// The deserializer whose internal buffers are reused for every input.
+    deserializer_type m_deserializer {};
+    /// The buffer handed over to input adapters for normalized inputs.
+    std::string m_input_buffer {};
+    /// The limits checked for each document.
+    deserialization_limits m_limits {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_REUSABLE_DESERIALIZER_HPP */
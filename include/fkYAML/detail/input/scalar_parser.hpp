@@ -9,6 +9,9 @@
 #ifndef FK_YAML_DETAIL_INPUT_SCALAR_PARSER_HPP
 #define FK_YAML_DETAIL_INPUT_SCALAR_PARSER_HPP
 
+#include <cstdint>
+#include <limits>
+
 #include <fkYAML/detail/macros/define_macros.hpp>
 #include <fkYAML/detail/assert.hpp>
 #include <fkYAML/detail/conversions/scalar_conv.hpp>
@@ -48,9 +51,11 @@ public:
     /// @brief Constructs a new scalar_parser object.
     /// @param line Current line.
     /// @param indent Current indentation.
-    scalar_parser(uint32_t line, uint32_t indent) noexcept
+    /// @param borrows_input Whether string scalars which need no transformation refer to the input buffer.
+    scalar_parser(uint32_t line, uint32_t indent, bool borrows_input = false) noexcept
         : m_line(line),
-          m_indent(indent) {
+          m_indent(indent),
+          m_borrows_input(borrows_input) {
     }
 
     /// @brief Destroys a scalar_parser object.
@@ -63,6 +68,22 @@ public:
     scalar_parser(scalar_parser&&) noexcept = default;
     scalar_parser& operator=(scalar_parser&&) noexcept(std::is_nothrow_move_assignable<std::string>::value) = default;
 
+    /// @brief Set the position of the next scalar to be parsed, which is reported in parse errors.
+    /// @note Since a scalar_parser object keeps its owned buffer, reusing an object for multiple scalars saves
+    /// allocations for the contents which don't end up in string nodes.
+    /// @param line Current line.
+    /// @param indent Current indentation.
+    void set_position(uint32_t line, uint32_t indent) noexcept {
+        m_line = line;
+        m_indent = indent;
+    }
+
+    /// @brief Set whether string scalars which need no transformation refer to the input buffer.
+    /// @param borrows_input true to let string scalars refer to the input buffer, false otherwise.
+    void set_borrows_input(bool borrows_input) noexcept {
+        m_borrows_input = borrows_input;
+    }
+
     /// @brief Parses a token into a flow scalar (either plain, single quoted or double quoted)
     /// @param lex_type Lexical token type for the scalar.
     /// @param tag_type Tag type for the scalar.
@@ -74,6 +95,9 @@ public:
             lex_type == lexical_token_t::DOUBLE_QUOTED_SCALAR);
         FK_YAML_ASSERT(tag_type != tag_t::SEQUENCE && tag_type != tag_t::MAPPING);
 
+        m_use_owned_buffer = false;
+        m_buffer.clear();
+
         token = parse_flow_scalar_token(lex_type, token);
         const node_type value_type = decide_value_type(lex_type, tag_type, token);
         return create_scalar_node(value_type, tag_type, token);
@@ -91,6 +115,9 @@ public:
             lex_type == lexical_token_t::BLOCK_LITERAL_SCALAR || lex_type == lexical_token_t::BLOCK_FOLDED_SCALAR);
         FK_YAML_ASSERT(tag_type != tag_t::SEQUENCE && tag_type != tag_t::MAPPING);
 
+        m_use_owned_buffer = false;
+        m_buffer.clear();
+
         if (lex_type == lexical_token_t::BLOCK_LITERAL_SCALAR) {
             token = parse_block_literal_scalar(token, header);
         }
@@ -102,6 +129,31 @@ public:
         return create_scalar_node(value_type, tag_type, token);
     }
 
+    /// @brief Parses a token into scalar contents without creating a node.
+    /// @note The owned buffer is reused across calls, so the result gets invalidated by the next call.
+    /// @param line Current line.
+    /// @param indent Current indentation.
+    /// @param lex_type Lexical token type for the scalar.
+    /// @param token Scalar contents.
+    /// @param header Block scalar header information. Ignored for flow scalars.
+    /// @return View into the parsed scalar contents.
+    str_view parse_contents(
+        uint32_t line, uint32_t indent, lexical_token_t lex_type, str_view token, const block_scalar_header& header) {
+        m_line = line;
+        m_indent = indent;
+        m_use_owned_buffer = false;
+        m_buffer.clear();
+
+        switch (lex_type) {
+        case lexical_token_t::BLOCK_LITERAL_SCALAR:
+            return parse_block_literal_scalar(token, header);
+        case lexical_token_t::BLOCK_FOLDED_SCALAR:
+            return parse_block_folded_scalar(token, header);
+        default:
+            return parse_flow_scalar_token(lex_type, token);
+        }
+    }
+
 private:
     /// @brief Parses a token into a flow scalar contents.
     /// @param lex_type Lexical token type for the scalar.
@@ -559,7 +611,7 @@ private:
 
             // conversion error from a scalar which is not tagged with !!int is recovered by treating it as a string
             // scalar. See https://github.com/fktn-k/fkYAML/issues/428.
-            return basic_node_type(string_type(token.begin(), token.end()));
+            return create_string_node(token);
         }
         case node_type::FLOAT: {
             float_number_type float_val = 0;
@@ -573,23 +625,40 @@ private:
 
             // conversion error from a scalar which is not tagged with !!float is recovered by treating it as a string
             // scalar. See https://github.com/fktn-k/fkYAML/issues/428.
-            return basic_node_type(string_type(token.begin(), token.end()));
+            return create_string_node(token);
         }
         case node_type::STRING:
-            if (!m_use_owned_buffer) {
-                return basic_node_type(string_type(token.begin(), token.end()));
-            }
-            m_use_owned_buffer = false;
-            return basic_node_type(std::move(m_buffer));
+            return create_string_node(token);
         default:                   // LCOV_EXCL_LINE
             detail::unreachable(); // LCOV_EXCL_LINE
         }
     }
 
+    /// @brief Creates a YAML string scalar object with the contents.
+    /// @param token Scalar contents.
+    /// @return A YAML string scalar object.
+    basic_node_type create_string_node(str_view token) {
+        if (m_use_owned_buffer) {
+            m_use_owned_buffer = false;
+            return basic_node_type(std::move(m_buffer));
+        }
+
+        // The token refers to the input buffer here since the contents need no transformation.
+        if (m_borrows_input && token.size() <= static_cast<std::size_t>(std::numeric_limits<uint32_t>::max())) {
+            basic_node_type node;
+            external_node_constructor<basic_node_type>::borrowed_string_scalar(
+                node, token.data(), static_cast<uint32_t>(token.size()));
+            return node;
+        }
+        return basic_node_type(string_type(token.begin(), token.end()));
+    }
+
     /// Current line
     uint32_t m_line {0};
     /// Current indentation for the scalar
     uint32_t m_indent {0};
+    /// Whether string scalars which need no transformation refer to the input buffer.
+    bool m_borrows_input {false};
     /// Whether the parsed contents are stored in an owned buffer.
     bool m_use_owned_buffer {false};
     /// Owned buffer storage for parsing. This buffer is used when scalar contents need mutation.
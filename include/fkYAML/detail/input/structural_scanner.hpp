@@ -0,0 +1,263 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_STRUCTURAL_SCANNER_HPP
+#define FK_YAML_DETAIL_INPUT_STRUCTURAL_SCANNER_HPP
+
+#include <cstdint>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/assert.hpp>
+
+#if FK_YAML_HAS_AVX2
+#include <immintrin.h>
+#elif FK_YAML_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief Count the trailing zero bits of a non-zero bit mask.
+/// @param bits A non-zero bit mask.
+/// @return The number of the trailing zero bits.
+inline uint32_t count_trailing_zeros(uint32_t bits) noexcept {
+    FK_YAML_ASSERT(bits != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctz(bits));
+#else
+    uint32_t count = 0;
+    while ((bits & 1u) == 0) {
+        bits >>= 1u;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// Each character set below provides match() overloads for a single character and, if available, for a block of 32
+// (AVX2) or 16 (SSE2) characters. The block overloads return a mask in which matching bytes are filled with 0xFF.
+
+/// @brief The set of characters which may end a plain scalar in a block context. (`\t`, `\n`, ` ` and `:`)
+struct block_plain_scalar_delimiters {
+    /// @brief Check if a character is in this set.
+    /// @param c A character.
+    /// @return true if the character is in this set, false otherwise.
+    static bool match(char c) noexcept {
+        return c == ' ' || c == '\n' || c == ':' || c == '\t';
+    }
+
+#if FK_YAML_HAS_AVX2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 32 characters.
+    /// @return The mask of matching bytes.
+    static __m256i match(__m256i block) noexcept {
+        return _mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'))),
+            _mm256_or_si256(
+                _mm256_cmpeq_epi8(block, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t'))));
+    }
+#endif
+
+#if FK_YAML_HAS_SSE2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 16 characters.
+    /// @return The mask of matching bytes.
+    static __m128i match(__m128i block) noexcept {
+        return _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'))),
+            _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(':')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'))));
+    }
+#endif
+};
+
+/// @brief The set of characters which may end a plain scalar in a flow context. (`\t`, `\n`, ` `, `:` and flow
+/// indicators)
+struct flow_plain_scalar_delimiters {
+    /// @brief Check if a character is in this set.
+    /// @param c A character.
+    /// @return true if the character is in this set, false otherwise.
+    static bool match(char c) noexcept {
+        switch (c) {
+        case ' ':
+        case '\n':
+        case ':':
+        case '\t':
+        case ',':
+        case '[':
+        case ']':
+        case '{':
+        case '}':
+            return true;
+        default:
+            return false;
+        }
+    }
+
+#if FK_YAML_HAS_AVX2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 32 characters.
+    /// @return The mask of matching bytes.
+    static __m256i match(__m256i block) noexcept {
+        // clearing the bit 0x20 maps `{` and `}` to `[` and `]` respectively.
+        const __m256i folded = _mm256_and_si256(block, _mm256_set1_epi8(static_cast<char>(0xDFu)));
+        const __m256i brackets = _mm256_or_si256(
+            _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('[')), _mm256_cmpeq_epi8(folded, _mm256_set1_epi8(']')));
+        return _mm256_or_si256(
+            block_plain_scalar_delimiters::match(block),
+            _mm256_or_si256(brackets, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(','))));
+    }
+#endif
+
+#if FK_YAML_HAS_SSE2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 16 characters.
+    /// @return The mask of matching bytes.
+    static __m128i match(__m128i block) noexcept {
+        const __m128i folded = _mm_and_si128(block, _mm_set1_epi8(static_cast<char>(0xDFu)));
+        const __m128i brackets =
+            _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('[')), _mm_cmpeq_epi8(folded, _mm_set1_epi8(']')));
+        return _mm_or_si128(
+            block_plain_scalar_delimiters::match(block),
+            _mm_or_si128(brackets, _mm_cmpeq_epi8(block, _mm_set1_epi8(','))));
+    }
+#endif
+};
+
+/// @brief The set of characters other than white spaces. (neither ` ` nor `\t`)
+struct non_white_spaces {
+    /// @brief Check if a character is in this set.
+    /// @param c A character.
+    /// @return true if the character is in this set, false otherwise.
+    static bool match(char c) noexcept {
+        return c != ' ' && c != '\t';
+    }
+
+#if FK_YAML_HAS_AVX2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 32 characters.
+    /// @return The mask of matching bytes.
+    static __m256i match(__m256i block) noexcept {
+        const __m256i spaces = _mm256_or_si256(
+            _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t')));
+        return _mm256_xor_si256(spaces, _mm256_set1_epi8(-1));
+    }
+#endif
+
+#if FK_YAML_HAS_SSE2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 16 characters.
+    /// @return The mask of matching bytes.
+    static __m128i match(__m128i block) noexcept {
+        const __m128i spaces =
+            _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')));
+        return _mm_xor_si128(spaces, _mm_set1_epi8(-1));
+    }
+#endif
+};
+
+/// @brief The set of characters other than white spaces and newline codes. (none of ` `, `\t` and `\n`)
+struct non_white_spaces_or_newlines {
+    /// @brief Check if a character is in this set.
+    /// @param c A character.
+    /// @return true if the character is in this set, false otherwise.
+    static bool match(char c) noexcept {
+        return c != ' ' && c != '\t' && c != '\n';
+    }
+
+#if FK_YAML_HAS_AVX2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 32 characters.
+    /// @return The mask of matching bytes.
+    static __m256i match(__m256i block) noexcept {
+        return _mm256_andnot_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n')), non_white_spaces::match(block));
+    }
+#endif
+
+#if FK_YAML_HAS_SSE2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 16 characters.
+    /// @return The mask of matching bytes.
+    static __m128i match(__m128i block) noexcept {
+        return _mm_andnot_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\n')), non_white_spaces::match(block));
+    }
+#endif
+};
+
+/// @brief The set of control characters in the C0 block. (U+0000 to U+001F)
+struct c0_control_chars {
+    /// @brief Check if a character is in this set.
+    /// @param c A character.
+    /// @return true if the character is in this set, false otherwise.
+    static bool match(char c) noexcept {
+        return static_cast<uint8_t>(c) < 0x20u;
+    }
+
+#if FK_YAML_HAS_AVX2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 32 characters.
+    /// @return The mask of matching bytes.
+    static __m256i match(__m256i block) noexcept {
+        // unsigned comparison: min(x, 0x1F) == x holds only if x <= 0x1F.
+        const __m256i c0_max = _mm256_set1_epi8(0x1F);
+        return _mm256_cmpeq_epi8(_mm256_min_epu8(block, c0_max), block);
+    }
+#endif
+
+#if FK_YAML_HAS_SSE2
+    /// @brief Find characters in this set in a block.
+    /// @param block A block of 16 characters.
+    /// @return The mask of matching bytes.
+    static __m128i match(__m128i block) noexcept {
+        const __m128i c0_max = _mm_set1_epi8(0x1F);
+        return _mm_cmpeq_epi8(_mm_min_epu8(block, c0_max), block);
+    }
+#endif
+};
+
+/// @brief Find the first character in the given character set.
+/// @note Checks 32 (AVX2) or 16 (SSE2) characters at once while possible, and one by one otherwise.
+/// @tparam CharSet A character set type.
+/// @param current The beginning of the range.
+/// @param end The end of the range.
+/// @return The pointer to the first character in the set, or `end` if there's no such character.
+template <typename CharSet>
+inline const char* find_first_in(const char* current, const char* end) noexcept {
+#if FK_YAML_HAS_AVX2
+    while (end - current >= 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current));
+        const auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(CharSet::match(block)));
+        if (bits != 0) {
+            return current + count_trailing_zeros(bits);
+        }
+        current += 32;
+    }
+#endif
+
+#if FK_YAML_HAS_SSE2
+    while (end - current >= 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        const auto bits = static_cast<uint32_t>(_mm_movemask_epi8(CharSet::match(block)));
+        if (bits != 0) {
+            return current + count_trailing_zeros(bits);
+        }
+        current += 16;
+    }
+#endif
+
+    for (; current != end; ++current) {
+        if (CharSet::match(*current)) {
+            return current;
+        }
+    }
+    return end;
+}
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_STRUCTURAL_SCANNER_HPP */
@@ -129,6 +129,34 @@
 #define FK_YAML_HAS_CHAR8_T (0)
 #endif
 
+// switch usage of memory-mapped file I/O which is available on POSIX-compliant platforms.
+// Users can disable it by defining FK_YAML_HAS_MMAP as 0 before including fkYAML headers.
+#ifndef FK_YAML_HAS_MMAP
+#if defined(__unix__) || defined(__APPLE__)
+#define FK_YAML_HAS_MMAP (1)
+#else
+#define FK_YAML_HAS_MMAP (0)
+#endif
+#endif
+
+// switch usage of SIMD instructions which are available on the target CPU.
+// Users can disable them by defining the macros as 0 before including fkYAML headers.
+#ifndef FK_YAML_HAS_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FK_YAML_HAS_SSE2 (1)
+#else
+#define FK_YAML_HAS_SSE2 (0)
+#endif
+#endif
+
+#ifndef FK_YAML_HAS_AVX2
+#if defined(__AVX2__)
+#define FK_YAML_HAS_AVX2 (1)
+#else
+#define FK_YAML_HAS_AVX2 (0)
+#endif
+#endif
+
 //
 // utility macros
 //
@@ -9,6 +9,7 @@
 #ifndef FK_YAML_DETAIL_META_INPUT_ADAPTER_TRAITS_HPP
 #define FK_YAML_DETAIL_META_INPUT_ADAPTER_TRAITS_HPP
 
+#include <string>
 #include <type_traits>
 
 #include <fkYAML/detail/macros/define_macros.hpp>
@@ -32,6 +33,26 @@ using get_buffer_view_fn_t = decltype(std::declval<T>().get_buffer_view());
 template <typename InputAdapterType>
 using has_get_buffer_view = is_detected<get_buffer_view_fn_t, InputAdapterType>;
 
+/// @brief A type which represents views_input function.
+/// @tparam T A target type.
+template <typename T>
+using views_input_fn_t = decltype(std::declval<const T&>().views_input());
+
+/// @brief Type traits to check if InputAdapterType has views_input member function.
+/// @tparam InputAdapterType An input adapter type to check if it has views_input function.
+template <typename InputAdapterType>
+using has_views_input = is_detected<views_input_fn_t, InputAdapterType>;
+
+/// @brief A type which represents swap_buffer function.
+/// @tparam T A target type.
+template <typename T>
+using swap_buffer_fn_t = decltype(std::declval<T&>().swap_buffer(std::declval<std::string&>()));
+
+/// @brief Type traits to check if InputAdapterType has swap_buffer member function.
+/// @tparam InputAdapterType An input adapter type to check if it has swap_buffer function.
+template <typename InputAdapterType>
+using has_swap_buffer = is_detected<swap_buffer_fn_t, InputAdapterType>;
+
 ////////////////////////////////
 //   is_input_adapter traits
 ////////////////////////////////
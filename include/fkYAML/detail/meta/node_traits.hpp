@@ -9,6 +9,8 @@
 #ifndef FK_YAML_DETAIL_META_NODE_TRAITS_HPP
 #define FK_YAML_DETAIL_META_NODE_TRAITS_HPP
 
+#include <string>
+
 #include <fkYAML/detail/macros/define_macros.hpp>
 #include <fkYAML/detail/meta/detect.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
@@ -151,6 +153,19 @@ struct is_node_compatible_type_impl<
 template <typename BasicNodeType, typename CompatibleType>
 struct is_node_compatible_type : is_node_compatible_type_impl<BasicNodeType, CompatibleType> {};
 
+///////////////////////////////
+//   is_str_view_key traits
+///////////////////////////////
+
+/// @brief Type traits to check if KeyType is a string-like key type whose characters can be compared with mapping keys
+/// as they are, i.e., without being copied into a temporary string node value.
+/// @tparam KeyType A target key type.
+template <typename KeyType>
+struct is_str_view_key : disjunction<
+                             std::is_same<typename std::decay<KeyType>::type, char*>,
+                             std::is_same<typename std::decay<KeyType>::type, const char*>,
+                             std::is_same<remove_cvref_t<KeyType>, std::string>> {};
+
 FK_YAML_DETAIL_NAMESPACE_END
 
 #endif /* FK_YAML_DETAIL_META_NODE_TRAITS_HPP */
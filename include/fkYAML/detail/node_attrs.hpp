@@ -64,6 +64,14 @@ constexpr node_attr_t scalar_bits = null_bit | bool_bit | int_bit | float_bit |
 /// This allows values such as xxHash/UUID results to round-trip correctly through get_value<uint64_t>().
 constexpr node_attr_t uint_bit = 1u << 16; // lives in the style bits area (0x00FF0000)
 
+/// The borrowed string flag bit.
+/// Set on STRING nodes whose value refers to a range of the input buffer instead of an owned string object.
+constexpr node_attr_t borrowed_str_bit = 1u << 17; // lives in the style bits area (0x00FF0000)
+
+/// The shared value flag bit.
+/// Set on SEQUENCE, MAPPING and STRING nodes whose value is reference-counted storage shared among copies.
+constexpr node_attr_t shared_bit = 1u << 18; // lives in the style bits area (0x00FF0000)
+
 /// The anchor node bit.
 constexpr node_attr_t anchor_bit = 0x01000000u;
 /// The alias node bit.
@@ -9,17 +9,197 @@
 #ifndef FK_YAML_DETAIL_NODE_PROPERTY_HPP
 #define FK_YAML_DETAIL_NODE_PROPERTY_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 
 #include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/document_metainfo.hpp>
+#include <fkYAML/detail/exception_safe_allocation.hpp>
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
+/// @brief The property set of a node, which is stored out of line since most nodes have neither a tag nor an anchor.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
 struct node_property {
+    /// @brief Construct a new node_property object with the given document metainfo.
+    /// @param meta The document metainfo.
+    explicit node_property(std::shared_ptr<document_metainfo<BasicNodeType>> meta) noexcept
+        : p_meta(std::move(meta)) {
+    }
+
+    /// @brief Construct a new node_property object with the same properties as the given one.
+    /// @param rhs A node_property object to be copied with.
+    node_property(const node_property& rhs)
+        : tag(rhs.tag),
+          anchor(rhs.anchor),
+          p_meta(rhs.p_meta) {
+    }
+
+    node_property& operator=(const node_property&) = delete;
+    node_property& operator=(node_property&&) = delete;
+    ~node_property() = default;
+
     /// The tag name property.
     std::string tag {}; // NOLINT(readability-redundant-member-init) necessary for older compilers
     /// The anchor name property.
     std::string anchor {}; // NOLINT(readability-redundant-member-init) necessary for older compilers
+    /// The metainfo of the document which the node belongs to.
+    std::shared_ptr<document_metainfo<BasicNodeType>> p_meta {};
+    /// The number of nodes sharing this property set.
+    std::atomic<uint32_t> ref_count {1};
+};
+
+/// @brief A pointer-sized handle to a node_property object which is shared among nodes until modified.
+/// @note
+/// All the nodes in a parsed document without their own tag or anchor share a single property set which only holds
+/// the document metainfo. A property set gets copied before modification if it's shared by other nodes, so tags and
+/// anchors behave as if every node owned them, while the document metainfo stays shared.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class node_property_ptr {
+public:
+    /// The type of property sets.
+    using property_type = node_property<BasicNodeType>;
+    /// The type of pointers to document metainfo.
+    using meta_pointer = std::shared_ptr<document_metainfo<BasicNodeType>>;
+
+    /// @brief Construct a new node_property_ptr object with no property set.
+    node_property_ptr() = default;
+
+    /// @brief Construct a new node_property_ptr object sharing the property set with the given one.
+    /// @param rhs A node_property_ptr object to be copied with.
+    node_property_ptr(const node_property_ptr& rhs) noexcept
+        : mp_prop(rhs.mp_prop) {
+        if (mp_prop) {
+            mp_prop->ref_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Construct a new node_property_ptr object by taking over the property set of the given one.
+    /// @param rhs A node_property_ptr object to be moved from.
+    node_property_ptr(node_property_ptr&& rhs) noexcept
+        : mp_prop(rhs.mp_prop) {
+        rhs.mp_prop = nullptr;
+    }
+
+    /// @brief Destroy the node_property_ptr object and release the property set if no other node shares it.
+    ~node_property_ptr() {
+        reset();
+    }
+
+    /// @brief Copy assignment operator.
+    /// @param rhs A node_property_ptr object to be copied with.
+    /// @return Reference to this node_property_ptr object.
+    node_property_ptr& operator=(const node_property_ptr& rhs) noexcept {
+        node_property_ptr(rhs).swap(*this);
+        return *this;
+    }
+
+    /// @brief Move assignment operator.
+    /// @param rhs A node_property_ptr object to be moved from.
+    /// @return Reference to this node_property_ptr object.
+    node_property_ptr& operator=(node_property_ptr&& rhs) noexcept {
+        node_property_ptr(std::move(rhs)).swap(*this);
+        return *this;
+    }
+
+public:
+    /// @brief Swaps the property sets with the given node_property_ptr object.
+    /// @param rhs A node_property_ptr object to be swapped with.
+    void swap(node_property_ptr& rhs) noexcept {
+        property_type* p_tmp = mp_prop;
+        mp_prop = rhs.mp_prop;
+        rhs.mp_prop = p_tmp;
+    }
+
+    /// @brief Release the property set. It gets destroyed if no other node shares it.
+    void reset() noexcept {
+        if (mp_prop && mp_prop->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            destroy_object<property_type>(mp_prop);
+        }
+        mp_prop = nullptr;
+    }
+
+    /// @brief Get the tag name.
+    /// @return The tag name, or an empty string if not set.
+    const std::string& tag() const noexcept {
+        return mp_prop ? mp_prop->tag : empty_string();
+    }
+
+    /// @brief Get the anchor name.
+    /// @return The anchor name, or an empty string if not set.
+    const std::string& anchor() const noexcept {
+        return mp_prop ? mp_prop->anchor : empty_string();
+    }
+
+    /// @brief Get the pointer to the document metainfo.
+    /// @return The pointer to the document metainfo, which may be null.
+    const meta_pointer& meta() const noexcept {
+        static const meta_pointer null_meta {};
+        return mp_prop ? mp_prop->p_meta : null_meta;
+    }
+
+    /// @brief Set a tag name.
+    /// @param tag A tag name.
+    void set_tag(std::string tag) {
+        mutable_property().tag = std::move(tag);
+    }
+
+    /// @brief Set an anchor name.
+    /// @param anchor An anchor name.
+    void set_anchor(std::string anchor) {
+        mutable_property().anchor = std::move(anchor);
+    }
+
+    /// @brief Set the pointer to the document metainfo.
+    /// @param p_meta The pointer to the document metainfo.
+    void set_meta(meta_pointer p_meta) {
+        if (meta() != p_meta) {
+            mutable_property().p_meta = std::move(p_meta);
+        }
+    }
+
+    /// @brief Make this node belong to the document of the given property set.
+    /// @note The given property set is shared as it is unless this node has its own tag or anchor.
+    /// @param doc_prop The property set holding only the document metainfo.
+    void set_document(const node_property_ptr& doc_prop) {
+        if (!mp_prop || (mp_prop->tag.empty() && mp_prop->anchor.empty())) {
+            *this = doc_prop;
+        }
+        else {
+            set_meta(doc_prop.meta());
+        }
+    }
+
+private:
+    /// @brief Get the property set which is owned only by this node, copying a shared one if necessary.
+    /// @return Reference to the property set owned only by this node.
+    property_type& mutable_property() {
+        if (!mp_prop) {
+            mp_prop = create_object<property_type>(meta_pointer());
+        }
+        else if (mp_prop->ref_count.load(std::memory_order_acquire) > 1) {
+            property_type* p_copied = create_object<property_type>(*mp_prop);
+            reset();
+            mp_prop = p_copied;
+        }
+        return *mp_prop;
+    }
+
+    /// @brief Get an empty string used for nodes without property sets.
+    /// @return Reference to an empty string.
+    static const std::string& empty_string() noexcept {
+        static const std::string empty {};
+        return empty;
+    }
+
+private:
+    /// The pointer to the property set. Null if no property has been set.
+    property_type* mp_prop {nullptr};
 };
 
 FK_YAML_DETAIL_NAMESPACE_END
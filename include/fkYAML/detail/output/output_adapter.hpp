@@ -0,0 +1,153 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_OUTPUT_OUTPUT_ADAPTER_HPP
+#define FK_YAML_DETAIL_OUTPUT_OUTPUT_ADAPTER_HPP
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/exception.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief The base class of output adapters, which receive serialization results in chunks.
+/// @note
+/// Since the serializer buffers its output and calls write() only once per chunk, the cost of the virtual call is
+/// negligible compared to the cost of writing the chunk itself.
+class output_adapter_base {
+public:
+    /// @brief Destroy the output_adapter_base object.
+    virtual ~output_adapter_base() = default;
+
+    /// @brief Write characters to the output.
+    /// @param p_chars The pointer to the first character to be written.
+    /// @param size The number of characters to be written.
+    virtual void write(const char* p_chars, std::size_t size) = 0;
+};
+
+/// @brief An output adapter which appends serialization results to a std::string object.
+class string_output_adapter final : public output_adapter_base {
+public:
+    /// @brief Construct a new string_output_adapter object.
+    /// @param str A string object to which serialization results are appended. It must outlive this object.
+    explicit string_output_adapter(std::string& str) noexcept
+        : mp_str(&str) {
+    }
+
+    /// @brief Append characters to the string.
+    /// @param p_chars The pointer to the first character to be written.
+    /// @param size The number of characters to be written.
+    void write(const char* p_chars, std::size_t size) override {
+        mp_str->append(p_chars, size);
+    }
+
+private:
+    /// The pointer to the output string.
+    std::string* mp_str {nullptr};
+};
+
+/// @brief An output adapter which writes serialization results to an output stream.
+class stream_output_adapter final : public output_adapter_base {
+public:
+    /// @brief Construct a new stream_output_adapter object.
+    /// @param os An output stream. It must outlive this object.
+    explicit stream_output_adapter(std::ostream& os) noexcept
+        : mp_ostream(&os) {
+    }
+
+    /// @brief Write characters to the stream.
+    /// @note Just like other insertions into streams, failures are reported through the stream state.
+    /// @param p_chars The pointer to the first character to be written.
+    /// @param size The number of characters to be written.
+    void write(const char* p_chars, std::size_t size) override {
+        mp_ostream->write(p_chars, static_cast<std::streamsize>(size));
+    }
+
+private:
+    /// The pointer to the output stream.
+    std::ostream* mp_ostream {nullptr};
+};
+
+/// @brief An output adapter which writes serialization results to a C-style file handle.
+class file_output_adapter final : public output_adapter_base {
+public:
+    /// @brief Construct a new file_output_adapter object.
+    /// @note This class doesn't call fopen() nor fclose(). It's user's responsibility to call those functions.
+    /// @param file A file handle for this adapter. (A non-null pointer is assumed.)
+    explicit file_output_adapter(std::FILE* file) noexcept
+        : mp_file(file) {
+    }
+
+    /// @brief Write characters to the file.
+    /// @param p_chars The pointer to the first character to be written.
+    /// @param size The number of characters to be written.
+    void write(const char* p_chars, std::size_t size) override {
+        if FK_YAML_UNLIKELY (std::fwrite(p_chars, sizeof(char), size, mp_file) != size) {
+            throw fkyaml::exception("Failed to write to the FILE object.");
+        }
+    }
+
+private:
+    /// The pointer to the output file handle.
+    std::FILE* mp_file {nullptr};
+};
+
+/// @brief An output adapter which hands serialization results over to a callback function.
+/// @tparam FlushFnType The type of a callable object with the signature of `void(const char*, std::size_t)`.
+template <typename FlushFnType>
+class callback_output_adapter final : public output_adapter_base {
+public:
+    /// @brief Construct a new callback_output_adapter object.
+    /// @param flush A callable object to be called with each chunk of serialization results.
+    explicit callback_output_adapter(FlushFnType flush)
+        : m_flush(std::move(flush)) {
+    }
+
+    /// @brief Call the callback function with characters.
+    /// @param p_chars The pointer to the first character to be written.
+    /// @param size The number of characters to be written.
+    void write(const char* p_chars, std::size_t size) override {
+        m_flush(p_chars, size);
+    }
+
+private:
+    /// The callback function.
+    FlushFnType m_flush;
+};
+
+/// @brief A factory method for string_output_adapter objects with std::string objects.
+/// @param str A string object to which serialization results are appended.
+/// @return string_output_adapter A string_output_adapter object.
+inline string_output_adapter output_adapter(std::string& str) noexcept {
+    return string_output_adapter(str);
+}
+
+/// @brief A factory method for stream_output_adapter objects with std::ostream objects.
+/// @param os An output stream.
+/// @return stream_output_adapter A stream_output_adapter object.
+inline stream_output_adapter output_adapter(std::ostream& os) noexcept {
+    return stream_output_adapter(os);
+}
+
+/// @brief A factory method for file_output_adapter objects with C-style file handles.
+/// @param file A file handle.
+/// @return file_output_adapter A file_output_adapter object.
+inline file_output_adapter output_adapter(std::FILE* file) {
+    if FK_YAML_UNLIKELY (!file) {
+        throw fkyaml::exception("Invalid FILE object pointer.");
+    }
+    return file_output_adapter(file);
+}
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_OUTPUT_OUTPUT_ADAPTER_HPP */
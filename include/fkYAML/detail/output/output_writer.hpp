@@ -0,0 +1,161 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_OUTPUT_OUTPUT_WRITER_HPP
+#define FK_YAML_DETAIL_OUTPUT_OUTPUT_WRITER_HPP
+
+#include <cstring>
+#include <string>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/output/output_adapter.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A writer which accumulates serialization results in a fixed-size buffer and hands them over to an output
+/// adapter in chunks, so that the whole output never has to be held in memory.
+/// @note
+/// The writer keeps track of the position where the current line begins, so that the current column is available in
+/// constant time without scanning the output. For this purpose, newline codes must be written either as a single
+/// character or as a part of a string literal. Other strings are assumed not to contain any newline code.
+class output_writer {
+public:
+    /// @brief Construct a new output_writer object.
+    /// @param adapter An output adapter to which buffered characters are flushed. It must outlive this object.
+    /// @param p_buffer The pointer to a buffer for pending characters. It must outlive this object.
+    /// @param capacity The size of the buffer. (A non-zero value is assumed.)
+    output_writer(output_adapter_base& adapter, char* p_buffer, std::size_t capacity) noexcept
+        : mp_adapter(&adapter),
+          mp_buffer(p_buffer),
+          m_capacity(capacity) {
+        FK_YAML_ASSERT(p_buffer != nullptr && capacity > 0);
+    }
+
+    // prohibit copy/move since this class is used only inside the serializer.
+    output_writer(const output_writer&) = delete;
+    output_writer(output_writer&&) = delete;
+    output_writer& operator=(const output_writer&) = delete;
+    output_writer& operator=(output_writer&&) = delete;
+    ~output_writer() = default;
+
+    /// @brief Append characters without any newline code to the output.
+    /// @param p_chars The pointer to the first character to be appended.
+    /// @param size The number of characters to be appended.
+    void append(const char* p_chars, std::size_t size) {
+        FK_YAML_ASSERT(std::memchr(p_chars, '\n', size) == nullptr);
+        put(p_chars, size);
+    }
+
+    /// @brief Append a repetition of a character other than a newline code to the output.
+    /// @param count The number of characters to be appended.
+    /// @param c A character to be appended.
+    void append(std::size_t count, char c) {
+        FK_YAML_ASSERT(c != '\n');
+
+        while (count > 0) {
+            if (m_size == m_capacity) {
+                flush();
+            }
+            const std::size_t n = (count < m_capacity - m_size) ? count : m_capacity - m_size;
+            std::memset(mp_buffer + m_size, c, n);
+            m_size += n;
+            count -= n;
+        }
+    }
+
+    /// @brief Append a string without any newline code to the output.
+    /// @param str A string to be appended.
+    /// @return Reference to this output_writer object.
+    output_writer& operator+=(const std::string& str) {
+        append(str.data(), str.size());
+        return *this;
+    }
+
+    /// @brief Append a string literal, which may contain newline codes, to the output.
+    /// @tparam N The size of the string literal including the terminating null character.
+    /// @param literal A string literal to be appended.
+    /// @return Reference to this output_writer object.
+    template <std::size_t N>
+    output_writer& operator+=(const char (&literal)[N]) {
+        constexpr std::size_t size = N - 1;
+        put(&literal[0], size);
+
+        for (std::size_t i = size; i > 0; i--) {
+            if (literal[i - 1] == '\n') {
+                m_line_begin = m_flushed_size + m_size - (size - i);
+                break;
+            }
+        }
+        return *this;
+    }
+
+    /// @brief Append a character to the output.
+    /// @param c A character to be appended.
+    /// @return Reference to this output_writer object.
+    output_writer& operator+=(char c) {
+        if FK_YAML_UNLIKELY (m_size == m_capacity) {
+            flush();
+        }
+        mp_buffer[m_size++] = c;
+        if (c == '\n') {
+            m_line_begin = m_flushed_size + m_size;
+        }
+        return *this;
+    }
+
+    /// @brief Get the current column, i.e., the number of characters after the last newline code in the output.
+    /// @return The current column.
+    std::size_t column() const noexcept {
+        return m_flushed_size + m_size - m_line_begin;
+    }
+
+    /// @brief Hand the buffered characters over to the output adapter.
+    void flush() {
+        if (m_size == 0) {
+            return;
+        }
+        const std::size_t size = m_size;
+        m_flushed_size += size;
+        m_size = 0;
+        mp_adapter->write(mp_buffer, size);
+    }
+
+private:
+    /// @brief Put characters into the buffer, or write them out directly if they don't fit in the buffer at all.
+    /// @param p_chars The pointer to the first character to be put.
+    /// @param size The number of characters to be put.
+    void put(const char* p_chars, std::size_t size) {
+        if FK_YAML_UNLIKELY (m_size + size > m_capacity) {
+            flush();
+            if (size > m_capacity) {
+                m_flushed_size += size;
+                mp_adapter->write(p_chars, size);
+                return;
+            }
+        }
+        std::memcpy(mp_buffer + m_size, p_chars, size);
+        m_size += size;
+    }
+
+    /// The pointer to the output adapter.
+    output_adapter_base* mp_adapter {nullptr};
+    /// The pointer to the buffer for pending characters.
+    char* mp_buffer {nullptr};
+    /// The size of the buffer.
+    std::size_t m_capacity {0};
+    /// The number of pending characters in the buffer.
+    std::size_t m_size {0};
+    /// The number of characters which have already been flushed.
+    std::size_t m_flushed_size {0};
+    /// The position in the whole output where the current line begins.
+    std::size_t m_line_begin {0};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_OUTPUT_OUTPUT_WRITER_HPP */
@@ -10,6 +10,7 @@
 #define FK_YAML_DETAIL_OUTPUT_SERIALIZER_HPP
 
 #include <cmath>
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -18,11 +19,21 @@
 #include <fkYAML/detail/conversions/to_string.hpp>
 #include <fkYAML/detail/encodings/yaml_escaper.hpp>
 #include <fkYAML/detail/input/scalar_scanner.hpp>
+#include <fkYAML/detail/input/structural_scanner.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/output/output_adapter.hpp>
+#include <fkYAML/detail/output/output_writer.hpp>
+#include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/exception.hpp>
 #include <fkYAML/node_type.hpp>
 #include <fkYAML/yaml_version_type.hpp>
 
+#if FK_YAML_HAS_AVX2
+#include <immintrin.h>
+#elif FK_YAML_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
 /// @brief A basic implementation of serialization feature for YAML nodes.
@@ -40,49 +51,105 @@ public:
     /// @return std::string A serialization result of the given Node value.
     std::string serialize(const BasicNodeType& node) {
         std::string str {};
-        serialize_document(node, str);
+        string_output_adapter adapter(str);
+        serialize(node, adapter);
         return str;
     } // LCOV_EXCL_LINE
 
+    /// @brief Serialize the given Node value into an output adapter.
+    /// @param node A Node object to be serialized.
+    /// @param adapter An output adapter to which the serialization result is written in chunks.
+    void serialize(const BasicNodeType& node, output_adapter_base& adapter) {
+        char buffer[default_buffer_size];
+        serialize(node, adapter, &buffer[0], sizeof(buffer));
+    }
+
+    /// @brief Serialize the given Node value into an output adapter through a caller-provided buffer.
+    /// @param node A Node object to be serialized.
+    /// @param adapter An output adapter to which the contents of the buffer are written whenever it gets full.
+    /// @param p_buffer The pointer to a buffer for pending characters. (A non-null pointer is assumed.)
+    /// @param size The size of the buffer. (A non-zero value is assumed.)
+    void serialize(const BasicNodeType& node, output_adapter_base& adapter, char* p_buffer, std::size_t size) {
+        output_writer out(adapter, p_buffer, size);
+        serialize_document(node, out);
+        out.flush();
+    }
+
+    /// @brief Serialize the given Node values as YAML documents.
+    /// @param docs Node objects to be serialized.
+    /// @return std::string A serialization result of the given Node values.
     std::string serialize_docs(const std::vector<BasicNodeType>& docs) {
         std::string str {};
+        string_output_adapter adapter(str);
+        serialize_docs(docs, adapter);
+        return str;
+    } // LCOV_EXCL_LINE
 
-        const auto size = static_cast<uint32_t>(docs.size());
-        for (uint32_t i = 0; i < size; i++) {
-            serialize_document(docs[i], str);
-            if (i + 1 < size) {
+    /// @brief Serialize the given Node values as YAML documents into an output adapter.
+    /// @param docs Node objects to be serialized.
+    /// @param adapter An output adapter to which the serialization result is written in chunks.
+    void serialize_docs(const std::vector<BasicNodeType>& docs, output_adapter_base& adapter) {
+        char buffer[default_buffer_size];
+        serialize_docs(docs, adapter, &buffer[0], sizeof(buffer));
+    }
+
+    /// @brief Serialize the given Node values as YAML documents into an output adapter through a caller-provided
+    /// buffer.
+    /// @param docs Node objects to be serialized.
+    /// @param adapter An output adapter to which the contents of the buffer are written whenever it gets full.
+    /// @param p_buffer The pointer to a buffer for pending characters. (A non-null pointer is assumed.)
+    /// @param size The size of the buffer. (A non-zero value is assumed.)
+    void serialize_docs(
+        const std::vector<BasicNodeType>& docs, output_adapter_base& adapter, char* p_buffer, std::size_t size) {
+        output_writer out(adapter, p_buffer, size);
+
+        const auto num_docs = static_cast<uint32_t>(docs.size());
+        for (uint32_t i = 0; i < num_docs; i++) {
+            serialize_document(docs[i], out);
+            if (i + 1 < num_docs) {
                 // Append the end-of-document marker for the next document.
-                str += "...\n";
+                out += "...\n";
             }
         }
 
-        return str;
-    } // LCOV_EXCL_LINE
+        out.flush();
+    }
 
 private:
-    void serialize_document(const BasicNodeType& node, std::string& str) {
+    /// The size of the internal buffer used when no buffer is provided by callers.
+    static constexpr std::size_t default_buffer_size = 4096;
+
+    void serialize_document(const BasicNodeType& node, output_writer& str) {
         const bool dirs_serialized = serialize_directives(node, str);
 
         // the root node cannot be an alias node.
         const bool root_has_props = node.is_anchor() || node.has_tag_name();
 
+        if (dirs_serialized) {
+            // put the root node properties, if any, on the same line as the directives end marker.
+            str += root_has_props ? ' ' : '\n';
+        }
+
         if (root_has_props) {
-            if (dirs_serialized) {
-                str.back() = ' '; // replace the last LF with a white space
-            }
             bool is_anchor_appended = try_append_anchor(node, false, str);
             try_append_tag(node, is_anchor_appended, str);
-            str += "\n";
+            str += '\n';
         }
         serialize_node(node, 0, str);
     }
 
     /// @brief Serialize the directives if any is applied to the node.
+    /// @note The directives end marker, if any, is serialized without a trailing newline code.
     /// @param node The target node.
-    /// @param str A string to hold serialization result.
+    /// @param str A writer to hold serialization result.
     /// @return bool true if any directive is serialized, false otherwise.
-    bool serialize_directives(const BasicNodeType& node, std::string& str) {
-        const auto& p_meta = node.mp_meta;
+    bool serialize_directives(const BasicNodeType& node, output_writer& str) {
+        const auto& p_meta = node.mp_prop.meta();
+        if (!p_meta) {
+            // No directive has been applied to the node.
+            return false;
+        }
+
         bool needs_directive_end = false;
 
         if (p_meta->is_version_specified) {
@@ -101,14 +168,14 @@ private:
         if (!p_meta->primary_handle_prefix.empty()) {
             str += "%TAG ! ";
             str += p_meta->primary_handle_prefix;
-            str += "\n";
+            str += '\n';
             needs_directive_end = true;
         }
 
         if (!p_meta->secondary_handle_prefix.empty()) {
             str += "%TAG !! ";
             str += p_meta->secondary_handle_prefix;
-            str += "\n";
+            str += '\n';
             needs_directive_end = true;
         }
 
@@ -116,15 +183,15 @@ private:
             for (const auto& itr : p_meta->named_handle_map) {
                 str += "%TAG ";
                 str += itr.first;
-                str += " ";
+                str += ' ';
                 str += itr.second;
-                str += "\n";
+                str += '\n';
             }
             needs_directive_end = true;
         }
 
         if (needs_directive_end) {
-            str += "---\n";
+            str += "---";
         }
 
         return needs_directive_end;
@@ -133,8 +200,8 @@ private:
     /// @brief Recursively serialize each Node object.
     /// @param node A Node object to be serialized.
     /// @param cur_indent The current indent width
-    /// @param str A string to hold serialization result.
-    void serialize_node(const BasicNodeType& node, const uint32_t cur_indent, std::string& str) {
+    /// @param str A writer to hold serialization result.
+    void serialize_node(const BasicNodeType& node, const uint32_t cur_indent, output_writer& str) {
         switch (node.get_type()) {
         case node_type::SEQUENCE:
             if (node.size() == 0) {
@@ -143,11 +210,11 @@ private:
             }
             for (const auto& seq_item : node) {
                 insert_indentation(cur_indent, str);
-                str += "-";
+                str += '-';
 
                 const bool is_appended = try_append_alias(seq_item, true, str);
                 if (is_appended) {
-                    str += "\n";
+                    str += '\n';
                     continue;
                 }
 
@@ -156,15 +223,15 @@ private:
 
                 const bool is_scalar = seq_item.is_scalar();
                 if (is_scalar) {
-                    str += " ";
+                    str += ' ';
                     serialize_node(seq_item, cur_indent, str);
-                    str += "\n";
+                    str += '\n';
                     continue;
                 }
 
                 const bool is_empty = seq_item.empty();
                 if (!is_empty) {
-                    str += "\n";
+                    str += '\n';
                     serialize_node(seq_item, cur_indent + 2, str);
                     continue;
                 }
@@ -192,20 +259,20 @@ private:
                 bool is_appended = try_append_alias(key_node, false, str);
                 if (is_appended) {
                     // The trailing white space is necessary since anchor names can contain a colon (:) at its end.
-                    str += " ";
+                    str += ' ';
                 }
                 else {
                     const bool is_anchor_appended = try_append_anchor(key_node, false, str);
                     const bool is_tag_appended = try_append_tag(key_node, is_anchor_appended, str);
                     if (is_anchor_appended || is_tag_appended) {
-                        str += " ";
+                        str += ' ';
                     }
 
                     const bool is_container = !key_node.is_scalar();
                     if (is_container) {
                         str += "? ";
                     }
-                    const auto indent = static_cast<uint32_t>(get_cur_indent(str));
+                    const auto indent = static_cast<uint32_t>(str.column());
                     serialize_node(key_node, indent, str);
                     if (is_container) {
                         // a newline code is already inserted in the above serialize_node() call.
@@ -213,14 +280,14 @@ private:
                     }
                 }
 
-                str += ":";
+                str += ':';
 
                 // serialize a mapping value node.
                 const auto& value_node = itr.value();
 
                 is_appended = try_append_alias(value_node, true, str);
                 if (is_appended) {
-                    str += "\n";
+                    str += '\n';
                     continue;
                 }
 
@@ -229,18 +296,18 @@ private:
 
                 const bool is_scalar = itr->is_scalar();
                 if (is_scalar) {
-                    str += " ";
+                    str += ' ';
                     serialize_node(value_node, cur_indent, str);
-                    str += "\n";
+                    str += '\n';
                     continue;
                 }
 
                 const bool is_empty = itr->empty();
                 if (is_empty) {
-                    str += " ";
+                    str += ' ';
                 }
                 else {
-                    str += "\n";
+                    str += '\n';
                 }
                 serialize_node(value_node, cur_indent + 2, str);
             }
@@ -262,74 +329,56 @@ private:
             str += m_tmp_str_buff;
             break;
         case node_type::STRING: {
-            bool is_escaped = false;
-            auto str_val = get_string_node_value(node, is_escaped);
+            // Borrowed strings are read in place so that serialization doesn't turn them into owned ones.
+            const str_view s = node.resolve_reference().get_str_view_impl();
 
-            if (is_escaped) {
-                // There's no other token type with escapes than strings.
-                // Also, escapes must be in double-quoted strings.
-                str += '\"';
-                str += str_val;
-                str += '\"';
+            switch (classify_string(s.begin(), s.end())) {
+            case string_style_t::PLAIN:
+                str.append(s.data(), s.size());
                 break;
-            }
-
-            // The next line is intentionally excluded from the LCOV coverage target since the next line is somehow
-            // misrecognized as it has a binary branch. Possibly begin() or end() has some conditional branch(es)
-            // internally. Confirmed with LCOV 1.14 on Ubuntu22.04.
-            const node_type type_if_plain =
-                scalar_scanner::scan(str_val.c_str(), str_val.c_str() + str_val.size()); // LCOV_EXCL_LINE
-
-            if (type_if_plain != node_type::STRING || !is_valid_plain_scalar(str_val)) {
+            case string_style_t::DOUBLE_QUOTED:
                 // Surround a string value with double quotes to keep semantic equality.
                 // Without them, serialized values will become non-string. (e.g., "1" -> 1)
                 str += '\"';
-                str += str_val;
+                str.append(s.data(), s.size());
                 str += '\"';
-            }
-            else {
-                str += str_val;
+                break;
+            case string_style_t::ESCAPED:
+                // There's no other token type with escapes than strings.
+                // Also, escapes must be in double-quoted strings.
+                str += '\"';
+                yaml_escaper::escape(s.begin(), s.end(), str);
+                str += '\"';
+                break;
             }
             break;
         }
         }
     }
 
-    /// @brief Get the current indentation width.
-    /// @param s The target string object.
-    /// @return The current indentation width.
-    std::size_t get_cur_indent(const std::string& s) const noexcept {
-        const bool is_empty = s.empty();
-        if (is_empty) {
-            return 0;
-        }
-
-        const std::size_t last_lf_pos = s.rfind('\n');
-        return (last_lf_pos != std::string::npos) ? s.size() - last_lf_pos - 1 : s.size();
-    }
-
     /// @brief Insert indentation to the serialization result.
     /// @param indent The indent width to be inserted.
-    /// @param str A string to hold serialization result.
-    void insert_indentation(const uint32_t indent, std::string& str) const noexcept {
+    /// @param str A writer to hold serialization result.
+    void insert_indentation(const uint32_t indent, output_writer& str) const {
         if (indent == 0) {
             return;
         }
 
-        str.append(indent - get_cur_indent(str), ' ');
+        str.append(indent - str.column(), ' ');
     }
 
     /// @brief Append an anchor property if it's available. Do nothing otherwise.
     /// @param node The target node which is possibly an anchor node.
     /// @param prepends_space Whether to prepend a space before an anchor property.
-    /// @param str A string to hold serialization result.
+    /// @param str A writer to hold serialization result.
     /// @return true if an anchor property has been appended, false otherwise.
-    bool try_append_anchor(const BasicNodeType& node, bool prepends_space, std::string& str) const {
+    bool try_append_anchor(const BasicNodeType& node, bool prepends_space, output_writer& str) const {
         if (node.is_anchor()) {
             if (prepends_space) {
-                str += " ";
+                str += ' ';
             }
-            str += "&" + node.get_anchor_name();
+            str += '&';
+            str += node.get_anchor_name();
             return true;
         }
         return false;
@@ -338,14 +387,15 @@ private:
     /// @brief Append an alias property if it's available. Do nothing otherwise.
     /// @param node The target node which is possibly an alias node.
     /// @param prepends_space Whether to prepend a space before an alias property.
-    /// @param str A string to hold serialization result.
+    /// @param str A writer to hold serialization result.
     /// @return true if an alias property has been appended, false otherwise.
-    bool try_append_alias(const BasicNodeType& node, bool prepends_space, std::string& str) const {
+    bool try_append_alias(const BasicNodeType& node, bool prepends_space, output_writer& str) const {
         if (node.is_alias()) {
             if (prepends_space) {
-                str += " ";
+                str += ' ';
             }
-            str += "*" + node.get_anchor_name();
+            str += '*';
+            str += node.get_anchor_name();
             return true;
         }
         return false;
@@ -353,12 +403,12 @@ private:
 
     /// @brief Append a tag name if it's available. Do nothing otherwise.
     /// @param[in] node The target node which possibly has a tag name.
-    /// @param[out] str A string to hold serialization result.
+    /// @param[out] str A writer to hold serialization result.
     /// @return true if a tag name has been appended, false otherwise.
-    bool try_append_tag(const BasicNodeType& node, bool prepends_space, std::string& str) const {
+    bool try_append_tag(const BasicNodeType& node, bool prepends_space, output_writer& str) const {
         if (node.has_tag_name()) {
             if (prepends_space) {
-                str += " ";
+                str += ' ';
             }
             str += node.get_tag_name();
             return true;
@@ -366,32 +416,77 @@ private:
         return false;
     }
 
-    /// @brief Get a string value from the given node and, if necessary, escape its contents.
-    /// @param[in] node The target string YAML node.
-    /// @param[out] is_escaped Whether the contents of an output string has been escaped.
-    /// @return The (escaped) string node value.
-    typename BasicNodeType::string_type get_string_node_value(const BasicNodeType& node, bool& is_escaped) {
-        FK_YAML_ASSERT(node.is_string());
+    /// @brief Definitions of styles in which string scalars are serialized.
+    enum class string_style_t : std::uint8_t {
+        PLAIN,         //!< Written as is.
+        DOUBLE_QUOTED, //!< Written in double quotes without escapes.
+        ESCAPED,       //!< Written in double quotes with escapes.
+    };
+
+    /// @brief Classify a string value into the style in which it is serialized, scanning the contents only once.
+    /// @param begin The beginning of the string value.
+    /// @param end The end of the string value.
+    /// @return The style of the string value.
+    static string_style_t classify_string(const char* begin, const char* end) noexcept {
+        if (begin == end) {
+            return string_style_t::DOUBLE_QUOTED;
+        }
 
-        const auto& s = node.as_str();
-        return yaml_escaper::escape(s.c_str(), s.c_str() + s.size(), is_escaped);
-    } // LCOV_EXCL_LINE
+        // white spaces and flow indicators are not allowed in plain scalars.
+        bool has_plain_breaker = false;
+        const char* current = begin;
+        while ((current = skip_safe_chars(current, end, has_plain_breaker)) != end) {
+            switch (*current) {
+            case ' ':
+            case ',':
+            case '[':
+            case ']':
+            case '{':
+            case '}':
+                has_plain_breaker = true;
+                ++current;
+                continue;
+            case '\0':
+                ++current;
+                continue;
+            default:
+                break;
+            }
 
-    bool is_valid_plain_scalar(const typename BasicNodeType::string_type& s) const noexcept {
-        if (s.empty()) {
-            return false;
+            const auto byte = static_cast<uint8_t>(*current);
+            if (byte < 0x20u || *current == '\"' || *current == '\\') {
+                return string_style_t::ESCAPED;
+            }
+
+            // non-ASCII characters which are escaped: U+0085, U+00A0, U+2028 and U+2029.
+            const std::ptrdiff_t rest = end - current;
+            if (byte == 0xC2u && rest > 1) {
+                const auto second = static_cast<uint8_t>(current[1]);
+                if (second == 0x85u || second == 0xA0u) {
+                    return string_style_t::ESCAPED;
+                }
+            }
+            else if (byte == 0xE2u && rest > 2 && static_cast<uint8_t>(current[1]) == 0x80u) {
+                const auto third = static_cast<uint8_t>(current[2]);
+                if (third == 0xA8u || third == 0xA9u) {
+                    return string_style_t::ESCAPED;
+                }
+            }
+            ++current;
         }
 
-        typedef typename BasicNodeType::string_type string_type;
-        if (s.find_first_of(" \t\n\r,[]{}") != string_type::npos) {
-            return false;
+        if (has_plain_breaker) {
+            return string_style_t::DOUBLE_QUOTED;
         }
 
-        switch (s.front()) {
+        switch (*begin) {
         case '-':
         case '?':
         case ':':
-            return s.size() > 1 && s[1] != ' ';
+            if (end - begin == 1) {
+                return string_style_t::DOUBLE_QUOTED;
+            }
+            break;
         case '#':
         case '&':
         case '*':
@@ -399,15 +494,109 @@ private:
         case '|':
         case '>':
         case '\'':
-        case '"':
         case '%':
         case '@':
         case '`':
-        case ' ':
-            return false;
+            return string_style_t::DOUBLE_QUOTED;
         default:
-            return s.back() != ' ';
+            break;
+        }
+
+        // Without double quotes, the value would be regarded as non-string. (e.g., "1" -> 1)
+        return (scalar_scanner::scan(begin, end) == node_type::STRING) ? string_style_t::PLAIN
+                                                                       : string_style_t::DOUBLE_QUOTED;
+    }
+
+    /// @brief Skip characters which can be written as is in both plain and double-quoted scalars.
+    /// @note
+    /// Checks 32 (AVX2) or 16 (SSE2) bytes at once while possible. Once a white space or a flow indicator is found,
+    /// they are skipped as well since the string value is double-quoted anyway.
+    /// @param current The beginning of the range.
+    /// @param end The end of the range.
+    /// @param has_plain_breaker Whether a white space or a flow indicator has already been found.
+    /// @return The pointer to the first character which needs to be checked, or `end` if there's no such character.
+    static const char* skip_safe_chars(const char* current, const char* end, bool has_plain_breaker) noexcept {
+#if FK_YAML_HAS_AVX2
+        // control characters, spaces and non-ASCII bytes are less than 0x21 as signed chars.
+        const __m256i ctrl_32 = _mm256_set1_epi8(0x21);
+        const __m256i dquote_32 = _mm256_set1_epi8('\"');
+        const __m256i backslash_32 = _mm256_set1_epi8('\\');
+        const __m256i comma_32 = _mm256_set1_epi8(',');
+        // clearing the bit 0x20 maps '{' and '}' to '[' and ']' respectively.
+        const __m256i case_mask_32 = _mm256_set1_epi8(static_cast<char>(0xDFu));
+        const __m256i lbracket_32 = _mm256_set1_epi8('[');
+        const __m256i rbracket_32 = _mm256_set1_epi8(']');
+        while (end - current >= 32) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current));
+            __m256i hits = _mm256_or_si256(
+                _mm256_cmpgt_epi8(ctrl_32, block),
+                _mm256_or_si256(_mm256_cmpeq_epi8(block, dquote_32), _mm256_cmpeq_epi8(block, backslash_32)));
+            if (has_plain_breaker) {
+                // spaces no longer matter.
+                hits = _mm256_andnot_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), hits);
+            }
+            else {
+                const __m256i folded = _mm256_and_si256(block, case_mask_32);
+                hits = _mm256_or_si256(
+                    hits,
+                    _mm256_or_si256(
+                        _mm256_cmpeq_epi8(block, comma_32),
+                        _mm256_or_si256(
+                            _mm256_cmpeq_epi8(folded, lbracket_32), _mm256_cmpeq_epi8(folded, rbracket_32))));
+            }
+            const auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+            if (bits != 0) {
+                return current + count_trailing_zeros(bits);
+            }
+            current += 32;
+        }
+#endif
+
+#if FK_YAML_HAS_SSE2
+        const __m128i ctrl_16 = _mm_set1_epi8(0x21);
+        const __m128i dquote_16 = _mm_set1_epi8('\"');
+        const __m128i backslash_16 = _mm_set1_epi8('\\');
+        const __m128i comma_16 = _mm_set1_epi8(',');
+        const __m128i case_mask_16 = _mm_set1_epi8(static_cast<char>(0xDFu));
+        const __m128i lbracket_16 = _mm_set1_epi8('[');
+        const __m128i rbracket_16 = _mm_set1_epi8(']');
+        while (end - current >= 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+            __m128i hits = _mm_or_si128(
+                _mm_cmplt_epi8(block, ctrl_16),
+                _mm_or_si128(_mm_cmpeq_epi8(block, dquote_16), _mm_cmpeq_epi8(block, backslash_16)));
+            if (has_plain_breaker) {
+                hits = _mm_andnot_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), hits);
+            }
+            else {
+                const __m128i folded = _mm_and_si128(block, case_mask_16);
+                hits = _mm_or_si128(
+                    hits,
+                    _mm_or_si128(
+                        _mm_cmpeq_epi8(block, comma_16),
+                        _mm_or_si128(_mm_cmpeq_epi8(folded, lbracket_16), _mm_cmpeq_epi8(folded, rbracket_16))));
+            }
+            const auto bits = static_cast<uint32_t>(_mm_movemask_epi8(hits));
+            if (bits != 0) {
+                return current + count_trailing_zeros(bits);
+            }
+            current += 16;
+        }
+#endif
+
+        for (; current != end; ++current) {
+            const auto byte = static_cast<uint8_t>(*current);
+            if (byte < 0x20u || byte >= 0x80u || byte == '\"' || byte == '\\') {
+                return current;
+            }
+            if (has_plain_breaker) {
+                continue;
+            }
+            if (byte == ' ' || byte == ',' || (byte & 0xDFu) == '[' || (byte & 0xDFu) == ']') {
+                return current;
+            }
         }
+        return end;
     }
 
 private:
@@ -0,0 +1,117 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_SHARED_VALUE_HPP
+#define FK_YAML_DETAIL_SHARED_VALUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/assert.hpp>
+#include <fkYAML/detail/exception_safe_allocation.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A heap object which holds a node value together with its reference count, so that copies of a node can
+/// share the value until one of them gets modified.
+/// @note
+/// This class derives from the value type so that a pointer to a shared value can be stored and used just like a
+/// pointer to a value allocated by create_object(). Such a pointer must be released with release_shared_value().
+/// @tparam ValueType The type of a node value, i.e., a sequence, mapping or string type.
+template <typename ValueType>
+struct shared_value : ValueType {
+    /// @brief Construct a new shared_value object with a copy of the given value.
+    /// @param value A value to be copied.
+    explicit shared_value(const ValueType& value)
+        : ValueType(value) {
+    }
+
+    /// @brief Construct a new shared_value object by moving the given value.
+    /// @param value A value to be moved from.
+    explicit shared_value(ValueType&& value)
+        : ValueType(std::move(value)) {
+    }
+
+    /// @brief Move constructor, which is used only when create_object() relocates the object into memory from the
+    /// allocator of the value.
+    /// @param rhs A shared_value object to be moved from.
+    shared_value(shared_value&& rhs)
+        : ValueType(std::move(static_cast<ValueType&>(rhs))),
+          ref_count(rhs.ref_count.load(std::memory_order_relaxed)) {
+    }
+
+    // the reference count must not be copied along with the value.
+    shared_value(const shared_value&) = delete;
+    shared_value& operator=(const shared_value&) = delete;
+    shared_value& operator=(shared_value&&) = delete;
+    ~shared_value() = default;
+
+    /// The number of nodes which refer to this value.
+    std::atomic<std::size_t> ref_count {1};
+};
+
+/// @brief Move a value allocated by create_object() into a new shared value referred to only by the caller.
+/// @tparam ValueType The type of the value.
+/// @param p_value A pointer to the value allocated by create_object(). It is destroyed on success.
+/// @return A pointer to the shared value.
+template <typename ValueType>
+inline ValueType* make_shared_value(ValueType* p_value) {
+    FK_YAML_ASSERT(p_value != nullptr);
+    ValueType* p_shared = create_object<shared_value<ValueType>>(std::move(*p_value));
+    destroy_object<ValueType>(p_value);
+    return p_shared;
+}
+
+/// @brief Copy a shared value into a new shared value referred to only by the caller.
+/// @tparam ValueType The type of the value.
+/// @param p_value A pointer to the shared value to be copied.
+/// @return A pointer to the new shared value.
+template <typename ValueType>
+inline ValueType* clone_shared_value(const ValueType* p_value) {
+    FK_YAML_ASSERT(p_value != nullptr);
+    return create_object<shared_value<ValueType>>(*p_value);
+}
+
+/// @brief Add a reference to a shared value.
+/// @tparam ValueType The type of the value.
+/// @param p_value A pointer to the shared value.
+/// @return The same pointer as `p_value`.
+template <typename ValueType>
+inline ValueType* acquire_shared_value(ValueType* p_value) noexcept {
+    FK_YAML_ASSERT(p_value != nullptr);
+    static_cast<shared_value<ValueType>*>(p_value)->ref_count.fetch_add(1, std::memory_order_relaxed);
+    return p_value;
+}
+
+/// @brief Remove a reference to a shared value, and destroy the value if it was the last one.
+/// @tparam ValueType The type of the value.
+/// @param p_value A pointer to the shared value.
+template <typename ValueType>
+inline void release_shared_value(ValueType* p_value) {
+    FK_YAML_ASSERT(p_value != nullptr);
+    auto* p_shared = static_cast<shared_value<ValueType>*>(p_value);
+    if (p_shared->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        destroy_object<shared_value<ValueType>>(p_shared);
+    }
+}
+
+/// @brief Checks if a shared value is referred to only by the caller.
+/// @tparam ValueType The type of the value.
+/// @param p_value A pointer to the shared value.
+/// @return true if no other node refers to the value, false otherwise.
+template <typename ValueType>
+inline bool is_unique_shared_value(const ValueType* p_value) noexcept {
+    FK_YAML_ASSERT(p_value != nullptr);
+    return static_cast<const shared_value<ValueType>*>(p_value)->ref_count.load(std::memory_order_acquire) == 1;
+}
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_SHARED_VALUE_HPP */
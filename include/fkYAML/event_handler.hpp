@@ -0,0 +1,113 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_EVENT_HANDLER_HPP
+#define FK_YAML_EVENT_HANDLER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief Definition of the styles of scalars reported to event handlers.
+/// @sa https://fktn-k.github.io/fkYAML/api/event_handler/
+enum class scalar_style : std::uint8_t {
+    PLAIN,         //!< plain (unquoted) scalars
+    SINGLE_QUOTED, //!< single-quoted scalars
+    DOUBLE_QUOTED, //!< double-quoted scalars
+    LITERAL,       //!< block literal style scalars
+    FOLDED,        //!< block folded style scalars
+};
+
+/// @brief A base class of handlers which receive parse events from basic_node::parse_events().
+/// @note
+/// Every callback returns true to continue parsing or false to abort it. The default implementations just continue.
+/// Any type with the same set of member functions can be used as a handler without deriving from this class.
+/// @note
+/// String arguments are not null-terminated and only valid until the callback returns.
+/// @sa https://fktn-k.github.io/fkYAML/api/event_handler/
+class event_handler {
+public:
+    /// @brief Destroy the event_handler object.
+    virtual ~event_handler() = default;
+
+    /// @brief Called at the beginning of a YAML document.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool start_document() {
+        return true;
+    }
+
+    /// @brief Called at the end of a YAML document.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool end_document() {
+        return true;
+    }
+
+    /// @brief Called at the beginning of a mapping.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool start_mapping() {
+        return true;
+    }
+
+    /// @brief Called at the end of a mapping.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool end_mapping() {
+        return true;
+    }
+
+    /// @brief Called at the beginning of a sequence.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool start_sequence() {
+        return true;
+    }
+
+    /// @brief Called at the end of a sequence.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool end_sequence() {
+        return true;
+    }
+
+    /// @brief Called for a scalar. Empty nodes are reported as empty plain scalars.
+    /// @param value The pointer to the scalar contents with quotes, escapes and line folding processed.
+    /// @param length The length of the scalar contents.
+    /// @param style The style of the scalar.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool scalar(const char* /*unused*/, std::size_t /*unused*/, scalar_style /*unused*/) {
+        return true;
+    }
+
+    /// @brief Called for an alias node.
+    /// @param name The pointer to the anchor name which the alias refers to.
+    /// @param length The length of the anchor name.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool alias(const char* /*unused*/, std::size_t /*unused*/) {
+        return true;
+    }
+
+    /// @brief Called for an anchor right before the event of the node which the anchor is attached to.
+    /// @param name The pointer to the anchor name.
+    /// @param length The length of the anchor name.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool anchor(const char* /*unused*/, std::size_t /*unused*/) {
+        return true;
+    }
+
+    /// @brief Called for a tag right before the event of the node which the tag is attached to.
+    /// @param name The pointer to the tag name as written in the input, e.g., `!!str`.
+    /// @param length The length of the tag name.
+    /// @return true to continue parsing, false to abort it.
+    virtual bool tag(const char* /*unused*/, std::size_t /*unused*/) {
+        return true;
+    }
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_EVENT_HANDLER_HPP */
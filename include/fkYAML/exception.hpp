@@ -130,6 +130,20 @@ private:
     }
 };
 
+/// @brief An exception class indicating that a document exceeds one of the deserialization limits.
+/// @sa https://fktn-k.github.io/fkYAML/api/exception/limit_exceeded/
+class limit_exceeded : public parse_error {
+public:
+    /// @brief Constructs a new limit_exceeded object with an error message and counts of lines and columns at the
+    /// error.
+    /// @param[in] msg An error message.
+    /// @param[in] lines Count of lines.
+    /// @param[in] cols_in_line Count of columns.
+    explicit limit_exceeded(const char* msg, uint32_t lines, uint32_t cols_in_line) noexcept
+        : parse_error(msg, lines, cols_in_line) {
+    }
+};
+
 /// @brief An exception class indicating an invalid type conversion.
 /// @sa https://fktn-k.github.io/fkYAML/api/exception/type_error/
 class type_error : public exception {
@@ -203,6 +217,23 @@ private:
     }
 };
 
+/// @brief An exception class indicating an invalid path expression.
+/// @sa https://fktn-k.github.io/fkYAML/api/exception/invalid_path/
+class invalid_path : public exception {
+public:
+    /// @brief Constructs a new invalid_path object with an error message and invalid path contents.
+    /// @param[in] msg An error message.
+    /// @param[in] path Invalid path contents.
+    explicit invalid_path(const char* msg, const char* path)
+        : exception(generate_error_message(msg, path).c_str()) {
+    }
+
+private:
+    static std::string generate_error_message(const char* msg, const char* path) noexcept {
+        return detail::format("invalid_path: %s path=%s", msg, path);
+    }
+};
+
 FK_YAML_NAMESPACE_END
 
 #endif /* FK_YAML_EXCEPTION_HPP */
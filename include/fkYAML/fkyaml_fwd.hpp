@@ -10,8 +10,10 @@
 #define FK_YAML_FKYAML_FWD_HPP
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
@@ -46,6 +48,55 @@ using node = basic_node<>;
 template <typename Key, typename Value, typename IgnoredCompare, typename Allocator>
 class ordered_map;
 
+/// @brief A map-like container which preserves insertion order and looks up keys with a hash index.
+/// @tparam Key A type for keys.
+/// @tparam Value A type for values.
+/// @tparam IgnoredCompare A placeholder for key comparison. This will be ignored.
+/// @tparam Allocator A class for allocators.
+/// @sa https://fktn-k.github.io/fkYAML/api/indexed_ordered_map/
+template <typename Key, typename Value, typename IgnoredCompare, typename Allocator>
+class indexed_ordered_map;
+
+/// @brief A read-only view of a whole file, memory-mapped where the platform supports it.
+/// @sa https://fktn-k.github.io/fkYAML/api/mapped_file/
+class mapped_file;
+
+/// @brief A path to a node in a YAML document, compiled from a JSON Pointer or a dotted path expression.
+/// @sa https://fktn-k.github.io/fkYAML/api/path/
+class path;
+
+/// @brief A set of paths evaluated together against a node, sharing the traversal of common prefixes.
+/// @sa https://fktn-k.github.io/fkYAML/api/path/
+class path_batch;
+
+/// @brief A monotonic memory arena for node values.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+class node_arena;
+
+/// @brief An allocator which allocates memory from a node_arena if available, or from the heap otherwise.
+/// @tparam T The type of objects to be allocated.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+template <typename T>
+class arena_allocator;
+
+/// @brief A sequence container type whose memory is allocated with arena_allocator.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+template <typename T, typename...>
+using arena_vector = std::vector<T, arena_allocator<T>>;
+
+/// @brief A mapping container type whose memory is allocated with arena_allocator.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+template <typename Key, typename Value, typename...>
+using arena_map = std::map<Key, Value, std::less<Key>, arena_allocator<std::pair<const Key, Value>>>;
+
+/// @brief A string type whose memory is allocated with arena_allocator.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+using arena_string = std::basic_string<char, std::char_traits<char>, arena_allocator<char>>;
+
+/// @brief A YAML node value container whose values are allocated with arena_allocator.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+using arena_node = basic_node<arena_vector, arena_map, bool, std::int64_t, double, arena_string>;
+
 FK_YAML_NAMESPACE_END
 
 #endif /* FK_YAML_FKYAML_FWD_HPP */
@@ -0,0 +1,534 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_INDEXED_ORDERED_MAP_HPP
+#define FK_YAML_INDEXED_ORDERED_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/assert.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/exception.hpp>
+#include <fkYAML/node_type.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A helper to check if a key can be registered to the hash index of indexed_ordered_map objects.
+/// @note Keys of non-basic_node types are always indexable.
+/// @tparam Key A type for keys.
+template <typename Key, typename = void>
+struct index_key_checker {
+    /// @brief Checks if the given key can be registered to the hash index.
+    /// @return Always true.
+    static bool is_indexable(const Key& /*unused*/) noexcept {
+        return true;
+    }
+};
+
+/// @brief A partial specialization of index_key_checker for basic_node keys.
+/// @note
+/// Only keys which are compared by their own hashable scalar values are indexable. Anchors and aliases are excluded
+/// since their values may change after insertion, and so are float numbers since they are compared with tolerance.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+struct index_key_checker<BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value>> {
+    /// @brief Checks if the given key can be registered to the hash index.
+    /// @param key A key to be checked.
+    /// @return true if the key can be registered to the hash index, false otherwise.
+    static bool is_indexable(const BasicNodeType& key) noexcept {
+        if (key.is_anchor() || key.is_alias()) {
+            return false;
+        }
+
+        switch (key.get_type()) {
+        case node_type::NULL_OBJECT:
+        case node_type::BOOLEAN:
+        case node_type::INTEGER:
+        case node_type::STRING:
+            return true;
+        default:
+            return false;
+        }
+    }
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A map-like container which preserves insertion order and looks up keys with a hash index.
+/// @note
+/// The hash index is built once the number of entries reaches index_threshold. Smaller maps are searched linearly just
+/// like ordered_map. Keys must be hashable with std::hash<Key>.
+/// @tparam Key A type for keys.
+/// @tparam Value A type for values.
+/// @tparam IgnoredCompare A placeholder for key comparison. This will be ignored.
+/// @tparam Allocator A class for allocators.
+/// @sa https://fktn-k.github.io/fkYAML/api/indexed_ordered_map/
+template <
+    typename Key, typename Value, typename IgnoredCompare = std::less<Key>,
+    typename Allocator = std::allocator<std::pair<const Key, Value>>>
+class indexed_ordered_map : private std::vector<std::pair<const Key, Value>, Allocator> {
+public:
+    /// @brief A type for keys.
+    using key_type = Key;
+
+    /// @brief A type for values.
+    using mapped_type = Value;
+
+    /// @brief A type for internal key-value containers.
+    using Container = std::vector<std::pair<const Key, Value>, Allocator>;
+
+    /// @brief A type for key-value pairs.
+    using value_type = typename Container::value_type;
+
+    /// @brief A type for allocators.
+    using allocator_type = typename Container::allocator_type;
+
+    /// @brief A type for non-const iterators.
+    using iterator = typename Container::iterator;
+
+    /// @brief A type for const iterators.
+    using const_iterator = typename Container::const_iterator;
+
+    /// @brief A type for non-const reverse iterators.
+    using reverse_iterator = typename Container::reverse_iterator;
+
+    /// @brief A type for const reverse iterators.
+    using const_reverse_iterator = typename Container::const_reverse_iterator;
+
+    /// @brief A type for size parameters used in this class.
+    using size_type = typename Container::size_type;
+
+    /// @brief A type for comparison between keys.
+    using key_compare = std::equal_to<Key>;
+
+    /// @brief A type for hashing keys.
+    using hasher = std::hash<Key>;
+
+    /// @brief The number of entries at which the hash index gets built.
+    static constexpr size_type index_threshold = 16;
+
+private:
+    /// @brief A slot in the open addressing hash index.
+    struct index_slot {
+        /// The hash value of the key at the position.
+        std::size_t hash {0};
+        /// The position of the entry in the container. npos if the slot is empty.
+        size_type pos {npos};
+    };
+
+    /// @brief A type for the hash index.
+    using index_type =
+        std::vector<index_slot, typename std::allocator_traits<Allocator>::template rebind_alloc<index_slot>>;
+
+    /// @brief A type for the positions of entries whose keys are not indexable.
+    using position_list_type =
+        std::vector<size_type, typename std::allocator_traits<Allocator>::template rebind_alloc<size_type>>;
+
+    /// @brief A value which represents an invalid position.
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+public:
+    /// @brief Construct a new indexed_ordered_map object.
+    indexed_ordered_map() noexcept(noexcept(Container()))
+        : Container() {
+    }
+
+    /// @brief Construct a new indexed_ordered_map object with an initializer list.
+    /// @note Entries with duplicate keys are ignored except the first one.
+    /// @param init An initializer list to construct the inner container object.
+    indexed_ordered_map(std::initializer_list<value_type> init)
+        : Container() {
+        this->reserve(init.size());
+        for (const value_type& pair : init) {
+            emplace(pair.first, pair.second);
+        }
+    }
+
+public:
+    using Container::begin;
+    using Container::cbegin;
+    using Container::cend;
+    using Container::crbegin;
+    using Container::crend;
+    using Container::empty;
+    using Container::end;
+    using Container::get_allocator;
+    using Container::max_size;
+    using Container::rbegin;
+    using Container::rend;
+    using Container::reserve;
+    using Container::size;
+
+    /// @brief A subscript operator for indexed_ordered_map objects.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to the target value.
+    /// @return mapped_type& Reference to a mapped_type object associated with the given key.
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
+    mapped_type& operator[](KeyType&& key) {
+        return emplace(std::forward<KeyType>(key), mapped_type()).first->second;
+    }
+
+    /// @brief Emplace a new key-value pair if the new key does not exist.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to be emplaced to this indexed_ordered_map object.
+    /// @param value A value to be emplaced to this indexed_ordered_map object.
+    /// @return std::pair<iterator, bool> A result of emplacement of the new key-value pair.
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
+    std::pair<iterator, bool> emplace(KeyType&& key, const mapped_type& value) {
+        key_type key_obj(std::forward<KeyType>(key));
+
+        const bool is_indexable = detail::index_key_checker<key_type>::is_indexable(key_obj);
+        const std::size_t hash = (is_indexable && is_indexed()) ? hasher()(key_obj) : 0;
+
+        const size_type found_pos = find_pos(key_obj, is_indexable, hash);
+        if (found_pos != npos) {
+            return {this->begin() + found_pos, false};
+        }
+
+        this->emplace_back(std::move(key_obj), value);
+
+        const size_type new_pos = size() - 1;
+        if (is_indexed()) {
+            register_entry(new_pos, is_indexable, is_indexable ? hash : 0);
+        }
+        else if (size() >= index_threshold) {
+            rebuild_index();
+        }
+
+        return {this->begin() + new_pos, true};
+    }
+
+    /// @brief Find a value associated to the given key. Throws an exception if the search fails.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find a value with.
+    /// @return mapped_type& The value associated to the given key.
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
+    mapped_type& at(KeyType&& key) { // NOLINT(cppcoreguidelines-missing-std-forward)
+        const size_type pos = find_pos(key);
+        if FK_YAML_UNLIKELY (pos == npos) {
+            throw fkyaml::exception("key not found.");
+        }
+        return Container::operator[](pos).second;
+    }
+
+    /// @brief Find a value associated to the given key. Throws an exception if the search fails.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find a value with.
+    /// @return const mapped_type& The value associated to the given key.
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
+    const mapped_type& at(KeyType&& key) const { // NOLINT(cppcoreguidelines-missing-std-forward)
+        const size_type pos = find_pos(key);
+        if FK_YAML_UNLIKELY (pos == npos) {
+            throw fkyaml::exception("key not found.");
+        }
+        return Container::operator[](pos).second;
+    }
+
+    /// @brief Find a value with the given key.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find a value with.
+    /// @return iterator The iterator for the found value, or the result of end().
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
+    iterator find(KeyType&& key) { // NOLINT(cppcoreguidelines-missing-std-forward)
+        const size_type pos = find_pos(key);
+        return (pos == npos) ? this->end() : this->begin() + pos;
+    }
+
+    /// @brief Find a value with the given key.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find a value with.
+    /// @return const_iterator The constant iterator for the found value, or the result of end().
+    template <
+        typename KeyType,
+        detail::enable_if_t<detail::is_usable_as_key_type<key_compare, key_type, KeyType>::value, int> = 0>
+    const_iterator find(KeyType&& key) const { // NOLINT(cppcoreguidelines-missing-std-forward)
+        const size_type pos = find_pos(key);
+        return (pos == npos) ? this->end() : this->begin() + pos;
+    }
+
+    /// @brief Erase the entry at the given position.
+    /// @note The following entries are shifted in place, and only their positions in the hash index get updated.
+    /// @param pos An iterator to the entry to be erased.
+    /// @return iterator The iterator following the erased entry.
+    iterator erase(const_iterator pos) {
+        const size_type erased_pos = static_cast<size_type>(pos - this->cbegin());
+        unregister_entry(erased_pos);
+
+        // Keys are not assignable. Shift the following entries by reconstructing them in place instead.
+        for (size_type i = erased_pos; i + 1 < size(); i++) {
+            value_type* p_entry = std::addressof(Container::operator[](i));
+            p_entry->~value_type();
+            ::new (p_entry) value_type(std::move(Container::operator[](i + 1)));
+        }
+        Container::pop_back();
+
+        if (is_indexed() && size() < index_threshold) {
+            m_index.clear();
+            m_unindexed_positions.clear();
+        }
+
+        return this->begin() + erased_pos;
+    }
+
+    /// @brief Erase all the entries.
+    void clear() noexcept {
+        Container::clear();
+        m_index.clear();
+        m_unindexed_positions.clear();
+    }
+
+    /// @brief Exchange the contents with those of the other indexed_ordered_map object.
+    /// @param other An indexed_ordered_map object to exchange the contents with.
+    void swap(indexed_ordered_map& other) noexcept {
+        Container::swap(other);
+        m_index.swap(other.m_index);
+        m_unindexed_positions.swap(other.m_unindexed_positions);
+    }
+
+    /// @brief An equal-to operator of the indexed_ordered_map class.
+    /// @param lhs An indexed_ordered_map object on the left side.
+    /// @param rhs An indexed_ordered_map object on the right side.
+    /// @return true if both have the same entries in the same order, false otherwise.
+    friend bool operator==(const indexed_ordered_map& lhs, const indexed_ordered_map& rhs) {
+        return static_cast<const Container&>(lhs) == static_cast<const Container&>(rhs);
+    }
+
+    /// @brief A not-equal-to operator of the indexed_ordered_map class.
+    /// @param lhs An indexed_ordered_map object on the left side.
+    /// @param rhs An indexed_ordered_map object on the right side.
+    /// @return true if the entries or their order are different, false otherwise.
+    friend bool operator!=(const indexed_ordered_map& lhs, const indexed_ordered_map& rhs) {
+        return !(lhs == rhs);
+    }
+
+    /// @brief A less-than operator of the indexed_ordered_map class.
+    /// @param lhs An indexed_ordered_map object on the left side.
+    /// @param rhs An indexed_ordered_map object on the right side.
+    /// @return true if lhs is lexicographically less than rhs, false otherwise.
+    friend bool operator<(const indexed_ordered_map& lhs, const indexed_ordered_map& rhs) {
+        return static_cast<const Container&>(lhs) < static_cast<const Container&>(rhs);
+    }
+
+private:
+    /// @brief Checks if the hash index has been built.
+    /// @return true if the hash index has been built, false otherwise.
+    bool is_indexed() const noexcept {
+        return !m_index.empty();
+    }
+
+    /// @brief Converts the given key into a key_type object. No conversion is made for key_type objects.
+    /// @param key A key to be converted.
+    /// @return const key_type& The given key.
+    static const key_type& to_key(const key_type& key) noexcept {
+        return key;
+    }
+
+    /// @brief Converts the given key into a key_type object.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to be converted.
+    /// @return key_type A key_type object converted from the given key.
+    template <typename KeyType>
+    static key_type to_key(const KeyType& key) {
+        return key_type(key);
+    }
+
+    /// @brief Finds the position of the entry with the given key.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find an entry with.
+    /// @return size_type The position of the found entry, or npos if not found.
+    template <typename KeyType>
+    size_type find_pos(const KeyType& key) const {
+        if (!is_indexed()) {
+            return find_pos_linear(key);
+        }
+
+        // Convert the key only once so that each comparison doesn't construct a temporary key.
+        const key_type& key_obj = to_key(key);
+        const bool is_indexable = detail::index_key_checker<key_type>::is_indexable(key_obj);
+        return find_pos(key_obj, is_indexable, is_indexable ? hasher()(key_obj) : 0);
+    }
+
+    /// @brief Finds the position of the entry with the given key.
+    /// @param key A key to find an entry with.
+    /// @param is_indexable Whether the given key can be found with the hash index.
+    /// @param hash The hash value of the given key. Used only if the hash index has been built.
+    /// @return size_type The position of the found entry, or npos if not found.
+    size_type find_pos(const key_type& key, bool is_indexable, std::size_t hash) const {
+        if (!is_indexed() || !is_indexable) {
+            // Keys which are not indexable may still be equal to any key, e.g., aliases.
+            return find_pos_linear(key);
+        }
+
+        const size_type mask = m_index.size() - 1;
+        for (size_type i = hash & mask; m_index[i].pos != npos; i = (i + 1) & mask) {
+            const index_slot& slot = m_index[i];
+            if (slot.hash == hash && m_compare(Container::operator[](slot.pos).first, key)) {
+                return slot.pos;
+            }
+        }
+
+        for (size_type pos : m_unindexed_positions) {
+            if (m_compare(Container::operator[](pos).first, key)) {
+                return pos;
+            }
+        }
+
+        return npos;
+    }
+
+    /// @brief Finds the position of the entry with the given key by linear search.
+    /// @tparam KeyType A type for the input key.
+    /// @param key A key to find an entry with.
+    /// @return size_type The position of the found entry, or npos if not found.
+    template <typename KeyType>
+    size_type find_pos_linear(const KeyType& key) const {
+        for (size_type i = 0; i < size(); i++) {
+            if (m_compare(Container::operator[](i).first, key)) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /// @brief Registers the entry at the given position to the hash index.
+    /// @param pos The position of the entry.
+    /// @param is_indexable Whether the key of the entry can be registered to the hash index.
+    /// @param hash The hash value of the key of the entry.
+    void register_entry(size_type pos, bool is_indexable, std::size_t hash) {
+        if (!is_indexable) {
+            m_unindexed_positions.push_back(pos);
+            return;
+        }
+
+        // Keep the load factor 0.5 or lower.
+        if ((size() - m_unindexed_positions.size()) * 2 > m_index.size()) {
+            rebuild_index();
+            return;
+        }
+
+        const size_type mask = m_index.size() - 1;
+        size_type i = hash & mask;
+        while (m_index[i].pos != npos) {
+            i = (i + 1) & mask;
+        }
+        m_index[i].hash = hash;
+        m_index[i].pos = pos;
+    }
+
+    /// @brief Unregisters the entry at the given position from the hash index, and shifts the positions of the
+    /// following entries by one.
+    /// @param pos The position of the entry to be erased.
+    void unregister_entry(size_type pos) {
+        if (!is_indexed()) {
+            return;
+        }
+
+        const size_type mask = m_index.size() - 1;
+        const key_type& key = Container::operator[](pos).first;
+        if (detail::index_key_checker<key_type>::is_indexable(key)) {
+            size_type i = hasher()(key) & mask;
+            while (m_index[i].pos != pos) {
+                FK_YAML_ASSERT(m_index[i].pos != npos);
+                i = (i + 1) & mask;
+            }
+
+            // Fill the hole with a following slot in the same cluster which would otherwise become unreachable.
+            for (size_type j = (i + 1) & mask; m_index[j].pos != npos; j = (j + 1) & mask) {
+                const size_type home = m_index[j].hash & mask;
+                const bool is_reachable = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+                if (!is_reachable) {
+                    m_index[i] = m_index[j];
+                    i = j;
+                }
+            }
+            m_index[i].pos = npos;
+        }
+        else {
+            m_unindexed_positions.erase(
+                std::find(m_unindexed_positions.begin(), m_unindexed_positions.end(), pos));
+        }
+
+        for (index_slot& slot : m_index) {
+            if (slot.pos != npos && slot.pos > pos) {
+                --slot.pos;
+            }
+        }
+        for (size_type& unindexed_pos : m_unindexed_positions) {
+            if (unindexed_pos > pos) {
+                --unindexed_pos;
+            }
+        }
+    }
+
+    /// @brief Rebuilds the hash index from scratch. The hash index is discarded if there are too few entries.
+    void rebuild_index() {
+        m_index.clear();
+        m_unindexed_positions.clear();
+
+        if (size() < index_threshold) {
+            return;
+        }
+
+        size_type index_size = index_threshold * 2;
+        while (index_size < size() * 2) {
+            index_size *= 2;
+        }
+        m_index.resize(index_size);
+
+        const size_type mask = index_size - 1;
+        for (size_type pos = 0; pos < size(); pos++) {
+            const key_type& key = Container::operator[](pos).first;
+            if (!detail::index_key_checker<key_type>::is_indexable(key)) {
+                m_unindexed_positions.push_back(pos);
+                continue;
+            }
+
+            const std::size_t hash = hasher()(key);
+            size_type i = hash & mask;
+            while (m_index[i].pos != npos) {
+                i = (i + 1) & mask;
+            }
+            m_index[i].hash = hash;
+            m_index[i].pos = pos;
+        }
+    }
+
+private:
+    /// The object for comparing keys.
+    key_compare m_compare {};
+    /// The open addressing hash index from key hashes to entry positions. Empty if not built.
+    index_type m_index {};
+    /// The positions of entries whose keys are not registered to the hash index.
+    position_list_type m_unindexed_positions {};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_INDEXED_ORDERED_MAP_HPP */
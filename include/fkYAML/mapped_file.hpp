@@ -0,0 +1,208 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_MAPPED_FILE_HPP
+#define FK_YAML_MAPPED_FILE_HPP
+
+#include <cstdio>
+#include <string>
+#include <utility>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/string_formatter.hpp>
+#include <fkYAML/exception.hpp>
+
+#if FK_YAML_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A read-only view of a whole file, memory-mapped where the platform supports it.
+/// @note If the file cannot be mapped (e.g., a pipe or a platform without mmap), its contents are read into an
+/// internal buffer instead so that the same interface is available.
+/// @sa https://fktn-k.github.io/fkYAML/api/mapped_file/
+class mapped_file {
+public:
+    /// @brief Construct a new mapped_file object by opening the file at the given path.
+    /// @param path A path to the file to be opened.
+    /// @sa https://fktn-k.github.io/fkYAML/api/mapped_file/
+    explicit mapped_file(const std::string& path) {
+#if FK_YAML_HAS_MMAP
+        if (map_file(path)) {
+            return;
+        }
+#endif
+        read_file(path);
+    }
+
+    /// @brief Copy constructor. (deleted)
+    mapped_file(const mapped_file&) = delete;
+
+    /// @brief Move constructor.
+    /// @param other A mapped_file object to be moved from.
+    mapped_file(mapped_file&& other) noexcept
+        : mp_mapped(other.mp_mapped),
+          m_size(other.m_size),
+          m_buffer(std::move(other.m_buffer)) {
+        other.mp_mapped = nullptr;
+        other.m_size = 0;
+    }
+
+    /// @brief Destroy the mapped_file object and release the mapped region if any.
+    ~mapped_file() {
+        release();
+    }
+
+    /// @brief Copy assignment operator. (deleted)
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /// @brief Move assignment operator.
+    /// @param other A mapped_file object to be moved from.
+    /// @return Reference to this mapped_file object.
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        if FK_YAML_LIKELY (this != &other) {
+            release();
+            mp_mapped = other.mp_mapped;
+            m_size = other.m_size;
+            m_buffer = std::move(other.m_buffer);
+            other.mp_mapped = nullptr;
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+public:
+    /// @brief Get the pointer to the beginning of the file contents.
+    /// @return The pointer to the beginning of the file contents.
+    /// @sa https://fktn-k.github.io/fkYAML/api/mapped_file/
+    const char* data() const noexcept {
+        return mp_mapped ? static_cast<const char*>(mp_mapped) : m_buffer.data();
+    }
+
+    /// @brief Get the byte size of the file contents.
+    /// @return The byte size of the file contents.
+    /// @sa https://fktn-k.github.io/fkYAML/api/mapped_file/
+    std::size_t size() const noexcept {
+        return mp_mapped ? m_size : m_buffer.size();
+    }
+
+    /// @brief Check if the file contents are empty.
+    /// @return true if the file contents are empty, false otherwise.
+    /// @sa https://fktn-k.github.io/fkYAML/api/mapped_file/
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /// @brief Check if the file contents are served directly from a memory-mapped region.
+    /// @return true if the file contents are memory-mapped, false if they have been copied into a buffer.
+    /// @sa https://fktn-k.github.io/fkYAML/api/mapped_file/
+    bool is_mapped() const noexcept {
+        return mp_mapped != nullptr;
+    }
+
+private:
+#if FK_YAML_HAS_MMAP
+    /// @brief Map a regular file into memory.
+    /// @param path A path to the target file.
+    /// @return true if the file has been mapped or is empty, false if the contents need to be read instead.
+    bool map_file(const std::string& path) {
+#ifdef O_CLOEXEC
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+#endif
+        if FK_YAML_UNLIKELY (fd < 0) {
+            throw fkyaml::exception(detail::format("Failed to open the file: %s", path.c_str()).c_str());
+        }
+
+        struct stat st {};
+        if FK_YAML_UNLIKELY (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return false;
+        }
+
+        if (st.st_size == 0) {
+            // mmap() rejects zero-length mappings. An empty file needs no buffer anyway.
+            ::close(fd);
+            return true;
+        }
+
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* p_mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping stays valid after the file descriptor is closed.
+        ::close(fd);
+        if FK_YAML_UNLIKELY (p_mapped == MAP_FAILED) {
+            return false;
+        }
+
+#ifdef POSIX_MADV_SEQUENTIAL
+        // the contents are scanned from the beginning to the end only once.
+        ::posix_madvise(p_mapped, size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+        mp_mapped = p_mapped;
+        m_size = size;
+        return true;
+    }
+#endif
+
+    /// @brief Read the whole contents of a file into the internal buffer.
+    /// @param path A path to the target file.
+    void read_file(const std::string& path) {
+        std::FILE* p_file = nullptr;
+#ifdef _MSC_VER
+        if (::fopen_s(&p_file, path.c_str(), "rb") != 0) {
+            p_file = nullptr;
+        }
+#else
+        p_file = std::fopen(path.c_str(), "rb");
+#endif
+        if FK_YAML_UNLIKELY (!p_file) {
+            throw fkyaml::exception(detail::format("Failed to open the file: %s", path.c_str()).c_str());
+        }
+
+        char tmp_buf[4096] {};
+        std::size_t read_size = 0;
+        while ((read_size = std::fread(&tmp_buf[0], sizeof(char), sizeof(tmp_buf), p_file)) > 0) {
+            m_buffer.append(&tmp_buf[0], read_size);
+        }
+
+        const bool has_error = std::ferror(p_file) != 0;
+        std::fclose(p_file);
+        if FK_YAML_UNLIKELY (has_error) {
+            throw fkyaml::exception(detail::format("Failed to read the file: %s", path.c_str()).c_str());
+        }
+    }
+
+    /// @brief Release the mapped region if any.
+    void release() noexcept {
+#if FK_YAML_HAS_MMAP
+        if (mp_mapped) {
+            ::munmap(mp_mapped, m_size);
+        }
+#endif
+        mp_mapped = nullptr;
+        m_size = 0;
+    }
+
+private:
+    /// The beginning of the mapped region. nullptr if the file is not mapped.
+    void* mp_mapped {nullptr};
+    /// The byte size of the mapped region.
+    std::size_t m_size {0};
+    /// The buffer holding the file contents if the file is not mapped.
+    std::string m_buffer {};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_MAPPED_FILE_HPP */
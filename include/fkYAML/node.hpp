@@ -16,6 +16,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -24,7 +25,11 @@
 #include <fkYAML/detail/document_metainfo.hpp>
 #include <fkYAML/detail/exception_safe_allocation.hpp>
 #include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/document_reader.hpp>
+#include <fkYAML/detail/input/event_parser.hpp>
 #include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/input/parallel_deserializer.hpp>
+#include <fkYAML/detail/input/reusable_deserializer.hpp>
 #include <fkYAML/detail/iterator.hpp>
 #include <fkYAML/detail/map_range_proxy.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
@@ -35,12 +40,23 @@
 #include <fkYAML/detail/node_ref_storage.hpp>
 #include <fkYAML/detail/output/serializer.hpp>
 #include <fkYAML/detail/reverse_iterator.hpp>
+#include <fkYAML/detail/shared_value.hpp>
+#include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/detail/types/node_t.hpp>
 #include <fkYAML/detail/types/yaml_version_t.hpp>
+#include <fkYAML/deserialization_limits.hpp>
+#include <fkYAML/event_handler.hpp>
 #include <fkYAML/exception.hpp>
+#include <fkYAML/indexed_ordered_map.hpp>
+#include <fkYAML/node_arena.hpp>
 #include <fkYAML/node_type.hpp>
 #include <fkYAML/node_value_converter.hpp>
 #include <fkYAML/ordered_map.hpp>
+#include <fkYAML/path.hpp>
+
+#ifdef FK_YAML_HAS_CXX_17
+#include <string_view>
+#endif
 
 FK_YAML_NAMESPACE_BEGIN
 
@@ -144,6 +160,14 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/map_range/
     using const_map_range = fkyaml::detail::map_range_proxy<const basic_node>;
 
+    /// @brief A type for readers which deserialize YAML documents one by one from streams or file handles.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/document_reader/
+    using document_reader = fkyaml::detail::basic_document_reader<basic_node>;
+
+    /// @brief A type for deserializers which keep their internal buffers between calls to deserialize many inputs.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserializer/
+    using deserializer = fkyaml::detail::basic_reusable_deserializer<basic_node>;
+
 private:
     template <typename BasicNodeType>
     friend struct fkyaml::detail::external_node_constructor;
@@ -154,12 +178,18 @@ private:
     template <typename BasicNodeType>
     friend class fkyaml::detail::basic_serializer;
 
+    friend struct std::hash<basic_node>;
+
     /// @brief A type for YAML docs deserializers.
     using deserializer_type = detail::basic_deserializer<basic_node>;
+    /// @brief A type for YAML event parsers.
+    using event_parser_type = detail::basic_event_parser<basic_node>;
     /// @brief A type for YAML docs serializers.
     using serializer_type = detail::basic_serializer<basic_node>;
     /// @brief A helper type alias for std::initializer_list.
     using initializer_list_t = std::initializer_list<detail::node_ref_storage<basic_node>>;
+    /// @brief A type for entries of anchor tables.
+    using anchor_entry_type = detail::anchor_table_entry<basic_node>;
 
     /// @brief The actual storage for a YAML node value of the @ref basic_node class.
     /// @details This union combines the different storage types for the YAML value types defined in @ref node_t.
@@ -202,21 +232,36 @@ private:
 
         /// @brief Destroys the existing Node value. This process is recursive if the specified node type is for
         /// containers.
-        /// @param[in] type A Node type to determine the value to be destroyed.
-        void destroy(detail::node_attr_t value_type_bit) {
-            switch (value_type_bit) {
+        /// @param[in] attrs The node attributes to determine the value to be destroyed.
+        void destroy(detail::node_attr_t attrs) {
+            switch (attrs & detail::node_attr_mask::value) {
             case detail::node_attr_bits::seq_bit:
-                p_seq->clear();
-                detail::destroy_object<sequence_type>(p_seq);
+                if (attrs & detail::node_attr_bits::shared_bit) {
+                    detail::release_shared_value(p_seq);
+                }
+                else {
+                    p_seq->clear();
+                    detail::destroy_object<sequence_type>(p_seq);
+                }
                 p_seq = nullptr;
                 break;
             case detail::node_attr_bits::map_bit:
-                p_map->clear();
-                detail::destroy_object<mapping_type>(p_map);
+                if (attrs & detail::node_attr_bits::shared_bit) {
+                    detail::release_shared_value(p_map);
+                }
+                else {
+                    p_map->clear();
+                    detail::destroy_object<mapping_type>(p_map);
+                }
                 p_map = nullptr;
                 break;
             case detail::node_attr_bits::string_bit:
-                detail::destroy_object<string_type>(p_str);
+                if (attrs & detail::node_attr_bits::shared_bit) {
+                    detail::release_shared_value(p_str);
+                }
+                else if ((attrs & detail::node_attr_bits::borrowed_str_bit) == 0) {
+                    detail::destroy_object<string_type>(p_str);
+                }
                 p_str = nullptr;
                 break;
             default:
@@ -236,6 +281,10 @@ private:
         float_number_type float_val;
         /// A pointer to the value of string type.
         string_type* p_str;
+        /// A pointer to the first character of a borrowed string value in the input buffer.
+        const char* p_borrowed_str;
+        /// A pointer to the anchor table entry referenced by an anchor/alias node.
+        anchor_entry_type* p_anchor;
     };
 
 public:
@@ -261,15 +310,19 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
     basic_node(const basic_node& rhs)
         : m_attrs(rhs.m_attrs),
-          mp_meta(rhs.mp_meta),
-          m_prop(rhs.m_prop) {
+          m_borrowed_str_len(rhs.m_borrowed_str_len),
+          mp_prop(rhs.mp_prop) {
         if FK_YAML_LIKELY (!has_anchor_name()) {
+            // A copy of a shared value just adds a reference to it. (See enable_copy_on_write() for details.)
+            const bool is_shared = m_attrs & detail::node_attr_bits::shared_bit;
             switch (m_attrs & detail::node_attr_mask::value) {
             case detail::node_attr_bits::seq_bit:
-                m_value.p_seq = detail::create_object<sequence_type>(*(rhs.m_value.p_seq));
+                m_value.p_seq = is_shared ? detail::acquire_shared_value(rhs.m_value.p_seq)
+                                          : detail::create_object<sequence_type>(*(rhs.m_value.p_seq));
                 break;
             case detail::node_attr_bits::map_bit:
-                m_value.p_map = detail::create_object<mapping_type>(*(rhs.m_value.p_map));
+                m_value.p_map = is_shared ? detail::acquire_shared_value(rhs.m_value.p_map)
+                                          : detail::create_object<mapping_type>(*(rhs.m_value.p_map));
                 break;
             case detail::node_attr_bits::null_bit:
                 m_value.p_map = nullptr;
@@ -284,12 +337,28 @@ public:
                 m_value.float_val = rhs.m_value.float_val;
                 break;
             case detail::node_attr_bits::string_bit:
-                m_value.p_str = detail::create_object<string_type>(*(rhs.m_value.p_str));
+                if (m_attrs & detail::node_attr_bits::borrowed_str_bit) {
+                    // A copy of a borrowed string refers to the same input buffer.
+                    m_value.p_borrowed_str = rhs.m_value.p_borrowed_str;
+                    break;
+                }
+                m_value.p_str = is_shared ? detail::acquire_shared_value(rhs.m_value.p_str)
+                                          : detail::create_object<string_type>(*(rhs.m_value.p_str));
                 break;
             default:                   // LCOV_EXCL_LINE
                 detail::unreachable(); // LCOV_EXCL_LINE
             }
         }
+        else {
+            m_value.p_anchor = rhs.m_value.p_anchor;
+            m_value.p_anchor->add_ref();
+        }
+
+        // A copy of a container node holds copies of the child nodes, which notify changes by themselves, unless it
+        // shares the value with the original.
+        if ((m_attrs & detail::node_attr_mask::anchoring) || (m_attrs & detail::node_attr_bits::shared_bit)) {
+            notify_structure_change();
+        }
     }
 
     /// @brief Move constructor of the basic_node class.
@@ -297,8 +366,8 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
     basic_node(basic_node&& rhs) noexcept
         : m_attrs(rhs.m_attrs),
-          mp_meta(std::move(rhs.mp_meta)),
-          m_prop(std::move(rhs.m_prop)) {
+          m_borrowed_str_len(rhs.m_borrowed_str_len),
+          mp_prop(std::move(rhs.mp_prop)) {
         if FK_YAML_LIKELY (!has_anchor_name()) {
             switch (m_attrs & detail::node_attr_mask::value) {
             case detail::node_attr_bits::seq_bit:
@@ -328,6 +397,12 @@ public:
                 rhs.m_value.float_val = static_cast<float_number_type>(0.0);
                 break;
             case detail::node_attr_bits::string_bit:
+                if (m_attrs & detail::node_attr_bits::borrowed_str_bit) {
+                    FK_YAML_ASSERT(rhs.m_value.p_borrowed_str != nullptr);
+                    m_value.p_borrowed_str = rhs.m_value.p_borrowed_str;
+                    rhs.m_value.p_borrowed_str = nullptr;
+                    break;
+                }
                 FK_YAML_ASSERT(rhs.m_value.p_str != nullptr);
                 m_value.p_str = rhs.m_value.p_str;
                 rhs.m_value.p_str = nullptr;
@@ -336,6 +411,11 @@ public:
                 detail::unreachable(); // LCOV_EXCL_LINE
             }
         }
+        else {
+            m_value.p_anchor = rhs.m_value.p_anchor;
+        }
+
+        notify_structure_change();
 
         rhs.m_attrs = detail::node_attr_bits::default_bits;
         rhs.m_value.p_map = nullptr;
@@ -396,7 +476,8 @@ public:
             auto& map = *m_value.p_map;
             for (auto& elem_ref : init) {
                 auto elem = elem_ref.release();
-                auto& seq = *elem.m_value.p_seq;
+                // Use as_seq() so that the elements are never moved out of a value shared with other copies.
+                auto& seq = elem.as_seq();
                 map.emplace(std::move(seq[0]), std::move(seq[1]));
             }
         }
@@ -417,20 +498,21 @@ public:
     ~basic_node() noexcept // NOLINT(bugprone-exception-escape)
     {
         if (m_attrs & detail::node_attr_mask::anchoring) {
+            anchor_entry_type& entry = *m_value.p_anchor;
             if (m_attrs & detail::node_attr_bits::anchor_bit) {
-                auto itr = mp_meta->anchor_table.equal_range(m_prop.anchor).first;
-                std::advance(itr, detail::node_attr_bits::get_anchor_offset(m_attrs));
-                itr->second.m_value.destroy(itr->second.m_attrs & detail::node_attr_mask::value);
-                itr->second.m_attrs = detail::node_attr_bits::default_bits;
-                itr->second.mp_meta.reset();
+                basic_node& anchored = entry.node;
+                anchored.m_value.destroy(anchored.m_attrs);
+                anchored.m_attrs = detail::node_attr_bits::default_bits;
+                anchored.mp_prop.reset();
             }
+            entry.remove_ref();
         }
         else if ((m_attrs & detail::node_attr_bits::null_bit) == 0) {
-            m_value.destroy(m_attrs & detail::node_attr_mask::value);
+            m_value.destroy(m_attrs);
         }
 
         m_attrs = detail::node_attr_bits::default_bits;
-        mp_meta.reset();
+        mp_prop.reset();
     }
 
 public:
@@ -459,6 +541,35 @@ public:
             detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
     }
 
+    /// @brief Deserialize the first YAML document in the input into a basic_node object, checking the structure of the
+    /// document against the given limits.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] limits The limits on the structure of the document.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename InputType>
+    static basic_node deserialize(InputType&& input, const deserialization_limits& limits) {
+        deserializer_type deserializer;
+        deserializer.set_limits(limits);
+        return deserializer.deserialize(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input ranged by the iterators into a basic_node object,
+    /// checking the structure of the document against the given limits.
+    /// @tparam ItrType Type of a compatible iterator
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @param[in] limits The limits on the structure of the document.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename ItrType>
+    static basic_node deserialize(ItrType begin, ItrType end, const deserialization_limits& limits) {
+        deserializer_type deserializer;
+        deserializer.set_limits(limits);
+        return deserializer.deserialize(detail::input_adapter(std::move(begin), std::move(end)));
+    }
+
     /// @brief Deserialize all YAML documents in the input into basic_node objects.
     /// @tparam InputType Type of a compatible input.
     /// @param[in] input An input source in the YAML format.
@@ -469,6 +580,20 @@ public:
         return deserializer_type().deserialize_docs(detail::input_adapter(std::forward<InputType>(input)));
     }
 
+    /// @brief Deserialize all YAML documents in the input into basic_node objects, checking the structure of each
+    /// document against the given limits.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] limits The limits on the structure of each document.
+    /// @return The resulting basic_node objects deserialized from the input.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs/
+    template <typename InputType>
+    static std::vector<basic_node> deserialize_docs(InputType&& input, const deserialization_limits& limits) {
+        deserializer_type deserializer;
+        deserializer.set_limits(limits);
+        return deserializer.deserialize_docs(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
     /// @brief Deserialize all YAML documents in the input ranged by the iterators into basic_node objects.
     /// @tparam ItrType Type of a compatible iterator.
     /// @param[in] begin An iterator to the first element of an input sequence.
@@ -481,6 +606,133 @@ public:
             detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
     }
 
+    /// @brief Deserialize all YAML documents in the input ranged by the iterators into basic_node objects, checking the
+    /// structure of each document against the given limits.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @param[in] limits The limits on the structure of each document.
+    /// @return The resulting basic_node objects deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs/
+    template <typename ItrType>
+    static std::vector<basic_node> deserialize_docs(ItrType begin, ItrType end, const deserialization_limits& limits) {
+        deserializer_type deserializer;
+        deserializer.set_limits(limits);
+        return deserializer.deserialize_docs(detail::input_adapter(std::move(begin), std::move(end)));
+    }
+
+    /// @brief Deserialize all YAML documents in the input into basic_node objects using multiple threads.
+    /// @note
+    /// Documents are split at document markers at the beginning of lines and deserialized concurrently. The results
+    /// and errors are the same as those of deserialize_docs() for valid YAML inputs, but node values are allocated
+    /// from the heap even while a node_arena is active.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] num_threads The maximum number of threads to be used. If 0, the number of concurrent threads
+    /// supported by the system is used.
+    /// @return The resulting basic_node objects deserialized from the input.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs_parallel/
+    template <typename InputType>
+    static std::vector<basic_node> deserialize_docs_parallel(InputType&& input, std::size_t num_threads = 0) {
+        return detail::basic_parallel_deserializer<basic_node>(num_threads).deserialize_docs(
+            detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize all YAML documents in the input into basic_node objects using multiple threads, checking the
+    /// structure of each document against the given limits.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] limits The limits on the structure of each document.
+    /// @param[in] num_threads The maximum number of threads to be used. If 0, the number of concurrent threads
+    /// supported by the system is used.
+    /// @return The resulting basic_node objects deserialized from the input.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs_parallel/
+    template <typename InputType>
+    static std::vector<basic_node> deserialize_docs_parallel(
+        InputType&& input, const deserialization_limits& limits, std::size_t num_threads = 0) {
+        detail::basic_parallel_deserializer<basic_node> deserializer(num_threads);
+        deserializer.set_limits(limits);
+        return deserializer.deserialize_docs(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input into a basic_node object whose string scalars refer
+    /// to the input buffer where possible.
+    /// @note
+    /// String scalars which need no transformation (escapes, line folding, etc.) are not copied but refer to the input
+    /// buffer until they get modified or accessed via as_str(). So the input must outlive the resulting node and all
+    /// of its copies. If the input cannot be lexed in place (e.g., UTF-16 encoded or containing CRs), strings are
+    /// copied as deserialize() does.
+    /// @tparam InputType Type of a compatible input. Must be an lvalue so that it can outlive the resulting node.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_borrowed/
+    template <typename InputType>
+    static basic_node deserialize_borrowed(InputType&& input) {
+        static_assert(
+            std::is_lvalue_reference<InputType>::value, "The input must be an lvalue which outlives resulting nodes.");
+        deserializer_type deserializer;
+        deserializer.set_borrows_input(true);
+        return deserializer.deserialize(detail::input_adapter(input));
+    }
+
+    /// @brief Deserialize the first YAML document in the input ranged by the iterators into a basic_node object whose
+    /// string scalars refer to the input buffer where possible.
+    /// @note The range must outlive the resulting node and all of its copies.
+    /// @tparam ItrType Type of a compatible iterator
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_borrowed/
+    template <typename ItrType>
+    static basic_node deserialize_borrowed(ItrType begin, ItrType end) {
+        deserializer_type deserializer;
+        deserializer.set_borrows_input(true);
+        return deserializer.deserialize(detail::input_adapter(std::move(begin), std::move(end)));
+    }
+
+    /// @brief Deserialize all YAML documents in the input into basic_node objects whose string scalars refer to the
+    /// input buffer where possible.
+    /// @note The input must outlive the resulting nodes and all of their copies.
+    /// @tparam InputType Type of a compatible input. Must be an lvalue so that it can outlive the resulting nodes.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting basic_node objects deserialized from the input.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_borrowed/
+    template <typename InputType>
+    static std::vector<basic_node> deserialize_docs_borrowed(InputType&& input) {
+        static_assert(
+            std::is_lvalue_reference<InputType>::value, "The input must be an lvalue which outlives resulting nodes.");
+        deserializer_type deserializer;
+        deserializer.set_borrows_input(true);
+        return deserializer.deserialize_docs(detail::input_adapter(input));
+    }
+
+    /// @brief Deserialize all YAML documents in the input ranged by the iterators into basic_node objects whose string
+    /// scalars refer to the input buffer where possible.
+    /// @note The range must outlive the resulting nodes and all of their copies.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node objects deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_borrowed/
+    template <typename ItrType>
+    static std::vector<basic_node> deserialize_docs_borrowed(ItrType begin, ItrType end) {
+        deserializer_type deserializer;
+        deserializer.set_borrows_input(true);
+        return deserializer.deserialize_docs(detail::input_adapter(std::move(begin), std::move(end)));
+    }
+
+    /// @brief Parse all YAML documents in the input and report parse events to the handler without creating nodes.
+    /// @tparam InputType Type of a compatible input.
+    /// @tparam HandlerType Type of an event handler, e.g., a class derived from fkyaml::event_handler.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] handler An event handler object.
+    /// @return true if the whole input has been parsed, false if the handler has aborted parsing.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/parse_events/
+    template <typename InputType, typename HandlerType>
+    static bool parse_events(InputType&& input, HandlerType& handler) {
+        return event_parser_type().parse(detail::input_adapter(std::forward<InputType>(input)), handler);
+    }
+
     /// @brief Serialize a basic_node object into a string.
     /// @param[in] node A basic_node object to be serialized.
     /// @return The resulting string object from the serialization of the given node.
@@ -497,6 +749,63 @@ public:
         return serializer_type().serialize_docs(docs);
     }
 
+    /// @brief Serialize a basic_node object into an output without building the whole result in memory.
+    /// @tparam OutputType Type of a compatible output, i.e., std::ostream, std::FILE* or std::string (appended to).
+    /// @param[in] node A basic_node object to be serialized.
+    /// @param[in] output An output to which the serialization result is written in chunks.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/serialize/
+    template <typename OutputType>
+    static void serialize(const basic_node& node, OutputType&& output) {
+        auto adapter = detail::output_adapter(std::forward<OutputType>(output));
+        serializer_type().serialize(node, adapter);
+    }
+
+    /// @brief Serialize a basic_node object through a caller-provided buffer which is handed over to a callback
+    /// function whenever it gets full.
+    /// @tparam FlushFnType Type of a callable object with the signature of `void(const char*, std::size_t)`.
+    /// @param[in] node A basic_node object to be serialized.
+    /// @param[in] p_buffer The pointer to a buffer for pending characters.
+    /// @param[in] size The size of the buffer.
+    /// @param[in] flush A callable object to be called with each chunk of the serialization result.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/serialize/
+    template <typename FlushFnType>
+    static void serialize(const basic_node& node, char* p_buffer, std::size_t size, FlushFnType&& flush) {
+        if FK_YAML_UNLIKELY (p_buffer == nullptr || size == 0) {
+            throw fkyaml::exception("Invalid output buffer.");
+        }
+        detail::callback_output_adapter<detail::remove_cvref_t<FlushFnType>> adapter(std::forward<FlushFnType>(flush));
+        serializer_type().serialize(node, adapter, p_buffer, size);
+    }
+
+    /// @brief Serialize basic_node objects into an output without building the whole result in memory.
+    /// @tparam OutputType Type of a compatible output, i.e., std::ostream, std::FILE* or std::string (appended to).
+    /// @param[in] docs basic_node objects to be serialized.
+    /// @param[in] output An output to which the serialization result is written in chunks.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/serialize_docs/
+    template <typename OutputType>
+    static void serialize_docs(const std::vector<basic_node>& docs, OutputType&& output) {
+        auto adapter = detail::output_adapter(std::forward<OutputType>(output));
+        serializer_type().serialize_docs(docs, adapter);
+    }
+
+    /// @brief Serialize basic_node objects through a caller-provided buffer which is handed over to a callback
+    /// function whenever it gets full.
+    /// @tparam FlushFnType Type of a callable object with the signature of `void(const char*, std::size_t)`.
+    /// @param[in] docs basic_node objects to be serialized.
+    /// @param[in] p_buffer The pointer to a buffer for pending characters.
+    /// @param[in] size The size of the buffer.
+    /// @param[in] flush A callable object to be called with each chunk of the serialization result.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/serialize_docs/
+    template <typename FlushFnType>
+    static void serialize_docs(
+        const std::vector<basic_node>& docs, char* p_buffer, std::size_t size, FlushFnType&& flush) {
+        if FK_YAML_UNLIKELY (p_buffer == nullptr || size == 0) {
+            throw fkyaml::exception("Invalid output buffer.");
+        }
+        detail::callback_output_adapter<detail::remove_cvref_t<FlushFnType>> adapter(std::forward<FlushFnType>(flush));
+        serializer_type().serialize_docs(docs, adapter, p_buffer, size);
+    }
+
     /// @brief A factory method for sequence basic_node objects without sequence_type objects.
     /// @return A YAML sequence node.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/sequence/
@@ -616,7 +925,7 @@ public:
             throw fkyaml::type_error("operator[] is unavailable for a scalar node.", get_type());
         }
 
-        basic_node key_node = std::forward<KeyType>(key);
+        basic_node key_node = make_lookup_key(std::forward<KeyType>(key));
 
         if (act_node.is_sequence_impl()) {
             // Do not use is_integer_impl() since n may be an anchor or alias.
@@ -629,7 +938,7 @@ public:
         }
 
         FK_YAML_ASSERT(act_node.m_value.p_map != nullptr);
-        return act_node.m_value.p_map->operator[](std::move(key_node));
+        return find_or_insert(*act_node.m_value.p_map, std::move(key_node));
     }
 
     /// @brief A subscript operator of the basic_node class with a key of a compatible type with basic_node.
@@ -650,7 +959,7 @@ public:
             throw fkyaml::type_error("operator[] is unavailable for a scalar node.", get_type());
         }
 
-        basic_node key_node = std::forward<KeyType>(key);
+        basic_node key_node = make_lookup_key(std::forward<KeyType>(key));
 
         if (act_node.is_sequence_impl()) {
             if FK_YAML_UNLIKELY (!key_node.is_integer_impl()) {
@@ -662,7 +971,7 @@ public:
         }
 
         FK_YAML_ASSERT(act_node.m_value.p_map != nullptr);
-        return act_node.m_value.p_map->operator[](std::move(key_node));
+        return find_or_insert(*act_node.m_value.p_map, std::move(key_node));
     }
 
     /// @brief A subscript operator of the basic_node class with a basic_node key object.
@@ -754,7 +1063,7 @@ public:
                  std::numeric_limits<float_number_type>::epsilon());
             break;
         case detail::node_attr_bits::string_bit:
-            ret = (*(lhs.m_value.p_str) == *(act_rhs.m_value.p_str));
+            ret = (lhs.get_str_view_impl() == act_rhs.get_str_view_impl());
             break;
         default:                   // LCOV_EXCL_LINE
             detail::unreachable(); // LCOV_EXCL_LINE
@@ -776,35 +1085,32 @@ public:
     /// @return true this basic_node object is less than `rhs`.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/operator_lt/
     bool operator<(const basic_node& rhs) const {
-        if (operator==(rhs)) {
-            return false;
-        }
-
+        // Equal values are detected in the same pass as the ordering, since mapping lookups with basic_node keys call
+        // this function many times.
         const basic_node& lhs = resolve_reference();
         const basic_node& act_rhs = rhs.resolve_reference();
 
         const detail::node_attr_t lhs_val_bit = lhs.m_attrs & detail::node_attr_mask::value;
         const detail::node_attr_t rhs_val_bit = act_rhs.m_attrs & detail::node_attr_mask::value;
 
-        if (lhs_val_bit < rhs_val_bit) {
-            return true;
-        }
-
         if (lhs_val_bit != rhs_val_bit) {
-            return false;
+            return lhs_val_bit < rhs_val_bit;
         }
 
         bool ret = false;
         switch (lhs_val_bit) {
         case detail::node_attr_bits::seq_bit:
-            ret = (*(lhs.m_value.p_seq) < *(act_rhs.m_value.p_seq));
+            ret = (*(lhs.m_value.p_seq) != *(act_rhs.m_value.p_seq)) &&
+                  (*(lhs.m_value.p_seq) < *(act_rhs.m_value.p_seq));
             break;
         case detail::node_attr_bits::map_bit:
-            ret = (*(lhs.m_value.p_map) < *(act_rhs.m_value.p_map));
+            ret = (*(lhs.m_value.p_map) != *(act_rhs.m_value.p_map)) &&
+                  (*(lhs.m_value.p_map) < *(act_rhs.m_value.p_map));
+            break;
+        case detail::node_attr_bits::null_bit:
+            // null nodes are always the same.
+            ret = false;
             break;
-        case detail::node_attr_bits::null_bit: // LCOV_EXCL_LINE
-            // Will not come here since null nodes are always the same.
-            detail::unreachable(); // LCOV_EXCL_LINE
         case detail::node_attr_bits::bool_bit:
             // false < true
             ret = (!lhs.m_value.boolean && act_rhs.m_value.boolean);
@@ -813,10 +1119,14 @@ public:
             ret = (lhs.m_value.integer < act_rhs.m_value.integer);
             break;
         case detail::node_attr_bits::float_bit:
-            ret = (lhs.m_value.float_val < act_rhs.m_value.float_val);
+            // float values within the epsilon are equal. (See operator==() for details.)
+            ret =
+                (std::abs(lhs.m_value.float_val - act_rhs.m_value.float_val) >=
+                 std::numeric_limits<float_number_type>::epsilon()) &&
+                (lhs.m_value.float_val < act_rhs.m_value.float_val);
             break;
         case detail::node_attr_bits::string_bit:
-            ret = (*(lhs.m_value.p_str) < *(act_rhs.m_value.p_str));
+            ret = (lhs.get_str_view_impl() < act_rhs.get_str_view_impl());
             break;
         default:                   // LCOV_EXCL_LINE
             detail::unreachable(); // LCOV_EXCL_LINE
@@ -953,7 +1263,7 @@ public:
         }
         case detail::node_attr_bits::string_bit: {
             FK_YAML_ASSERT(act_node.m_value.p_str != nullptr);
-            return act_node.m_value.p_str->empty();
+            return act_node.get_str_view_impl().empty();
         }
         default:
             throw fkyaml::type_error("The target node is not of a container type.", get_type());
@@ -974,7 +1284,7 @@ public:
             return act_node.m_value.p_map->size();
         case detail::node_attr_bits::string_bit:
             FK_YAML_ASSERT(act_node.m_value.p_str != nullptr);
-            return act_node.m_value.p_str->size();
+            return act_node.get_str_view_impl().size();
         default:
             throw fkyaml::type_error("The target node is not of a container type.", get_type());
         }
@@ -996,7 +1306,7 @@ public:
         if FK_YAML_LIKELY (act_node.m_attrs & detail::node_attr_bits::map_bit) {
             FK_YAML_ASSERT(act_node.m_value.p_map != nullptr);
             const auto& map = *act_node.m_value.p_map;
-            return map.find(std::forward<KeyType>(key)) != map.end();
+            return map.find(make_lookup_key(std::forward<KeyType>(key))) != map.end();
         }
 
         return false;
@@ -1020,7 +1330,7 @@ public:
             throw fkyaml::type_error("at() is unavailable for a scalar node.", get_type());
         }
 
-        basic_node node_key = std::forward<KeyType>(key);
+        basic_node node_key = make_lookup_key(std::forward<KeyType>(key));
 
         if (act_node.is_sequence_impl()) {
             if FK_YAML_UNLIKELY (!node_key.is_integer_impl()) {
@@ -1039,11 +1349,11 @@ public:
 
         FK_YAML_ASSERT(act_node.m_value.p_map != nullptr);
         mapping_type& map = *act_node.m_value.p_map;
-        const bool is_found = map.find(node_key) != map.end();
-        if FK_YAML_UNLIKELY (!is_found) {
+        auto itr = map.find(node_key);
+        if FK_YAML_UNLIKELY (itr == map.end()) {
             throw fkyaml::out_of_range(serialize(node_key).c_str());
         }
-        return map[std::move(node_key)];
+        return itr->second;
     }
 
     /// @brief Get a basic_node object with a key of a compatible type.
@@ -1064,7 +1374,7 @@ public:
             throw fkyaml::type_error("at() is unavailable for a scalar node.", get_type());
         }
 
-        basic_node node_key = std::forward<KeyType>(key);
+        basic_node node_key = make_lookup_key(std::forward<KeyType>(key));
 
         if (act_node.is_sequence_impl()) {
             if FK_YAML_UNLIKELY (!node_key.is_integer()) {
@@ -1083,11 +1393,11 @@ public:
 
         FK_YAML_ASSERT(act_node.m_value.p_map != nullptr);
         const mapping_type& map = *act_node.m_value.p_map;
-        const bool is_found = map.find(node_key) != map.end();
-        if FK_YAML_UNLIKELY (!is_found) {
+        auto itr = map.find(node_key);
+        if FK_YAML_UNLIKELY (itr == map.end()) {
             throw fkyaml::out_of_range(serialize(node_key).c_str());
         }
-        return map.at(std::move(node_key));
+        return itr->second;
     }
 
     /// @brief Get a basic_node object with a basic_node key object.
@@ -1162,19 +1472,103 @@ public:
         return map.at(std::forward<KeyType>(key));
     }
 
+    /// @brief Get a basic_node object with a compiled path.
+    /// @param p A path to the target basic_node object from this basic_node object.
+    /// @return Reference to the basic_node object at the given path.
+    /// @throw fkyaml::type_error A node on the path is a scalar, or a sequence while the segment is not an index.
+    /// @throw fkyaml::out_of_range A key or an index on the path is not found.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/at/
+    basic_node& at(const path& p) {
+        basic_node* p_node = this;
+        for (const detail::path_segment& segment : p.m_segments) {
+            p_node = find_child(*p_node, segment, true);
+        }
+        return *p_node;
+    }
+
+    /// @brief Get a basic_node object with a compiled path.
+    /// @param p A path to the target basic_node object from this basic_node object.
+    /// @return Constant reference to the basic_node object at the given path.
+    /// @throw fkyaml::type_error A node on the path is a scalar, or a sequence while the segment is not an index.
+    /// @throw fkyaml::out_of_range A key or an index on the path is not found.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/at/
+    const basic_node& at(const path& p) const {
+        const basic_node* p_node = this;
+        for (const detail::path_segment& segment : p.m_segments) {
+            p_node = find_child(*p_node, segment, true);
+        }
+        return *p_node;
+    }
+
+    /// @brief Find a basic_node object with a compiled path.
+    /// @param p A path to the target basic_node object from this basic_node object.
+    /// @return Pointer to the basic_node object at the given path, or nullptr if not found.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/find/
+    basic_node* find(const path& p) {
+        basic_node* p_node = this;
+        for (const detail::path_segment& segment : p.m_segments) {
+            p_node = find_child(*p_node, segment, false);
+            if (!p_node) {
+                break;
+            }
+        }
+        return p_node;
+    }
+
+    /// @brief Find a basic_node object with a compiled path.
+    /// @param p A path to the target basic_node object from this basic_node object.
+    /// @return Pointer to the constant basic_node object at the given path, or nullptr if not found.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/find/
+    const basic_node* find(const path& p) const {
+        const basic_node* p_node = this;
+        for (const detail::path_segment& segment : p.m_segments) {
+            p_node = find_child(*p_node, segment, false);
+            if (!p_node) {
+                break;
+            }
+        }
+        return p_node;
+    }
+
+    /// @brief Find basic_node objects with all the paths in a batch. Common prefixes of the paths are traversed once.
+    /// @param paths A batch of paths from this basic_node object.
+    /// @param results Storage for the results, i.e., pointers to the basic_node objects at the paths or nullptr for
+    /// the ones not found, in the order of the paths added to the batch. Its capacity is reused across calls.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/find/
+    void find(const path_batch& paths, std::vector<const basic_node*>& results) const {
+        // The results for all the prefixes are stored first, and then replaced with the ones for the whole paths.
+        const std::size_t num_entries = paths.m_entries.size();
+        results.clear();
+        results.reserve(num_entries + paths.m_ends.size());
+
+        results.push_back(this);
+        for (std::size_t i = 1; i < num_entries; i++) {
+            const auto& entry = paths.m_entries[i];
+            const basic_node* p_parent = results[entry.parent];
+            results.push_back(p_parent ? find_child(*p_parent, entry.segment, false) : nullptr);
+        }
+
+        for (const std::size_t end : paths.m_ends) {
+            results.push_back(results[end]);
+        }
+        results.erase(results.begin(), results.begin() + static_cast<std::ptrdiff_t>(num_entries));
+    }
+
     /// @brief Get the YAML version for this basic_node object.
     /// @return The YAML version if already set, `yaml_version_type::VERSION_1_2` otherwise.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/get_yaml_version_type/
     yaml_version_type get_yaml_version_type() const noexcept {
-        return mp_meta->is_version_specified ? mp_meta->version : yaml_version_type::VERSION_1_2;
+        const auto& p_meta = mp_prop.meta();
+        return (p_meta && p_meta->is_version_specified) ? p_meta->version : yaml_version_type::VERSION_1_2;
     }
 
     /// @brief Set the YAML version for this basic_node object.
     /// @param[in] version The target YAML version.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/set_yaml_version_type/
     void set_yaml_version_type(const yaml_version_type version) noexcept {
-        mp_meta->version = version;
-        mp_meta->is_version_specified = true;
+        detail::document_metainfo<basic_node>& meta = get_or_create_meta();
+        meta.version = version;
+        meta.is_version_specified = true;
     }
 
     /// @brief Get the YAML version for this basic_node object.
@@ -1200,7 +1594,7 @@ public:
     /// @return true if ths basic_node has an anchor name, false otherwise.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/has_anchor_name/
     bool has_anchor_name() const noexcept {
-        return (m_attrs & detail::node_attr_mask::anchoring) && !m_prop.anchor.empty();
+        return (m_attrs & detail::node_attr_mask::anchoring) && !mp_prop.anchor().empty();
     }
 
     /// @brief Get the anchor name associated with this basic_node object.
@@ -1212,7 +1606,7 @@ public:
         if FK_YAML_UNLIKELY (!has_anchor_name()) {
             throw fkyaml::exception("No anchor name has been set.");
         }
-        return m_prop.anchor;
+        return mp_prop.anchor();
     }
 
     /// @brief Add an anchor name to this basic_node object.
@@ -1220,27 +1614,7 @@ public:
     /// @param[in] anchor_name An anchor name. This should not be empty.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/add_anchor_name/
     void add_anchor_name(const std::string& anchor_name) {
-        if (is_anchor()) {
-            m_attrs &= ~detail::node_attr_mask::anchoring;
-            auto itr = mp_meta->anchor_table.equal_range(m_prop.anchor).first;
-            std::advance(itr, detail::node_attr_bits::get_anchor_offset(m_attrs));
-            mp_meta.reset();
-            itr->second.swap(*this);
-            mp_meta->anchor_table.erase(itr);
-        }
-
-        auto p_meta = mp_meta;
-
-        basic_node node;
-        node.swap(*this);
-        p_meta->anchor_table.emplace(anchor_name, std::move(node));
-
-        m_attrs &= ~detail::node_attr_mask::anchoring;
-        m_attrs |= detail::node_attr_bits::anchor_bit;
-        mp_meta = p_meta;
-        const auto offset = static_cast<uint32_t>(mp_meta->anchor_table.count(anchor_name) - 1);
-        detail::node_attr_bits::set_anchor_offset(offset, m_attrs);
-        m_prop.anchor = anchor_name;
+        add_anchor_name(std::string(anchor_name));
     }
 
     /// @brief Add an anchor name to this basic_node object.
@@ -1249,33 +1623,34 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/add_anchor_name/
     void add_anchor_name(std::string&& anchor_name) {
         if (is_anchor()) {
-            m_attrs &= ~detail::node_attr_mask::anchoring;
-            auto itr = mp_meta->anchor_table.equal_range(m_prop.anchor).first;
-            std::advance(itr, detail::node_attr_bits::get_anchor_offset(m_attrs));
-            mp_meta.reset();
-            itr->second.swap(*this);
-            mp_meta->anchor_table.erase(itr);
+            release_anchor_entry();
         }
 
-        auto p_meta = mp_meta;
+        get_or_create_meta();
+        auto p_meta = mp_prop.meta();
 
         basic_node node;
         node.swap(*this);
-        p_meta->anchor_table.emplace(anchor_name, std::move(node));
+        auto itr = p_meta->anchor_table.emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(anchor_name),
+            std::forward_as_tuple(std::move(node), p_meta->structure_version));
 
         m_attrs &= ~detail::node_attr_mask::anchoring;
         m_attrs |= detail::node_attr_bits::anchor_bit;
-        mp_meta = p_meta;
-        auto offset = static_cast<uint32_t>(mp_meta->anchor_table.count(anchor_name) - 1);
+        m_value.p_anchor = &itr->second;
+        m_value.p_anchor->add_ref();
+        auto offset = static_cast<uint32_t>(p_meta->anchor_table.count(anchor_name) - 1);
         detail::node_attr_bits::set_anchor_offset(offset, m_attrs);
-        m_prop.anchor = std::move(anchor_name);
+        mp_prop.set_meta(std::move(p_meta));
+        mp_prop.set_anchor(std::move(anchor_name));
     }
 
     /// @brief Check whether this basic_node object has already had any tag name.
     /// @return true if ths basic_node has a tag name, false otherwise.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/has_tag_name/
     bool has_tag_name() const noexcept {
-        return !m_prop.tag.empty();
+        return !mp_prop.tag().empty();
     }
 
     /// @brief Get the tag name associated with this basic_node object.
@@ -1287,7 +1662,7 @@ public:
         if FK_YAML_UNLIKELY (!has_tag_name()) {
             throw fkyaml::exception("No tag name has been set.");
         }
-        return m_prop.tag;
+        return mp_prop.tag();
     }
 
     /// @brief Get the resolved tag name associated with this basic_node object.
@@ -1300,7 +1675,8 @@ public:
             throw fkyaml::exception("No tag name has been set.");
         }
 
-        const auto& tag = m_prop.tag;
+        const auto& tag = mp_prop.tag();
+        const auto& p_meta = mp_prop.meta();
 
         // non-specific tag
         if (tag == "!") {
@@ -1309,16 +1685,18 @@ public:
 
         // secondary tag handle
         if (tag.rfind("!!", 0) == 0) {
-            if (mp_meta->secondary_handle_prefix.empty()) {
+            if (!p_meta || p_meta->secondary_handle_prefix.empty()) {
                 return "tag:yaml.org,2002:" + tag.substr(2);
             }
-            return mp_meta->secondary_handle_prefix + tag.substr(2);
+            return p_meta->secondary_handle_prefix + tag.substr(2);
         }
 
         // named handles
-        for (const auto& named_handle_itr : mp_meta->named_handle_map) {
-            if (tag.rfind(named_handle_itr.first, 0) == 0) {
-                return named_handle_itr.second + tag.substr(named_handle_itr.first.size());
+        if (p_meta) {
+            for (const auto& named_handle_itr : p_meta->named_handle_map) {
+                if (tag.rfind(named_handle_itr.first, 0) == 0) {
+                    return named_handle_itr.second + tag.substr(named_handle_itr.first.size());
+                }
             }
         }
 
@@ -1332,10 +1710,10 @@ public:
         }
 
         // primary tag handle
-        if (mp_meta->primary_handle_prefix.empty()) {
+        if (!p_meta || p_meta->primary_handle_prefix.empty()) {
             return "!" + tag.substr(1);
         }
-        return mp_meta->primary_handle_prefix + tag.substr(1);
+        return p_meta->primary_handle_prefix + tag.substr(1);
     }
 
     /// @brief Add a tag name to this basic_node object.
@@ -1343,7 +1721,7 @@ public:
     /// @param[in] tag_name A tag name to get associated with this basic_node object.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/add_tag_name/
     void add_tag_name(const std::string& tag_name) {
-        m_prop.tag = tag_name;
+        mp_prop.set_tag(tag_name);
     }
 
     /// @brief Add a tag name to this basic_node object.
@@ -1351,7 +1729,7 @@ public:
     /// @param[in] tag_name A tag name to get associated with this basic_node object.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/add_tag_name/
     void add_tag_name(std::string&& tag_name) {
-        m_prop.tag = std::move(tag_name);
+        mp_prop.set_tag(std::move(tag_name));
     }
 
     /// @brief Get the node value object converted into a given type.
@@ -1636,38 +2014,114 @@ public:
     string_type& as_str() {
         basic_node& act_node = resolve_reference();
         if FK_YAML_LIKELY (act_node.is_string_impl()) {
+            act_node.own_borrowed_str();
             return *act_node.m_value.p_str;
         }
         throw fkyaml::type_error("The node value is not a string.", get_type());
     }
 
     /// @brief Returns reference to the string node value.
-    /// @throw fkyaml::type_error The node value is not a string.
+    /// @note A const node never makes an owned copy of a string which refers to the input of deserialize_borrowed().
+    /// Use get_str_view() to read such a string through a const node.
+    /// @throw fkyaml::type_error The node value is not a string, or it refers to the input.
     /// @return Constant reference to the string node value.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/as_str/
     const string_type& as_str() const {
         const basic_node& act_node = resolve_reference();
         if FK_YAML_LIKELY (act_node.is_string_impl()) {
+            if FK_YAML_UNLIKELY (act_node.m_attrs & detail::node_attr_bits::borrowed_str_bit) {
+                throw fkyaml::type_error(
+                    "The string node value refers to the input. Use get_str_view() for const nodes.", get_type());
+            }
             return *act_node.m_value.p_str;
         }
         throw fkyaml::type_error("The node value is not a string.", get_type());
     }
 
+    /// @brief Returns a view into the string node value.
+    /// @note Unlike as_str(), this never makes an owned copy of a string which refers to the input of
+    /// deserialize_borrowed(), so const nodes can be read concurrently.
+    /// @throw fkyaml::type_error The node value is not a string.
+    /// @return A view into the string node value.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/get_str_view/
+    detail::str_view get_str_view() const {
+        const basic_node& act_node = resolve_reference();
+        if FK_YAML_LIKELY (act_node.is_string_impl()) {
+            return act_node.get_str_view_impl();
+        }
+        throw fkyaml::type_error("The node value is not a string.", get_type());
+    }
+
+    /// @brief Turns the container and string values of this node and its descendants into values shared among copies.
+    /// @note
+    /// After this call, a copy of this node refers to the same values instead of copying them deeply. A shared value
+    /// is copied when it is accessed for modification through a non-const API (e.g., operator[], as_seq() or
+    /// as_map()) while other copies still refer to it, and only the modified path gets copied in that case.
+    /// References obtained through non-const APIs must not be used to modify a value once the node has been copied.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/enable_copy_on_write/
+    void enable_copy_on_write() {
+        if FK_YAML_UNLIKELY (has_anchor_name()) {
+            // Copies of anchor/alias nodes already refer to the same anchored node.
+            return;
+        }
+
+        const bool is_shared = m_attrs & detail::node_attr_bits::shared_bit;
+        switch (m_attrs & detail::node_attr_mask::value) {
+        case detail::node_attr_bits::seq_bit:
+            if (is_shared && !detail::is_unique_shared_value(m_value.p_seq)) {
+                // Other copies may be reading the value.
+                return;
+            }
+            for (basic_node& elem : *m_value.p_seq) {
+                elem.enable_copy_on_write();
+            }
+            if (!is_shared) {
+                m_value.p_seq = detail::make_shared_value(m_value.p_seq);
+            }
+            break;
+        case detail::node_attr_bits::map_bit:
+            if (is_shared && !detail::is_unique_shared_value(m_value.p_map)) {
+                // Other copies may be reading the value.
+                return;
+            }
+            for (auto& entry : *m_value.p_map) {
+                entry.second.enable_copy_on_write();
+            }
+            if (!is_shared) {
+                m_value.p_map = detail::make_shared_value(m_value.p_map);
+            }
+            break;
+        case detail::node_attr_bits::string_bit:
+            if (is_shared || (m_attrs & detail::node_attr_bits::borrowed_str_bit)) {
+                // Copies of a borrowed string already refer to the same input buffer.
+                return;
+            }
+            m_value.p_str = detail::make_shared_value(m_value.p_str);
+            break;
+        default:
+            // Copying scalars other than strings costs no allocation.
+            return;
+        }
+
+        m_attrs |= detail::node_attr_bits::shared_bit;
+    }
+
     /// @brief Swaps the internally stored data with the specified basic_node object.
     /// @param[in] rhs A basic_node object to be swapped with.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/swap/
     void swap(basic_node& rhs) noexcept {
+        notify_structure_change();
+        rhs.notify_structure_change();
+
         using std::swap;
         swap(m_attrs, rhs.m_attrs);
-        swap(mp_meta, rhs.mp_meta);
+        swap(m_borrowed_str_len, rhs.m_borrowed_str_len);
+        mp_prop.swap(rhs.mp_prop);
 
         node_value tmp {};
         std::memcpy(&tmp, &m_value, sizeof(node_value));
         std::memcpy(&m_value, &rhs.m_value, sizeof(node_value));
         std::memcpy(&rhs.m_value, &tmp, sizeof(node_value));
-
-        swap(m_prop.tag, rhs.m_prop.tag);
-        swap(m_prop.anchor, rhs.m_prop.anchor);
     }
 
     /// @brief Returns an iterator to the first element of a container node (sequence or mapping).
@@ -1860,74 +2314,181 @@ public:
 private:
     /// @brief Resolves anchor/alias reference and returns reference to an actual value node.
     /// @return Reference to an actual value node.
+    /// @note The resulting node gets its own value if the value has been shared with other copies, since the caller
+    /// may modify the value through the reference. (copy-on-write)
     basic_node& resolve_reference() {
+        basic_node* p_act_node = this;
         if FK_YAML_UNLIKELY (has_anchor_name()) {
-            auto itr = mp_meta->anchor_table.equal_range(m_prop.anchor).first;
-            auto offset = detail::node_attr_bits::get_anchor_offset(m_attrs);
-            std::advance(itr, offset);
-            auto& anchor = itr->second;
-
-            // Checks for cyclic references in the child nodes of the anchor node.
-            // If it does, throws an exception to prevent infinite recursion and stack overflow.
-            const bool contains_self_ref = anchor.contains_self_referential_alias(m_prop.anchor, offset);
-            if FK_YAML_UNLIKELY (contains_self_ref) {
-                throw fkyaml::exception("Cyclic reference detected during anchor/alias resolving.");
+            FK_YAML_ASSERT(m_value.p_anchor != nullptr);
+            const anchor_entry_type& entry = *m_value.p_anchor;
+            if FK_YAML_UNLIKELY (!entry.is_verified()) {
+                verify_anchor_entry(entry);
             }
+            p_act_node = &m_value.p_anchor->node;
+        }
+        if FK_YAML_UNLIKELY (p_act_node->m_attrs & detail::node_attr_bits::shared_bit) {
+            p_act_node->unshare_value();
+        }
+        return *p_act_node;
+    }
 
-            return anchor;
+    /// @brief Replaces the shared value of this node with a copy of its own if other nodes also refer to the value.
+    /// @note
+    /// The copy is a shared value as well, so that copies of this node made later keep sharing it. Only the top-level
+    /// value is copied since the child nodes share their values in turn.
+    void unshare_value() {
+        FK_YAML_ASSERT(m_attrs & detail::node_attr_bits::shared_bit);
+        switch (m_attrs & detail::node_attr_mask::value) {
+        case detail::node_attr_bits::seq_bit:
+            if (!detail::is_unique_shared_value(m_value.p_seq)) {
+                sequence_type* p_seq = detail::clone_shared_value(m_value.p_seq);
+                detail::release_shared_value(m_value.p_seq);
+                m_value.p_seq = p_seq;
+            }
+            break;
+        case detail::node_attr_bits::map_bit:
+            if (!detail::is_unique_shared_value(m_value.p_map)) {
+                mapping_type* p_map = detail::clone_shared_value(m_value.p_map);
+                detail::release_shared_value(m_value.p_map);
+                m_value.p_map = p_map;
+            }
+            break;
+        case detail::node_attr_bits::string_bit:
+            if (!detail::is_unique_shared_value(m_value.p_str)) {
+                string_type* p_str = detail::clone_shared_value(m_value.p_str);
+                detail::release_shared_value(m_value.p_str);
+                m_value.p_str = p_str;
+            }
+            break;
+        default:                   // LCOV_EXCL_LINE
+            detail::unreachable(); // LCOV_EXCL_LINE
         }
-        return *this;
     }
 
     /// @brief Resolves anchor/alias reference and returns const reference to an actual value node.
     /// @return Const reference to an actual value node.
     const basic_node& resolve_reference() const {
         if FK_YAML_UNLIKELY (has_anchor_name()) {
-            auto itr = mp_meta->anchor_table.equal_range(m_prop.anchor).first;
-            auto offset = detail::node_attr_bits::get_anchor_offset(m_attrs);
-            std::advance(itr, offset);
-            const auto& anchor = itr->second;
-
-            // Checks for cyclic references in the child nodes of the anchor node.
-            // If it does, throws an exception to prevent infinite recursion and stack overflow.
-            const bool contains_self_ref = anchor.contains_self_referential_alias(m_prop.anchor, offset);
-            if FK_YAML_UNLIKELY (contains_self_ref) {
-                throw fkyaml::exception("Cyclic reference detected during anchor/alias resolving.");
+            FK_YAML_ASSERT(m_value.p_anchor != nullptr);
+            const anchor_entry_type& entry = *m_value.p_anchor;
+            if FK_YAML_UNLIKELY (!entry.is_verified()) {
+                verify_anchor_entry(entry);
             }
-
-            return anchor;
+            return m_value.p_anchor->node;
         }
         return *this;
     }
 
-    /// @brief Checks if this node contains any alias node which references itself in its child nodes, which would cause
-    /// infinite recursion and then stack overflow.
-    ///
-    /// @param anchor_name The anchor name of the node to check.
-    /// @param anchor_offset The anchor offset of the node to check.
-    bool contains_self_referential_alias(const std::string& anchor_name, uint32_t anchor_offset) const {
+    /// @brief Checks for cyclic references in the child nodes of the anchored node and caches the result.
+    /// @note The check is skipped while the cached result is valid. See anchor_table_entry for details.
+    /// @param entry The anchor table entry to be verified.
+    static void verify_anchor_entry(const anchor_entry_type& entry) {
+        if FK_YAML_UNLIKELY (entry.is_released) {
+            throw fkyaml::exception("The anchor referenced by an alias node has been renamed.");
+        }
+
+        // Obtain the version in advance so that changes made during the check would invalidate the result.
+        const std::size_t version = entry.current_structure_version();
+
+        // Throws an exception to prevent infinite recursion and stack overflow.
+        const bool contains_self_ref = entry.node.contains_self_referential_alias(entry);
+        if FK_YAML_UNLIKELY (contains_self_ref) {
+            throw fkyaml::exception("Cyclic reference detected during anchor/alias resolving.");
+        }
+
+        entry.mark_verified(version);
+    }
+
+    /// @brief Invalidates the cached results of cyclic reference checks in the document of this node if this node can
+    /// introduce cyclic references, i.e., this node is an anchor/alias node or a non-empty container node.
+    void notify_structure_change() const noexcept {
+        const bool is_container = m_attrs & (detail::node_attr_bits::seq_bit | detail::node_attr_bits::map_bit);
+        const bool is_anchoring = m_attrs & detail::node_attr_mask::anchoring;
+        if (!is_container && !is_anchoring) {
+            return;
+        }
+
+        const auto& p_meta = mp_prop.meta();
+        if (p_meta) {
+            p_meta->notify_structure_change();
+            return;
+        }
+
+        // Empty container nodes hold no anchor/alias node.
+        const bool is_empty = is_container && ((m_attrs & detail::node_attr_bits::seq_bit) ? m_value.p_seq->empty()
+                                                                                         : m_value.p_map->empty());
+        if (!is_empty) {
+            anchor_entry_type::notify_detached_structure_change();
+        }
+    }
+
+    /// @brief Takes the anchored node back from the anchor table entry of this anchor node.
+    /// @note
+    /// The entry is erased if no alias node refers to it. Otherwise, the entry is marked as released so that resolving
+    /// the remaining alias nodes fails, and it gets erased by a later call once they are all gone.
+    void release_anchor_entry() {
+        anchor_entry_type& entry = *m_value.p_anchor;
+        const auto p_meta = mp_prop.meta();
+        const std::string anchor_name = mp_prop.anchor();
+
+        m_attrs &= ~detail::node_attr_mask::anchoring;
+        m_value.p_map = nullptr;
+        mp_prop.set_meta(nullptr);
+        entry.node.swap(*this);
+
+        auto& anchor_table = p_meta->anchor_table;
+        if (p_meta->num_released_anchors > 0) {
+            for (auto itr = anchor_table.begin(); itr != anchor_table.end();) {
+                if (itr->second.is_released && !itr->second.is_referenced()) {
+                    itr = anchor_table.erase(itr);
+                    --p_meta->num_released_anchors;
+                }
+                else {
+                    ++itr;
+                }
+            }
+        }
+
+        if (entry.remove_ref()) {
+            auto range = anchor_table.equal_range(anchor_name);
+            while (&range.first->second != &entry) {
+                ++range.first;
+            }
+            anchor_table.erase(range.first);
+        }
+        else {
+            entry.release();
+            ++p_meta->num_released_anchors;
+        }
+    }
+
+    /// @brief Checks if this node contains any anchor/alias node which references the given anchor table entry in its
+    /// child nodes, which would cause infinite recursion and then stack overflow.
+    /// @param entry The anchor table entry which holds this node.
+    /// @return true if a self-referential anchor/alias node is found, false otherwise.
+    bool contains_self_referential_alias(const anchor_entry_type& entry) const {
         std::vector<const basic_node*> stack {this};
         while (!stack.empty()) {
             const auto* node = stack.back();
             stack.pop_back();
-            if (node->is_alias()) {
-                const auto& alias = *node;
-                const bool references_self =
-                    (alias.get_anchor_name() == anchor_name &&
-                     detail::node_attr_bits::get_anchor_offset(alias.m_attrs) == anchor_offset);
-                if (references_self) {
+            if (node->m_attrs & detail::node_attr_mask::anchoring) {
+                if (node->m_value.p_anchor == &entry) {
                     return true;
                 }
+                if (node->is_alias()) {
+                    continue;
+                }
             }
-            else if (node->is_sequence()) {
+
+            if (node->is_sequence()) {
                 for (const auto& child : node->as_seq()) {
                     stack.push_back(&child);
                 }
             }
             else if (node->is_mapping()) {
-                for (const auto& entry : node->as_map()) {
-                    stack.push_back(&entry.first);
-                    stack.push_back(&entry.second);
+                for (const auto& pair : node->as_map()) {
+                    stack.push_back(&pair.first);
+                    stack.push_back(&pair.second);
                 }
             }
         }
@@ -1935,6 +2496,15 @@ private:
         return false;
     }
 
+    /// @brief Returns the document metainfo of this node. A new one is allocated if none has been assigned yet.
+    /// @return Reference to the document metainfo of this node.
+    detail::document_metainfo<basic_node>& get_or_create_meta() {
+        if (!mp_prop.meta()) {
+            mp_prop.set_meta(std::make_shared<detail::document_metainfo<basic_node>>());
+        }
+        return *mp_prop.meta();
+    }
+
     bool is_sequence_impl() const noexcept {
         return m_attrs & detail::node_attr_bits::seq_bit;
     }
@@ -1969,6 +2539,162 @@ private:
         return m_attrs & detail::node_attr_bits::string_bit;
     }
 
+    /// @brief Get view into the string node value without turning a borrowed string into an owned one.
+    /// @note This node must be a string node and must not be an anchor or alias node.
+    /// @return View into the string node value.
+    detail::str_view get_str_view_impl() const noexcept {
+        FK_YAML_ASSERT(is_string_impl());
+        if (m_attrs & detail::node_attr_bits::borrowed_str_bit) {
+            return {m_value.p_borrowed_str, m_borrowed_str_len};
+        }
+        return {m_value.p_str->data(), m_value.p_str->size()};
+    }
+
+    /// @brief Turn a borrowed string node value, if any, into an owned string object.
+    void own_borrowed_str() {
+        if FK_YAML_UNLIKELY (m_attrs & detail::node_attr_bits::borrowed_str_bit) {
+            m_value.p_str = detail::create_object<string_type>(m_value.p_borrowed_str, m_borrowed_str_len);
+            m_attrs &= ~detail::node_attr_bits::borrowed_str_bit;
+        }
+    }
+
+    /// @brief Finds the child node of the given node with a path segment.
+    /// @tparam NodeType basic_node or const basic_node.
+    /// @param node A parent node, which may be an anchor or alias node.
+    /// @param segment A path segment to select the child node with.
+    /// @param throws_if_missing Whether to throw an exception just like at() if the child node is not found.
+    /// @return Pointer to the child node, or nullptr if it is not found and throws_if_missing is false.
+    template <typename NodeType>
+    static NodeType* find_child(NodeType& node, const detail::path_segment& segment, bool throws_if_missing) {
+        // Bind containers of a const node to const references so that the const path never modifies them.
+        using seq_ref_type =
+            typename std::conditional<std::is_const<NodeType>::value, const sequence_type&, sequence_type&>::type;
+        using map_ref_type =
+            typename std::conditional<std::is_const<NodeType>::value, const mapping_type&, mapping_type&>::type;
+
+        NodeType& act_node = node.resolve_reference();
+
+        if (act_node.is_sequence_impl()) {
+            FK_YAML_ASSERT(act_node.m_value.p_seq != nullptr);
+            seq_ref_type seq = *act_node.m_value.p_seq;
+            if FK_YAML_LIKELY (segment.has_index && segment.index < seq.size()) {
+                return &seq[segment.index];
+            }
+
+            if (throws_if_missing) {
+                if (!segment.has_index) {
+                    throw fkyaml::type_error(
+                        "An argument of at() for sequence nodes must be an integer.", act_node.get_type());
+                }
+                throw fkyaml::out_of_range(static_cast<int>(segment.index));
+            }
+            return nullptr;
+        }
+
+        if (act_node.is_mapping_impl()) {
+            FK_YAML_ASSERT(act_node.m_value.p_map != nullptr);
+            map_ref_type map = *act_node.m_value.p_map;
+            // Each segment looks up only one key, which is never found if it is out of the range of indices.
+            auto itr = map.end();
+            if (!segment.is_integer_key) {
+                itr = map.find(make_lookup_key(segment.key));
+            }
+            else if FK_YAML_LIKELY (segment.has_index) {
+                itr = map.find(make_lookup_key(static_cast<integer_type>(segment.index)));
+            }
+            if FK_YAML_LIKELY (itr != map.end()) {
+                return &itr->second;
+            }
+
+            if (throws_if_missing) {
+                throw fkyaml::out_of_range(segment.key.c_str());
+            }
+            return nullptr;
+        }
+
+        if (throws_if_missing) {
+            throw fkyaml::type_error("at() is unavailable for a scalar node.", act_node.get_type());
+        }
+        return nullptr;
+    }
+
+    /// @brief Makes a key node to look up mapping entries with a string-like key.
+    /// @note
+    /// The key node borrows the characters of the given key so that no memory is allocated. It must therefore be
+    /// turned into an owned one with own_borrowed_str() before being inserted to a mapping.
+    /// @tparam KeyType A string-like key type.
+    /// @param key A key to look up mapping entries with.
+    /// @return A key node which refers to the characters of the given key.
+    template <
+        typename KeyType, detail::enable_if_t<
+                              detail::conjunction<
+                                  detail::is_str_view_key<KeyType>, std::is_constructible<string_type, KeyType>>::value,
+                              int> = 0>
+    static basic_node make_lookup_key(KeyType&& key) {
+        const detail::str_view key_view = get_key_str_view(key);
+        if FK_YAML_UNLIKELY (key_view.size() > std::numeric_limits<uint32_t>::max()) {
+            return basic_node(std::forward<KeyType>(key));
+        }
+
+        basic_node key_node;
+        detail::external_node_constructor<basic_node>::borrowed_string_scalar(
+            key_node, key_view.data(), static_cast<uint32_t>(key_view.size()));
+        return key_node;
+    }
+
+    /// @brief Makes a key node to look up mapping entries with a key of any other compatible type.
+    /// @note Keys of the other scalar types (e.g., integers) are converted without allocating memory.
+    /// @tparam KeyType A key type compatible with basic_node.
+    /// @param key A key to look up mapping entries with.
+    /// @return A key node converted from the given key.
+    template <
+        typename KeyType,
+        detail::enable_if_t<
+            detail::conjunction<
+                detail::negation<std::is_same<detail::remove_cvref_t<KeyType>, basic_node>>,
+                detail::negation<detail::conjunction<
+                    detail::is_str_view_key<KeyType>, std::is_constructible<string_type, KeyType>>>>::value,
+            int> = 0>
+    static basic_node make_lookup_key(KeyType&& key) {
+        return basic_node(std::forward<KeyType>(key));
+    }
+
+    /// @brief Passes through a basic_node key as it is.
+    /// @param key A key to look up mapping entries with.
+    /// @return Constant reference to the given key.
+    static const basic_node& make_lookup_key(const basic_node& key) noexcept {
+        return key;
+    }
+
+    /// @brief Gets a view of the characters of a null-terminated key.
+    /// @param key A null-terminated key.
+    /// @return A view of the characters of the given key.
+    static detail::str_view get_key_str_view(const char* key) noexcept {
+        return key;
+    }
+
+    /// @brief Gets a view of the characters of a std::string key.
+    /// @param key A std::string key.
+    /// @return A view of the characters of the given key.
+    static detail::str_view get_key_str_view(const std::string& key) noexcept {
+        return key;
+    }
+
+    /// @brief Finds the value associated with the given key, or inserts a default one if the key is not found.
+    /// @param map A mapping node value.
+    /// @param key_node A key node made by make_lookup_key().
+    /// @return Reference to the value associated with the given key.
+    static basic_node& find_or_insert(mapping_type& map, basic_node&& key_node) {
+        auto itr = map.find(key_node);
+        if FK_YAML_LIKELY (itr != map.end()) {
+            return itr->second;
+        }
+
+        // The key node must not keep referring to the caller's characters once it is stored in the mapping.
+        key_node.own_borrowed_str();
+        return map[std::move(key_node)];
+    }
+
     bool is_scalar_impl() const noexcept {
         return m_attrs & detail::node_attr_bits::scalar_bits;
     }
@@ -2071,14 +2797,15 @@ private:
 
     /// The current node attributes.
     detail::node_attr_t m_attrs {detail::node_attr_bits::default_bits};
-    /// The shared set of YAML directives applied to this node.
-    mutable std::shared_ptr<detail::document_metainfo<basic_node>> mp_meta {
-        // NOLINTNEXTLINE(bugprone-unhandled-exception-at-new)
-        std::shared_ptr<detail::document_metainfo<basic_node>>(new detail::document_metainfo<basic_node>())};
+    /// The length of a borrowed string value. This occupies what would otherwise be padding after m_attrs.
+    uint32_t m_borrowed_str_len {0};
     /// The current node value.
     node_value m_value {};
-    /// The property set of this node.
-    detail::node_property m_prop {};
+    /// The property set of this node, i.e., the tag name, the anchor name and the shared set of YAML directives.
+    /// @note
+    /// This is null until either a deserializer shares the property set of the document this node belongs to, or any
+    /// property is set to this node, so that standalone nodes cost no extra heap allocation.
+    detail::node_property_ptr<basic_node> mp_prop {};
 };
 
 /// @brief Swap function for basic_node objects.
@@ -2109,8 +2836,8 @@ inline std::ostream& operator<<(
     std::ostream& os,
     const basic_node<SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>&
         n) {
-    os << basic_node<SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>::
-            serialize(n);
+    basic_node<SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>::
+        serialize(n, os);
     return os;
 }
 
@@ -2213,7 +2940,6 @@ struct hash<fkyaml::basic_node<
         using boolean_type = typename node_t::boolean_type;
         using integer_type = typename node_t::integer_type;
         using float_number_type = typename node_t::float_number_type;
-        using string_type = typename node_t::string_type;
 
         const auto type = n.get_type();
 
@@ -2249,7 +2975,7 @@ struct hash<fkyaml::basic_node<
             hash_combine(seed, std::hash<float_number_type>()(n.template get_value<float_number_type>()));
             return seed;
         case fkyaml::node_type::STRING:
-            hash_combine(seed, std::hash<string_type>()(n.template get_value<string_type>()));
+            hash_combine(seed, hash_str(n.resolve_reference()));
             return seed;
         default:                           // LCOV_EXCL_LINE
             fkyaml::detail::unreachable(); // LCOV_EXCL_LINE
@@ -2257,6 +2983,40 @@ struct hash<fkyaml::basic_node<
     }
 
 private:
+    /// @brief Hashes a string node value without turning a borrowed string into an owned one.
+    /// @note Owned and borrowed strings are hashed over their characters in the same way so that equal values have
+    /// the same hash value.
+    static std::size_t hash_str(const node_t& n) noexcept {
+        if (n.m_attrs & fkyaml::detail::node_attr_bits::borrowed_str_bit) {
+            return hash_chars(n.m_value.p_borrowed_str, n.m_borrowed_str_len);
+        }
+        const auto& str = *n.m_value.p_str;
+        return hash_chars(str.data(), str.size());
+    }
+
+    /// @brief Hashes characters in place.
+    /// @param p_chars The beginning of the characters.
+    /// @param len The number of the characters.
+    /// @return The hash value of the characters.
+#ifdef FK_YAML_HAS_CXX_17
+    static std::size_t hash_chars(const char* p_chars, std::size_t len) noexcept {
+        return std::hash<std::string_view>()(std::string_view(p_chars, len));
+    }
+#else
+    // FNV-1a
+    FK_YAML_NO_SANITIZE("unsigned-integer-overflow")
+    static std::size_t hash_chars(const char* p_chars, std::size_t len) noexcept {
+        const bool is_64bit = sizeof(std::size_t) > 4;
+        std::size_t seed = is_64bit ? static_cast<std::size_t>(14695981039346656037ull) : 2166136261u;
+        const std::size_t prime = is_64bit ? static_cast<std::size_t>(1099511628211ull) : 16777619u;
+        for (std::size_t i = 0; i < len; i++) {
+            seed ^= static_cast<std::size_t>(static_cast<unsigned char>(p_chars[i]));
+            seed *= prime;
+        }
+        return seed;
+    }
+#endif
+
     // taken from boost::hash_combine
     FK_YAML_NO_SANITIZE("unsigned-shift-base", "unsigned-integer-overflow")
     static void hash_combine(std::size_t& seed, std::size_t v) {
@@ -0,0 +1,292 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_NODE_ARENA_HPP
+#define FK_YAML_NODE_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/detail/assert.hpp>
+#include <fkYAML/fkyaml_fwd.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A monotonic memory arena for node values.
+/// @note Memory is handed out from chunks which grow geometrically, and is not reused until release() gets called
+/// or the arena gets destroyed. All the objects allocated from an arena must not be used after that.
+/// @note This class is not thread-safe.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+class node_arena {
+public:
+    /// The default byte size of the first chunk.
+    static constexpr std::size_t default_initial_chunk_size = 4096;
+
+    /// @brief Construct a new node_arena object.
+    /// @param initial_chunk_size The byte size of the first chunk.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+    explicit node_arena(std::size_t initial_chunk_size = default_initial_chunk_size) noexcept
+        : m_next_chunk_size(initial_chunk_size > 0 ? initial_chunk_size : default_initial_chunk_size) {
+    }
+
+    // Allocators keep pointers to an arena. So, neither copy nor move is allowed.
+    node_arena(const node_arena&) = delete;
+    node_arena(node_arena&&) = delete;
+    node_arena& operator=(const node_arena&) = delete;
+    node_arena& operator=(node_arena&&) = delete;
+
+    /// @brief Destroy the node_arena object and release all the chunks.
+    ~node_arena() {
+        release();
+    }
+
+public:
+    /// @brief Allocate memory from this arena.
+    /// @param size The byte size of memory to be allocated.
+    /// @param alignment The alignment of memory to be allocated. Must be a power of 2.
+    /// @return The pointer to the allocated memory.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+    void* allocate(std::size_t size, std::size_t alignment) {
+        FK_YAML_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+        std::uintptr_t aligned = align_up(reinterpret_cast<std::uintptr_t>(mp_current), alignment);
+        if FK_YAML_UNLIKELY (mp_current == nullptr || size > reinterpret_cast<std::uintptr_t>(mp_end) - aligned) {
+            add_chunk(size, alignment);
+            aligned = align_up(reinterpret_cast<std::uintptr_t>(mp_current), alignment);
+        }
+
+        mp_current = reinterpret_cast<char*>(aligned + size);
+        m_allocated_bytes += size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /// @brief Release all the chunks at once. All the memory allocated from this arena gets invalidated.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+    void release() noexcept {
+        while (mp_chunks != nullptr) {
+            chunk_header* p_next = mp_chunks->p_next;
+            ::operator delete(mp_chunks);
+            mp_chunks = p_next;
+        }
+        mp_current = nullptr;
+        mp_end = nullptr;
+        m_allocated_bytes = 0;
+    }
+
+    /// @brief Get the total byte size of memory allocated from this arena since the last release.
+    /// @return The total byte size of allocated memory.
+    /// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+    std::size_t allocated_bytes() const noexcept {
+        return m_allocated_bytes;
+    }
+
+private:
+    /// @brief The header placed at the beginning of each chunk.
+    struct chunk_header {
+        /// The previously allocated chunk.
+        chunk_header* p_next;
+    };
+
+    /// @brief Round up an address to the given alignment.
+    /// @param addr An address.
+    /// @param alignment An alignment. Must be a power of 2.
+    /// @return The aligned address.
+    static std::uintptr_t align_up(std::uintptr_t addr, std::size_t alignment) noexcept {
+        return (addr + (alignment - 1)) & ~static_cast<std::uintptr_t>(alignment - 1);
+    }
+
+    /// @brief Allocate a new chunk which can hold at least `size` bytes with the given alignment.
+    /// @param size The byte size of memory to be allocated.
+    /// @param alignment The alignment of memory to be allocated.
+    void add_chunk(std::size_t size, std::size_t alignment) {
+        const std::size_t max_payload_size = std::numeric_limits<std::size_t>::max() - sizeof(chunk_header);
+        if FK_YAML_UNLIKELY (size > max_payload_size - alignment) {
+            throw std::bad_alloc();
+        }
+
+        std::size_t chunk_size = m_next_chunk_size;
+        const std::size_t required_size = sizeof(chunk_header) + alignment + size;
+        if (chunk_size < required_size) {
+            chunk_size = required_size;
+        }
+
+        auto* p_chunk = static_cast<chunk_header*>(::operator new(chunk_size));
+        p_chunk->p_next = mp_chunks;
+        mp_chunks = p_chunk;
+
+        char* p_chunk_begin = reinterpret_cast<char*>(p_chunk);
+        mp_current = p_chunk_begin + sizeof(chunk_header);
+        mp_end = p_chunk_begin + chunk_size;
+
+        if (m_next_chunk_size <= std::numeric_limits<std::size_t>::max() / 2) {
+            m_next_chunk_size *= 2;
+        }
+    }
+
+private:
+    /// The most recently allocated chunk.
+    chunk_header* mp_chunks {nullptr};
+    /// The beginning of the unused memory in the current chunk.
+    char* mp_current {nullptr};
+    /// The end of the current chunk.
+    char* mp_end {nullptr};
+    /// The byte size of the next chunk.
+    std::size_t m_next_chunk_size {default_initial_chunk_size};
+    /// The total byte size of allocated memory.
+    std::size_t m_allocated_bytes {0};
+};
+
+FK_YAML_NAMESPACE_END
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief Get the reference to the pointer to the arena which is active in the current thread.
+/// @return The reference to the pointer to the active arena. The pointer is null if no arena is active.
+inline node_arena*& active_node_arena() noexcept {
+    static thread_local node_arena* p_arena = nullptr;
+    return p_arena;
+}
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief An RAII helper which activates a node_arena in the current thread while it's alive.
+/// @note Allocators default-constructed while an arena is active allocate memory from the arena.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+class arena_scope {
+public:
+    /// @brief Construct a new arena_scope object and activate the given arena.
+    /// @param arena The arena to be activated in the current thread.
+    explicit arena_scope(node_arena& arena) noexcept
+        : mp_prev(detail::active_node_arena()) {
+        detail::active_node_arena() = &arena;
+    }
+
+    arena_scope(const arena_scope&) = delete;
+    arena_scope(arena_scope&&) = delete;
+    arena_scope& operator=(const arena_scope&) = delete;
+    arena_scope& operator=(arena_scope&&) = delete;
+
+    /// @brief Destroy the arena_scope object and re-activate the previously active arena if any.
+    ~arena_scope() {
+        detail::active_node_arena() = mp_prev;
+    }
+
+private:
+    /// The arena which was active before this scope.
+    node_arena* mp_prev {nullptr};
+};
+
+/// @brief An allocator which allocates memory from a node_arena if available, or from the heap otherwise.
+/// @note Like std::pmr::polymorphic_allocator, the memory resource is never propagated on container assignments and
+/// swaps, and copied containers use the arena active at the time of the copy.
+/// @tparam T The type of objects to be allocated.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_arena/
+template <typename T>
+class arena_allocator {
+public:
+    /// The type of objects to be allocated.
+    using value_type = T;
+    /// The type for sizes.
+    using size_type = std::size_t;
+    /// The type for pointer differences.
+    using difference_type = std::ptrdiff_t;
+    /// Whether the arena is propagated on container copy assignments.
+    using propagate_on_container_copy_assignment = std::false_type;
+    /// Whether the arena is propagated on container move assignments.
+    using propagate_on_container_move_assignment = std::false_type;
+    /// Whether the arena is propagated on container swaps.
+    using propagate_on_container_swap = std::false_type;
+
+    /// @brief Construct a new arena_allocator object with the arena active in the current thread if any.
+    arena_allocator() noexcept
+        : mp_arena(detail::active_node_arena()) {
+    }
+
+    /// @brief Construct a new arena_allocator object with the given arena.
+    /// @param p_arena The pointer to an arena. If null, memory is allocated from the heap.
+    explicit arena_allocator(node_arena* p_arena) noexcept
+        : mp_arena(p_arena) {
+    }
+
+    /// @brief Construct a new arena_allocator object which shares the arena of another allocator.
+    /// @tparam U The type of objects allocated by the other allocator.
+    /// @param other The other allocator.
+    template <typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept // NOLINT(google-explicit-constructor)
+        : mp_arena(other.arena()) {
+    }
+
+public:
+    /// @brief Allocate memory for `n` objects.
+    /// @param n The number of objects.
+    /// @return The pointer to the allocated memory.
+    T* allocate(std::size_t n) {
+        if (mp_arena == nullptr) {
+            return std::allocator<T>().allocate(n);
+        }
+
+        if FK_YAML_UNLIKELY (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(mp_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /// @brief Deallocate memory for `n` objects. Nothing happens for memory from an arena.
+    /// @param p The pointer to the memory.
+    /// @param n The number of objects.
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (mp_arena == nullptr) {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    /// @brief Get an allocator for copies of containers, which uses the arena active in the current thread if any.
+    /// @return An allocator for copied containers.
+    arena_allocator select_on_container_copy_construction() const noexcept {
+        return arena_allocator();
+    }
+
+    /// @brief Get the arena used by this allocator.
+    /// @return The pointer to the arena, or null if memory is allocated from the heap.
+    node_arena* arena() const noexcept {
+        return mp_arena;
+    }
+
+    /// @brief Check if two allocators use the same memory resource.
+    /// @param lhs An allocator.
+    /// @param rhs Another allocator.
+    /// @return true if both use the same memory resource, false otherwise.
+    template <typename U>
+    friend bool operator==(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept {
+        return lhs.arena() == rhs.arena();
+    }
+
+    /// @brief Check if two allocators use different memory resources.
+    /// @param lhs An allocator.
+    /// @param rhs Another allocator.
+    /// @return true if they use different memory resources, false otherwise.
+    template <typename U>
+    friend bool operator!=(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept {
+        return lhs.arena() != rhs.arena();
+    }
+
+private:
+    /// The arena to allocate memory from. Memory is allocated from the heap if null.
+    node_arena* mp_arena {nullptr};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_NODE_ARENA_HPP */
@@ -0,0 +1,324 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_PATH_HPP
+#define FK_YAML_PATH_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/define_macros.hpp>
+#include <fkYAML/exception.hpp>
+#include <fkYAML/fkyaml_fwd.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A segment of a compiled path, i.e., a mapping key or a sequence index.
+struct path_segment {
+    /// The segment as a mapping key.
+    std::string key;
+    /// The segment as a sequence index. Valid only if has_index is true.
+    std::size_t index {0};
+    /// Whether the segment is also a valid sequence index.
+    bool has_index {false};
+    /// Whether the segment looks up the integer key instead of the string key in mappings.
+    bool is_integer_key {false};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A path to a node in a YAML document, compiled once from a JSON Pointer or a dotted path expression.
+/// @note
+/// Each segment selects an element of a sequence by its index, or a value of a mapping by its key. An index segment
+/// in a dotted path, e.g., `[200]`, looks up the integer key in a mapping, and any other segment the string key.
+/// @sa https://fktn-k.github.io/fkYAML/api/path/
+class path {
+public:
+    /// @brief Constructs a path to the root node.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    path() = default;
+
+    /// @brief Compiles a path expression.
+    /// @note
+    /// An expression which starts with `/` is compiled as a JSON Pointer (RFC 6901), e.g., `/spec/containers/0/image`.
+    /// Any other non-empty expression is compiled as a dotted path, e.g., `spec.containers[0].image`. An empty
+    /// expression refers to the root node.
+    /// @param expr A path expression.
+    /// @throw fkyaml::invalid_path The expression is malformed.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    explicit path(const std::string& expr) {
+        if (expr.empty()) {
+            return;
+        }
+
+        if (expr[0] == '/') {
+            parse_json_pointer(expr);
+        }
+        else {
+            parse_dotted_path(expr);
+        }
+    }
+
+public:
+    /// @brief Gets the number of segments in this path.
+    /// @return The number of segments in this path.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    std::size_t size() const noexcept {
+        return m_segments.size();
+    }
+
+    /// @brief Checks if this path refers to the root node.
+    /// @return true if this path has no segment, false otherwise.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    bool empty() const noexcept {
+        return m_segments.empty();
+    }
+
+    /// @brief Gets the JSON Pointer representation of this path.
+    /// @note Index segments are written as decimal integers, which look up string keys in mappings as JSON Pointers.
+    /// @return The JSON Pointer representation of this path.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    std::string to_json_pointer() const {
+        std::string pointer;
+        for (const detail::path_segment& segment : m_segments) {
+            pointer += '/';
+            for (const char c : segment.key) {
+                switch (c) {
+                case '~':
+                    pointer += "~0";
+                    break;
+                case '/':
+                    pointer += "~1";
+                    break;
+                default:
+                    pointer += c;
+                    break;
+                }
+            }
+        }
+        return pointer;
+    }
+
+private:
+    template <
+        template <typename, typename...> class SequenceType,
+        template <typename, typename, typename...> class MappingType, typename BooleanType, typename IntegerType,
+        typename FloatNumberType, typename StringType, template <typename, typename> class ConverterType>
+    friend class basic_node;
+
+    friend class path_batch;
+
+    /// @brief Compiles a JSON Pointer, in which `~0` and `~1` stand for `~` and `/` respectively.
+    /// @param expr A JSON Pointer which starts with `/`.
+    void parse_json_pointer(const std::string& expr) {
+        std::string key;
+        for (std::size_t i = 1; i < expr.size(); i++) {
+            const char c = expr[i];
+            switch (c) {
+            case '/':
+                add_segment(std::move(key), false);
+                key.clear();
+                break;
+            case '~':
+                if FK_YAML_UNLIKELY (i + 1 == expr.size() || (expr[i + 1] != '0' && expr[i + 1] != '1')) {
+                    throw fkyaml::invalid_path("'~' must be followed by '0' or '1' in JSON Pointers.", expr.c_str());
+                }
+                key += (expr[++i] == '0') ? '~' : '/';
+                break;
+            default:
+                key += c;
+                break;
+            }
+        }
+        add_segment(std::move(key), false);
+    }
+
+    /// @brief Compiles a dotted path, in which keys are separated by `.` and indices are enclosed in `[]`.
+    /// @param expr A non-empty dotted path.
+    void parse_dotted_path(const std::string& expr) {
+        std::size_t i = 0;
+        const std::size_t size = expr.size();
+
+        // A dotted path may start with an index for a root sequence, e.g., `[0].name`.
+        bool expects_key = expr[0] != '[';
+        while (i < size) {
+            if (expects_key) {
+                const std::size_t begin = i;
+                while (i < size && expr[i] != '.' && expr[i] != '[') {
+                    ++i;
+                }
+                if FK_YAML_UNLIKELY (i == begin) {
+                    throw fkyaml::invalid_path("An empty key is found in a dotted path.", expr.c_str());
+                }
+                add_segment(expr.substr(begin, i - begin), false);
+            }
+            else {
+                // expr[i] is '['.
+                const std::size_t begin = ++i;
+                while (i < size && expr[i] >= '0' && expr[i] <= '9') {
+                    ++i;
+                }
+                if FK_YAML_UNLIKELY (i == begin || i == size || expr[i] != ']') {
+                    throw fkyaml::invalid_path(
+                        "'[' must be followed by digits and ']' in a dotted path.", expr.c_str());
+                }
+                add_segment(expr.substr(begin, i - begin), true);
+                ++i;
+            }
+
+            if (i == size) {
+                break;
+            }
+
+            if (expr[i] == '.') {
+                if FK_YAML_UNLIKELY (++i == size) {
+                    throw fkyaml::invalid_path("A dotted path must not end with '.'.", expr.c_str());
+                }
+                expects_key = true;
+            }
+            else if (expr[i] == '[') {
+                expects_key = false;
+            }
+            else {
+                throw fkyaml::invalid_path("']' must be followed by '.' or '[' in a dotted path.", expr.c_str());
+            }
+        }
+    }
+
+    /// @brief Appends a segment, which is also registered as a sequence index if the key is a canonical integer.
+    /// @param key A key of the segment.
+    /// @param is_integer_key Whether the segment looks up the integer key in mappings.
+    void add_segment(std::string&& key, bool is_integer_key) {
+        detail::path_segment segment;
+        segment.has_index = parse_index(key, segment.index);
+        segment.is_integer_key = is_integer_key;
+        segment.key = std::move(key);
+        m_segments.push_back(std::move(segment));
+    }
+
+    /// @brief Parses a key as a sequence index, i.e., a decimal integer without leading zeros in the range of int.
+    /// @param key A key to be parsed.
+    /// @param index The storage for the parsed index.
+    /// @return true if the key is a valid index, false otherwise.
+    static bool parse_index(const std::string& key, std::size_t& index) noexcept {
+        if (key.empty() || (key[0] == '0' && key.size() > 1)) {
+            return false;
+        }
+
+        constexpr std::size_t max_index = static_cast<std::size_t>(std::numeric_limits<int>::max());
+        std::size_t value = 0;
+        for (const char c : key) {
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            value = value * 10 + static_cast<std::size_t>(c - '0');
+            if (value > max_index) {
+                return false;
+            }
+        }
+
+        index = value;
+        return true;
+    }
+
+    /// The segments of this path from the root node.
+    std::vector<detail::path_segment> m_segments {};
+};
+
+/// @brief A set of paths evaluated together against a node, sharing the traversal of common prefixes.
+/// @sa https://fktn-k.github.io/fkYAML/api/path/
+class path_batch {
+public:
+    /// @brief Constructs an empty path_batch object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    path_batch()
+        : m_entries(1) {
+    }
+
+    /// @brief Constructs a path_batch object with the given paths.
+    /// @param paths Paths to be evaluated together.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    path_batch(std::initializer_list<path> paths)
+        : m_entries(1) {
+        for (const path& p : paths) {
+            add(p);
+        }
+    }
+
+public:
+    /// @brief Adds a path to be evaluated.
+    /// @param p A path to be added.
+    /// @return The position of the result for the path in evaluation results.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    std::size_t add(const path& p) {
+        std::size_t entry_idx = 0;
+        for (const detail::path_segment& segment : p.m_segments) {
+            auto inserted =
+                m_children.emplace(std::make_tuple(entry_idx, segment.is_integer_key, segment.key), m_entries.size());
+            if (inserted.second) {
+                // Entries are appended after their parents, so evaluating them in order visits each prefix once.
+                entry child;
+                child.segment = segment;
+                child.parent = entry_idx;
+                m_entries.push_back(std::move(child));
+            }
+            entry_idx = inserted.first->second;
+        }
+
+        m_ends.push_back(entry_idx);
+        return m_ends.size() - 1;
+    }
+
+    /// @brief Gets the number of paths in this batch.
+    /// @return The number of paths in this batch.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    std::size_t size() const noexcept {
+        return m_ends.size();
+    }
+
+    /// @brief Checks if this batch has no path.
+    /// @return true if this batch has no path, false otherwise.
+    /// @sa https://fktn-k.github.io/fkYAML/api/path/
+    bool empty() const noexcept {
+        return m_ends.empty();
+    }
+
+private:
+    template <
+        template <typename, typename...> class SequenceType,
+        template <typename, typename, typename...> class MappingType, typename BooleanType, typename IntegerType,
+        typename FloatNumberType, typename StringType, template <typename, typename> class ConverterType>
+    friend class basic_node;
+
+    /// @brief A node of the prefix tree of the paths.
+    struct entry {
+        /// The last segment of the prefix.
+        detail::path_segment segment;
+        /// The position of the entry for the parent prefix.
+        std::size_t parent {0};
+    };
+
+    /// The prefixes of all the paths, where the first one is the empty prefix, i.e., the root node.
+    std::vector<entry> m_entries;
+    /// The table from parent entries and segments, i.e., whether to look up integer keys and keys, to child entries.
+    std::map<std::tuple<std::size_t, bool, std::string>, std::size_t> m_children {};
+    /// The positions of the entries for the whole paths in the order of addition.
+    std::vector<std::size_t> m_ends {};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_PATH_HPP */
@@ -0,0 +1,85 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+// Counts of a deserialized node, computed independently of the deserializer.
+struct node_stats {
+    std::size_t depth {0};
+    std::size_t aliases {0};
+    std::size_t expanded_nodes {0};
+};
+
+// Aliases do not add the depths of their anchored nodes, but count as all the nodes in them.
+// The recursion is bounded since the limits have been checked while deserializing the node.
+void collect_stats(const fkyaml::node& node, std::size_t num_ancestors, bool in_alias, node_stats& stats) {
+    const bool is_alias = node.is_alias();
+    const bool is_collection = node.is_sequence() || node.is_mapping();
+    if (!in_alias) {
+        if (is_alias) {
+            ++stats.aliases;
+        }
+        else if (is_collection) {
+            stats.depth = std::max(stats.depth, num_ancestors + 1);
+        }
+    }
+    ++stats.expanded_nodes;
+
+    in_alias = in_alias || is_alias;
+    if (node.is_sequence()) {
+        for (const fkyaml::node& elem : node.as_seq()) {
+            collect_stats(elem, num_ancestors + 1, in_alias, stats);
+        }
+    }
+    else if (node.is_mapping()) {
+        for (const auto& pair : node.as_map()) {
+            collect_stats(pair.first, num_ancestors + 1, in_alias, stats);
+            collect_stats(pair.second, num_ancestors + 1, in_alias, stats);
+        }
+    }
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (size < 3) {
+        return 0;
+    }
+
+    // The first 3 bytes choose the limits so that the fuzzer can explore inputs around each of them.
+    // The depth and the number of expanded nodes are always limited to keep collect_stats() bounded.
+    fkyaml::deserialization_limits limits;
+    limits.max_depth = data[0] % 32 + 1;
+    limits.max_aliases = data[1] % 64;
+    limits.max_expanded_nodes = (static_cast<std::size_t>(data[2]) + 1) * 16;
+
+    try {
+        const char* data_str = reinterpret_cast<const char*>(data + 3);
+        fkyaml::node n = fkyaml::node::deserialize(data_str, data_str + size - 3, limits);
+
+        node_stats stats;
+        collect_stats(n, 0, false, stats);
+
+        // A document which exceeds the limits must have been rejected.
+        const bool exceeds_limits = stats.depth > limits.max_depth ||
+                                    (limits.max_aliases > 0 && stats.aliases > limits.max_aliases) ||
+                                    stats.expanded_nodes > limits.max_expanded_nodes;
+        if (exceeds_limits) {
+            std::abort();
+        }
+    }
+    catch (const fkyaml::exception& e) {
+        (void)e;
+    }
+    return 0;
+}
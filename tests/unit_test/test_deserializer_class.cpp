@@ -323,6 +323,18 @@ TEST_CASE("Deserializer_BlockLiteralScalar") {
         REQUIRE(foo_node.as_str() == "first sentence.\nsecond sentence.\nlast sentence.\n");
     }
 
+    SUBCASE("first line with only one character") {
+        std::string input = "foo: |\n"
+                            "  a\n"
+                            "bar: baz\n";
+
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+        REQUIRE(root.is_mapping());
+        REQUIRE(root.size() == 2);
+        REQUIRE(root["foo"].as_str() == "a\n");
+        REQUIRE(root["bar"].as_str() == "baz");
+    }
+
     SUBCASE("tagged") {
         std::string input = "foo: !!str |\n"
                             "  first sentence.\n"
@@ -3681,9 +3693,62 @@ TEST_CASE("Deserializer_NodeProperties") {
             std::string("{&x [*x]: 0}"),
             std::string("&x {a: *x}"),
             std::string("{&x [*x]: 0, &y [*y]: 1}"),
-            std::string("&x {a: {b: *x}}"));
+            std::string("&x {a: {b: *x}}"),
+            std::string("&x [1, &y [*x]]"),
+            std::string("--- &x\n- *x"),
+            std::string("- &x\n  - *x"),
+            std::string("--- &x\nfoo: bar\nbaz: *x"),
+            std::string("? &x\n  - *x\n: 1"));
         REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)), fkyaml::parse_error);
     }
+
+    SUBCASE("position of a self referential alias") {
+        // The error is reported at the beginning of the alias, not after it.
+        auto input_and_msg = GENERATE(
+            std::make_pair(
+                std::string("&a [*a]"), std::string("Self-referential alias (*a) is found. (at line 0, column 4)")),
+            std::make_pair(
+                std::string("&a {b: *a}"), std::string("Self-referential alias (*a) is found. (at line 0, column 7)")),
+            std::make_pair(
+                std::string("&a\n- *a"), std::string("Self-referential alias (*a) is found. (at line 1, column 2)")));
+
+        bool thrown = false;
+        try {
+            root = deserializer.deserialize(fkyaml::detail::input_adapter(input_and_msg.first));
+        }
+        catch (const fkyaml::parse_error& e) {
+            thrown = true;
+            const std::string msg(e.what());
+            REQUIRE(msg.find(input_and_msg.second) != std::string::npos);
+        }
+
+        REQUIRE(thrown);
+    }
+
+    SUBCASE("aliases to completed anchors") {
+        auto input = GENERATE(
+            std::string("[&x [1], *x, [*x]]"),
+            std::string("&x [1, &y [2], *y]"),
+            std::string("- &x\n  - 1\n- *x\n- - *x"),
+            std::string("x: &x\n  y: &y\n    z: 1\n  w: *y\nv: *x"),
+            std::string("{&x [1]: 0, [*x]: 1}"));
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+    }
+
+    SUBCASE("many aliases to a large anchor") {
+        std::string input = "base: &base {";
+        for (int i = 0; i < 100; i++) {
+            input += "key" + std::to_string(i) + ": [" + std::to_string(i) + ", {nested: value}], ";
+        }
+        input += "}\nrefs:\n";
+        for (int i = 0; i < 100; i++) {
+            input += "  - *base\n";
+        }
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+        REQUIRE(root["refs"].size() == 100);
+        REQUIRE(root["refs"][99].is_alias());
+        REQUIRE(root["refs"][99]["key99"][0].get_value<int>() == 99);
+    }
 }
 
 TEST_CASE("Deserializer_NoMachingAnchor") {
@@ -3848,4 +3913,152 @@ TEST_CASE("Deserializer_MultipleDocuments") {
             REQUIRE(d_node.as_str() == "e");
         }
     }
+
+    SUBCASE("node properties on the line before a root scalar") {
+        std::string input = "&anchor !!str\n"
+                            "foo\n"
+                            "---\n"
+                            "bar: baz\n";
+
+        REQUIRE_NOTHROW(docs = deserializer.deserialize_docs(fkyaml::detail::input_adapter(input)));
+        REQUIRE(docs.size() == 2);
+        REQUIRE(docs[1].is_mapping());
+        REQUIRE_FALSE(docs[1].has_anchor_name());
+        REQUIRE_FALSE(docs[1].has_tag_name());
+    }
+}
+
+TEST_CASE("Deserializer_Limits") {
+    fkyaml::detail::basic_deserializer<fkyaml::node> deserializer;
+    fkyaml::deserialization_limits limits;
+    fkyaml::node root;
+
+    SUBCASE("no limits by default") {
+        std::string input = "a: &a [1, 2, 3]\nb: &b [*a, *a, *a]\nc: [[[[[[*b, *b]]]]]]";
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+        REQUIRE(root["c"][0][0][0][0][0][0].size() == 3);
+    }
+
+    SUBCASE("nesting depth within the limit") {
+        limits.max_depth = 3;
+        deserializer.set_limits(limits);
+
+        auto input = GENERATE(
+            std::string("[[[1]]]"),
+            std::string("a: {b: [1]}"),
+            std::string("a:\n  b:\n    - 1"),
+            std::string("- - - x"),
+            std::string("{[1]: [[2]]}"),
+            std::string("[a: [b]]"),
+            std::string("? a\n: [[x]]"),
+            std::string("[[1]]: x"),
+            std::string("- &a [[1]]\n- [*a]"));
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+    }
+
+    SUBCASE("nesting depth over the limit") {
+        limits.max_depth = 3;
+        deserializer.set_limits(limits);
+
+        auto input = GENERATE(
+            std::string("[[[[1]]]]"),
+            std::string("a: {b: [[1]]}"),
+            std::string("a:\n  b:\n    - - 1"),
+            std::string("- - - - x"),
+            std::string("- - - -\n"),
+            std::string("{[1]: [[[2]]]}"),
+            std::string("[a: [[b]]]"),
+            std::string("a:\n b:\n  c:\n   d: 1\n"),
+            std::string("[[[1]]]: x"),
+            std::string("[[[]]: x]"),
+            std::string("[{a: []}: x]"));
+        REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)), fkyaml::limit_exceeded);
+    }
+
+    SUBCASE("deeply nested flow sequences") {
+        limits.max_depth = 64;
+        deserializer.set_limits(limits);
+
+        std::string input = std::string(100000, '[') + std::string(100000, ']');
+        REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)), fkyaml::limit_exceeded);
+    }
+
+    SUBCASE("number of aliases") {
+        limits.max_aliases = 2;
+        deserializer.set_limits(limits);
+
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter("[&a 1, *a, *a]")));
+        REQUIRE_THROWS_AS(
+            root = deserializer.deserialize(fkyaml::detail::input_adapter("[&a 1, *a, *a, *a]")),
+            fkyaml::limit_exceeded);
+
+        // the limit applies to each document.
+        std::vector<fkyaml::node> docs;
+        REQUIRE_NOTHROW(
+            docs = deserializer.deserialize_docs(fkyaml::detail::input_adapter("[&a 1, *a, *a]\n---\n[&a 1, *a, *a]")));
+        REQUIRE(docs.size() == 2);
+    }
+
+    SUBCASE("number of expanded nodes") {
+        // the root sequence, the anchored sequence with its 2 elements, and the alias expanded into 3 nodes.
+        std::string input = "[&a [1, 2], *a]";
+
+        limits.max_expanded_nodes = 7;
+        deserializer.set_limits(limits);
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+
+        limits.max_expanded_nodes = 6;
+        deserializer.set_limits(limits);
+        REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)), fkyaml::limit_exceeded);
+
+        // nodes without aliases count as well.
+        limits.max_expanded_nodes = 4;
+        deserializer.set_limits(limits);
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter("{a: [1]}")));
+        REQUIRE_THROWS_AS(
+            root = deserializer.deserialize(fkyaml::detail::input_adapter("{a: 1, b: 2}")), fkyaml::limit_exceeded);
+    }
+
+    SUBCASE("nested anchors and aliases") {
+        std::string input = "a: &a [x, &b {y: z}]\n"
+                            "b: [*b, *a]\n"
+                            "? *b\n"
+                            ": *a";
+        // root(1) + a(1 + 5) + b(1 + 1 + 3 + 5) + *b(3) + *a(5)
+        limits.max_expanded_nodes = 25;
+        deserializer.set_limits(limits);
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+
+        limits.max_expanded_nodes = 24;
+        deserializer.set_limits(limits);
+        REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)), fkyaml::limit_exceeded);
+    }
+
+    SUBCASE("billion laughs") {
+        std::string input = "a: &a [lol, lol, lol, lol, lol, lol, lol, lol, lol]\n";
+        for (char name = 'b'; name <= 'i'; name++) {
+            input += std::string(1, name) + ": &" + name + " [";
+            for (int i = 0; i < 9; i++) {
+                input += (i == 0 ? "*" : ", *") + std::string(1, static_cast<char>(name - 1));
+            }
+            input += "]\n";
+        }
+
+        limits.max_expanded_nodes = 1000000;
+        deserializer.set_limits(limits);
+        REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)), fkyaml::limit_exceeded);
+
+        try {
+            root = deserializer.deserialize(fkyaml::detail::input_adapter(input));
+        }
+        catch (const fkyaml::limit_exceeded& e) {
+            REQUIRE(std::string(e.what()).find("expanded nodes") != std::string::npos);
+        }
+    }
+
+    SUBCASE("limit_exceeded is a parse_error") {
+        limits.max_depth = 1;
+        deserializer.set_limits(limits);
+        REQUIRE_THROWS_AS(root = deserializer.deserialize(fkyaml::detail::input_adapter("[[1]]")), fkyaml::parse_error);
+    }
 }
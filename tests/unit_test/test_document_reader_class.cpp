@@ -0,0 +1,236 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("DocumentReader_InvalidInput") {
+    SUBCASE("null FILE pointer") {
+        REQUIRE_THROWS_AS(fkyaml::node::document_reader(static_cast<std::FILE*>(nullptr)), fkyaml::exception);
+    }
+
+    SUBCASE("bad stream") {
+        std::istringstream ss("foo");
+        ss.setstate(std::ios_base::failbit);
+        REQUIRE_THROWS_AS(fkyaml::node::document_reader(ss), fkyaml::exception);
+    }
+}
+
+TEST_CASE("DocumentReader_EmptyInput") {
+    std::istringstream ss("");
+    fkyaml::node::document_reader reader(ss);
+    fkyaml::node doc = 123;
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_null());
+    REQUIRE_FALSE(reader.next_document(doc));
+    REQUIRE_FALSE(reader.next_document(doc));
+}
+
+TEST_CASE("DocumentReader_SingleDocument") {
+    auto input = GENERATE(
+        std::string("foo: bar"),
+        std::string("foo: bar\n"),
+        std::string("# comment\n---\nfoo: bar\n"),
+        std::string("%YAML 1.2\n---\nfoo: bar\n...\n"),
+        std::string("foo: bar\n...\n# comment\n"),
+        std::string("\xEF\xBB\xBF"
+                    "foo: bar\n"),
+        std::string("foo: bar\r\n...\r\n"));
+
+    std::istringstream ss(input);
+    fkyaml::node::document_reader reader(ss);
+    fkyaml::node doc;
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_mapping());
+    REQUIRE(doc.size() == 1);
+    REQUIRE(doc["foo"].get_value<std::string>() == "bar");
+    REQUIRE_FALSE(reader.next_document(doc));
+}
+
+TEST_CASE("DocumentReader_MultipleDocuments") {
+    const std::string input = "%YAML 1.2\n"
+                              "---\n"
+                              "foo: bar\n"
+                              "...\n"
+                              "%TAG !e! tag:example.com,2000:\n"
+                              "--- !e!foo 123\n"
+                              "--- |\n"
+                              "  literal\n"
+                              "---\n"
+                              "---\n"
+                              "- baz\n";
+    std::istringstream ss(input);
+    fkyaml::node::document_reader reader(ss);
+    fkyaml::node doc;
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_mapping());
+    REQUIRE(doc["foo"].get_value<std::string>() == "bar");
+    REQUIRE(doc.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_2);
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_integer());
+    REQUIRE(doc.get_value<int>() == 123);
+    REQUIRE(doc.get_tag_name() == "!e!foo");
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_string());
+    REQUIRE(doc.get_value<std::string>() == "literal\n");
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_null());
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_sequence());
+    REQUIRE(doc[0].get_value<std::string>() == "baz");
+
+    REQUIRE_FALSE(reader.next_document(doc));
+}
+
+TEST_CASE("DocumentReader_ReadsOnlyUpToDocumentBoundary") {
+    std::istringstream ss("foo: 1\n...\nbar: 2\n---\nbaz: 3\n");
+    fkyaml::node::document_reader reader(ss);
+    fkyaml::node doc;
+
+    // the first document ends with the document end marker.
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc["foo"].get_value<int>() == 1);
+    REQUIRE(ss.tellg() == std::streampos(11));
+
+    // the second document ends right before the next directives end marker.
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc["bar"].get_value<int>() == 2);
+    REQUIRE(ss.tellg() == std::streampos(22));
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc["baz"].get_value<int>() == 3);
+    REQUIRE_FALSE(reader.next_document(doc));
+}
+
+TEST_CASE("DocumentReader_NotDocumentMarkers") {
+    // document markers must begin at the beginning of a line.
+    std::istringstream ss("foo: |\n"
+                          "  ---\n"
+                          "  ...\n"
+                          "bar: baz\n");
+    fkyaml::node::document_reader reader(ss);
+    fkyaml::node doc;
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_mapping());
+    REQUIRE(doc.size() == 2);
+    REQUIRE(doc["foo"].get_value<std::string>() == "---\n...\n");
+    REQUIRE(doc["bar"].get_value<std::string>() == "baz");
+    REQUIRE_FALSE(reader.next_document(doc));
+}
+
+TEST_CASE("DocumentReader_FilePointer") {
+    std::FILE* p_file = std::tmpfile();
+    REQUIRE(p_file != nullptr);
+    const std::string input = "foo: bar\n"
+                              "--- [1, 2]\n"
+                              "...\n"
+                              "baz";
+    std::fwrite(input.data(), sizeof(char), input.size(), p_file);
+    std::rewind(p_file);
+
+    fkyaml::node::document_reader reader(p_file);
+    fkyaml::node doc;
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc["foo"].get_value<std::string>() == "bar");
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.is_sequence());
+    REQUIRE(doc.size() == 2);
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE(doc.get_value<std::string>() == "baz");
+
+    REQUIRE_FALSE(reader.next_document(doc));
+    std::fclose(p_file);
+}
+
+TEST_CASE("DocumentReader_UTF16Input") {
+    // UTF-16LE encoded "foo\n---\nbar" with a BOM.
+    const std::string input("\xFF\xFE"
+                            "f\0o\0o\0\n\0-\0-\0-\0\n\0b\0a\0r\0",
+                            24);
+
+    SUBCASE("input stream") {
+        std::istringstream ss(input);
+        fkyaml::node::document_reader reader(ss);
+        fkyaml::node doc;
+
+        REQUIRE(reader.next_document(doc));
+        REQUIRE(doc.get_value<std::string>() == "foo");
+        REQUIRE(reader.next_document(doc));
+        REQUIRE(doc.get_value<std::string>() == "bar");
+        REQUIRE_FALSE(reader.next_document(doc));
+    }
+
+    SUBCASE("FILE pointer") {
+        std::FILE* p_file = std::tmpfile();
+        REQUIRE(p_file != nullptr);
+        std::fwrite(input.data(), sizeof(char), input.size(), p_file);
+        std::rewind(p_file);
+
+        fkyaml::node::document_reader reader(p_file);
+        fkyaml::node doc;
+
+        REQUIRE(reader.next_document(doc));
+        REQUIRE(doc.get_value<std::string>() == "foo");
+        REQUIRE(reader.next_document(doc));
+        REQUIRE(doc.get_value<std::string>() == "bar");
+        REQUIRE_FALSE(reader.next_document(doc));
+        std::fclose(p_file);
+    }
+}
+
+TEST_CASE("DocumentReader_ParseError") {
+    std::istringstream ss("foo: bar\n---\nfoo: [bar\n");
+    fkyaml::node::document_reader reader(ss);
+    fkyaml::node doc;
+
+    REQUIRE(reader.next_document(doc));
+    REQUIRE_THROWS_AS(reader.next_document(doc), fkyaml::parse_error);
+}
+
+TEST_CASE("DocumentReader_Limits") {
+    fkyaml::deserialization_limits limits;
+    limits.max_depth = 2;
+    limits.max_aliases = 1;
+
+    SUBCASE("UTF-8 input") {
+        std::istringstream ss("foo: [&a 1, *a]\n---\nfoo: [[1]]\n");
+        fkyaml::node::document_reader reader(ss);
+        reader.set_limits(limits);
+        fkyaml::node doc;
+
+        REQUIRE(reader.next_document(doc));
+        REQUIRE(doc["foo"].size() == 2);
+        REQUIRE_THROWS_AS(reader.next_document(doc), fkyaml::limit_exceeded);
+    }
+
+    SUBCASE("UTF-16 input") {
+        // UTF-16LE encoded "[[[1]]]" with a BOM.
+        std::istringstream ss(std::string("\xFF\xFE[\0[\0[\0001\0]\0]\0]\0", 16));
+        fkyaml::node::document_reader reader(ss);
+        reader.set_limits(limits);
+        fkyaml::node doc;
+
+        REQUIRE_THROWS_AS(reader.next_document(doc), fkyaml::limit_exceeded);
+    }
+}
@@ -0,0 +1,466 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+// records events in a compact notation. e.g., "+MAP", "=foo" (plain scalar), "'foo" (single-quoted scalar)
+class event_recorder : public fkyaml::event_handler {
+public:
+    bool start_document() override {
+        events.emplace_back("+DOC");
+        return true;
+    }
+    bool end_document() override {
+        events.emplace_back("-DOC");
+        return true;
+    }
+    bool start_mapping() override {
+        events.emplace_back("+MAP");
+        return true;
+    }
+    bool end_mapping() override {
+        events.emplace_back("-MAP");
+        return true;
+    }
+    bool start_sequence() override {
+        events.emplace_back("+SEQ");
+        return true;
+    }
+    bool end_sequence() override {
+        events.emplace_back("-SEQ");
+        return true;
+    }
+    bool scalar(const char* value, std::size_t length, fkyaml::scalar_style style) override {
+        const char prefixes[] = {'=', '\'', '"', '|', '>'};
+        events.emplace_back(prefixes[static_cast<int>(style)] + std::string(value, length));
+        return true;
+    }
+    bool alias(const char* name, std::size_t length) override {
+        events.emplace_back("*" + std::string(name, length));
+        return true;
+    }
+    bool anchor(const char* name, std::size_t length) override {
+        events.emplace_back("&" + std::string(name, length));
+        return true;
+    }
+    bool tag(const char* name, std::size_t length) override {
+        events.emplace_back("<" + std::string(name, length) + ">");
+        return true;
+    }
+
+    std::vector<std::string> events;
+};
+
+// aborts parsing at the first scalar.
+class aborting_handler : public fkyaml::event_handler {
+public:
+    bool scalar(const char* /*unused*/, std::size_t /*unused*/, fkyaml::scalar_style /*unused*/) override {
+        ++num_scalars;
+        return false;
+    }
+
+    int num_scalars {0};
+};
+
+// a handler which does not derive from fkyaml::event_handler.
+struct scalar_counter {
+    bool start_document() {
+        return true;
+    }
+    bool end_document() {
+        return true;
+    }
+    bool start_mapping() {
+        return true;
+    }
+    bool end_mapping() {
+        return true;
+    }
+    bool start_sequence() {
+        return true;
+    }
+    bool end_sequence() {
+        return true;
+    }
+    bool scalar(const char* /*unused*/, std::size_t /*unused*/, fkyaml::scalar_style /*unused*/) {
+        ++num_scalars;
+        return true;
+    }
+    bool alias(const char* /*unused*/, std::size_t /*unused*/) {
+        return true;
+    }
+    bool anchor(const char* /*unused*/, std::size_t /*unused*/) {
+        return true;
+    }
+    bool tag(const char* /*unused*/, std::size_t /*unused*/) {
+        return true;
+    }
+
+    int num_scalars {0};
+};
+
+// builds nodes from events to compare the events with the results of fkyaml::node::deserialize_docs().
+// plain scalars are converted in the same way as deserialization, and aliases are replaced with copies of their
+// anchored nodes.
+class node_builder : public fkyaml::event_handler {
+public:
+    bool start_document() override {
+        m_anchors.clear();
+        return true;
+    }
+    bool start_mapping() override {
+        m_stack.emplace_back(fkyaml::node::mapping(), take_anchor());
+        return true;
+    }
+    bool end_mapping() override {
+        return end_collection();
+    }
+    bool start_sequence() override {
+        m_stack.emplace_back(fkyaml::node::sequence(), take_anchor());
+        return true;
+    }
+    bool end_sequence() override {
+        return end_collection();
+    }
+    bool scalar(const char* value, std::size_t length, fkyaml::scalar_style style) override {
+        const std::string str(value, length);
+        add(style == fkyaml::scalar_style::PLAIN ? fkyaml::node::deserialize(str) : fkyaml::node(str), take_anchor());
+        return true;
+    }
+    bool alias(const char* name, std::size_t length) override {
+        add(m_anchors.at(std::string(name, length)), std::string());
+        return true;
+    }
+    bool anchor(const char* name, std::size_t length) override {
+        m_next_anchor.assign(name, length);
+        return true;
+    }
+
+    std::vector<fkyaml::node> docs;
+
+private:
+    struct frame {
+        frame(fkyaml::node&& n, std::string&& anchor_name)
+            : node(std::move(n)),
+              anchor(std::move(anchor_name)) {
+        }
+
+        fkyaml::node node;
+        std::string anchor;
+        fkyaml::node key {};
+        bool has_key {false};
+    };
+
+    std::string take_anchor() {
+        std::string anchor;
+        anchor.swap(m_next_anchor);
+        return anchor;
+    }
+
+    bool end_collection() {
+        frame f = std::move(m_stack.back());
+        m_stack.pop_back();
+        add(std::move(f.node), f.anchor);
+        return true;
+    }
+
+    void add(fkyaml::node node, const std::string& anchor) {
+        if (!anchor.empty()) {
+            m_anchors[anchor] = node;
+        }
+        if (m_stack.empty()) {
+            docs.push_back(std::move(node));
+            return;
+        }
+
+        frame& f = m_stack.back();
+        if (f.node.is_sequence()) {
+            f.node.as_seq().push_back(std::move(node));
+        }
+        else if (!f.has_key) {
+            f.key = std::move(node);
+            f.has_key = true;
+        }
+        else {
+            f.node.as_map().emplace(std::move(f.key), std::move(node));
+            f.has_key = false;
+        }
+    }
+
+    std::vector<frame> m_stack;
+    std::map<std::string, fkyaml::node> m_anchors;
+    std::string m_next_anchor;
+};
+
+std::vector<std::string> parse_events(const std::string& input) {
+    fkyaml::detail::basic_event_parser<fkyaml::node> parser;
+    event_recorder recorder;
+    REQUIRE(parser.parse(fkyaml::detail::input_adapter(input), recorder));
+    return recorder.events;
+}
+
+} // namespace
+
+TEST_CASE("EventParser_EmptyInput") {
+    using events_t = std::vector<std::string>;
+    REQUIRE(parse_events("") == events_t {"+DOC", "=", "-DOC"});
+    REQUIRE(parse_events("# comment only\n") == events_t {"+DOC", "=", "-DOC"});
+}
+
+TEST_CASE("EventParser_BlockMapping") {
+    using events_t = std::vector<std::string>;
+
+    SUBCASE("nested mappings") {
+        const std::string input = "foo:\n"
+                                  "  bar:\n"
+                                  "    baz: 1\n"
+                                  "  qux: 2\n"
+                                  "quux: 3\n";
+        REQUIRE(
+            parse_events(input) == events_t {"+DOC", "+MAP", "=foo", "+MAP", "=bar", "+MAP", "=baz", "=1", "-MAP",
+                                             "=qux", "=2", "-MAP", "=quux", "=3", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("empty values") {
+        REQUIRE(
+            parse_events("foo:\nbar:\n  baz:\n") ==
+            events_t {"+DOC", "+MAP", "=foo", "=", "=bar", "+MAP", "=baz", "=", "-MAP", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("explicit keys and empty keys") {
+        const std::string input = "? foo\n"
+                                  ": bar\n"
+                                  "? - baz\n"
+                                  ": qux\n"
+                                  ": empty key\n";
+        REQUIRE(
+            parse_events(input) == events_t {"+DOC", "+MAP", "=foo", "=bar", "+SEQ", "=baz", "-SEQ", "=qux", "=",
+                                             "=empty key", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("multiple keys on the same line") {
+        fkyaml::detail::basic_event_parser<fkyaml::node> parser;
+        event_recorder recorder;
+        REQUIRE_THROWS_AS(
+            parser.parse(fkyaml::detail::input_adapter("foo: bar: baz"), recorder), fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("EventParser_BlockSequence") {
+    using events_t = std::vector<std::string>;
+
+    SUBCASE("nested sequences") {
+        REQUIRE(
+            parse_events("- - a\n  - b\n-\n- c\n") ==
+            events_t {"+DOC", "+SEQ", "+SEQ", "=a", "=b", "-SEQ", "=", "=c", "-SEQ", "-DOC"});
+    }
+
+    SUBCASE("sequences as mapping values") {
+        const std::string input = "foo:\n"
+                                  "- a: 1\n"
+                                  "  b: 2\n"
+                                  "bar:\n"
+                                  "  - c\n";
+        REQUIRE(
+            parse_events(input) == events_t {"+DOC", "+MAP", "=foo", "+SEQ", "+MAP", "=a", "=1", "=b", "=2", "-MAP",
+                                             "-SEQ", "=bar", "+SEQ", "=c", "-SEQ", "-MAP", "-DOC"});
+    }
+}
+
+TEST_CASE("EventParser_FlowCollections") {
+    using events_t = std::vector<std::string>;
+
+    SUBCASE("nested flow collections") {
+        REQUIRE(
+            parse_events("foo: [a, [b], {c: d, e}]\n") ==
+            events_t {"+DOC", "+MAP", "=foo", "+SEQ", "=a", "+SEQ", "=b", "-SEQ", "+MAP", "=c", "=d", "=e", "=",
+                      "-MAP", "-SEQ", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("single pair mappings in a flow sequence") {
+        REQUIRE(
+            parse_events("[a: b, : c]") == events_t {"+DOC", "+SEQ", "+MAP", "=a", "=b", "-MAP", "+MAP", "=", "=c",
+                                                     "-MAP", "-SEQ", "-DOC"});
+    }
+
+    SUBCASE("flow collections as keys of flow mappings") {
+        REQUIRE(
+            parse_events("{[a]: b}") ==
+            events_t {"+DOC", "+MAP", "+SEQ", "=a", "-SEQ", "=b", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("flow collections as implicit keys of block mappings") {
+        REQUIRE(
+            parse_events("[a, b]: c\n&x {d: e}: f\n") ==
+            events_t {"+DOC", "+MAP", "+SEQ", "=a", "=b", "-SEQ", "=c", "&x", "+MAP", "=d", "=e", "-MAP", "=f", "-MAP",
+                      "-DOC"});
+        REQUIRE(
+            parse_events("- [a]: b\n  [c]: d\n") ==
+            events_t {"+DOC", "+SEQ", "+MAP", "+SEQ", "=a", "-SEQ", "=b", "+SEQ", "=c", "-SEQ", "=d", "-MAP", "-SEQ",
+                      "-DOC"});
+    }
+
+    SUBCASE("flow collections as keys of single pair mappings") {
+        REQUIRE(
+            parse_events("[[a]: b, {c: d}: e, [f]]") ==
+            events_t {"+DOC", "+SEQ", "+MAP", "+SEQ", "=a", "-SEQ", "=b", "-MAP", "+MAP", "+MAP", "=c", "=d", "-MAP",
+                      "=e", "-MAP", "+SEQ", "=f", "-SEQ", "-SEQ", "-DOC"});
+    }
+
+    SUBCASE("flow collections which are too long to be implicit keys") {
+        fkyaml::detail::basic_event_parser<fkyaml::node> parser;
+        event_recorder recorder;
+        REQUIRE_THROWS_AS(
+            parser.parse(fkyaml::detail::input_adapter("[a,\n b]: c"), recorder), fkyaml::parse_error);
+        REQUIRE_THROWS_AS(
+            parser.parse(fkyaml::detail::input_adapter("[\"" + std::string(1024, 'a') + "\"]: b"), recorder),
+            fkyaml::parse_error);
+    }
+
+    SUBCASE("unclosed flow collection") {
+        fkyaml::detail::basic_event_parser<fkyaml::node> parser;
+        event_recorder recorder;
+        REQUIRE_THROWS_AS(parser.parse(fkyaml::detail::input_adapter("[a, b"), recorder), fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("EventParser_ScalarStyles") {
+    using events_t = std::vector<std::string>;
+    const std::string input = "plain: multi\n"
+                              "  line\n"
+                              "single: 'it''s'\n"
+                              "double: \"a\\tb\"\n"
+                              "literal: |\n"
+                              "  foo\n"
+                              "  bar\n"
+                              "folded: >-\n"
+                              "  foo\n"
+                              "  bar\n";
+    REQUIRE(
+        parse_events(input) == events_t {"+DOC", "+MAP", "=plain", "=multi line", "=single", "'it's", "=double",
+                                         "\"a\tb", "=literal", "|foo\nbar\n", "=folded", ">foo bar", "-MAP", "-DOC"});
+}
+
+TEST_CASE("EventParser_NodeProperties") {
+    using events_t = std::vector<std::string>;
+
+    SUBCASE("anchors and aliases") {
+        REQUIRE(
+            parse_events("foo: &anchor bar\nbaz: *anchor\n") ==
+            events_t {"+DOC", "+MAP", "=foo", "&anchor", "=bar", "=baz", "*anchor", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("properties of keys and collections") {
+        const std::string input = "&root !!map\n"
+                                  "&key foo: !!seq\n"
+                                  "  - !!str bar\n"
+                                  "baz: !!null\n";
+        REQUIRE(
+            parse_events(input) == events_t {"+DOC", "&root", "<!!map>", "+MAP", "&key", "=foo", "<!!seq>", "+SEQ",
+                                             "<!!str>", "=bar", "-SEQ", "=baz", "<!!null>", "=", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("properties of a block mapping and its first key") {
+        REQUIRE(
+            parse_events("!!map\n!!str foo: bar\n") ==
+            events_t {"+DOC", "<!!map>", "+MAP", "<!!str>", "=foo", "=bar", "-MAP", "-DOC"});
+    }
+
+    SUBCASE("aliases to undefined anchors") {
+        auto input = GENERATE(
+            std::string("&r [1, *r2]"),
+            std::string("&r [1, *r]"),
+            std::string("[*a]: &a b"),
+            std::string("foo: &a bar\n---\nbaz: *a"));
+        fkyaml::detail::basic_event_parser<fkyaml::node> parser;
+        event_recorder recorder;
+        REQUIRE_THROWS_AS(parser.parse(fkyaml::detail::input_adapter(input), recorder), fkyaml::parse_error);
+    }
+
+    SUBCASE("properties of an alias") {
+        fkyaml::detail::basic_event_parser<fkyaml::node> parser;
+        event_recorder recorder;
+        REQUIRE_THROWS_AS(
+            parser.parse(fkyaml::detail::input_adapter("foo: &a bar\nbaz: !!str *a"), recorder), fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("EventParser_MultipleDocuments") {
+    using events_t = std::vector<std::string>;
+    const std::string input = "%YAML 1.2\n"
+                              "---\n"
+                              "foo: bar\n"
+                              "...\n"
+                              "--- baz\n"
+                              "---\n";
+    REQUIRE(
+        parse_events(input) == events_t {"+DOC", "+MAP", "=foo", "=bar", "-MAP", "-DOC", "+DOC", "=baz", "-DOC",
+                                         "+DOC", "=", "-DOC"});
+}
+
+TEST_CASE("EventParser_AbortByHandler") {
+    aborting_handler handler;
+    REQUIRE_FALSE(fkyaml::node::parse_events("foo: bar\nbaz: qux\n", handler));
+    REQUIRE(handler.num_scalars == 1);
+}
+
+TEST_CASE("EventParser_HandlerWithoutBaseClass") {
+    scalar_counter counter;
+    REQUIRE(fkyaml::node::parse_events(std::string("- foo\n- {bar: baz}\n- [qux]\n"), counter));
+    REQUIRE(counter.num_scalars == 4);
+}
+
+TEST_CASE("EventParser_SameResultsAsDeserializeDocs") {
+    SUBCASE("valid inputs") {
+        auto input = GENERATE(
+            std::string("foo: [a, {b: c}]\nbar:\n  - 1\n  - true\n"),
+            std::string("[a, b]: c\n{d: e}: [f]\n"),
+            std::string("x: 1\n[a, b]: c\n"),
+            std::string("x:\n  - q\n[a]: b\n"),
+            std::string("- [a]: b\n  [c, d]: e\n- [f]\n"),
+            std::string("[[a]: b, {c: 1}: d, [e]]"),
+            std::string("{[a]: b, c: [d, [e]: f]}"),
+            std::string("[[a, [b]: c]: d]: e\n"),
+            std::string("a: &a [1, 2]\n[*a]: &b {c: *a}\nd: *b\n"),
+            std::string("&a [1, 2]: *a\n"),
+            std::string("- &a [x]\n- [*a]: *a\n- &a y\n- *a\n"),
+            std::string("&r [1, &r 2, *r]"),
+            std::string("'quoted': \"double\"\n? explicit\n: [value]\n"),
+            std::string("[a]\n---\n[b]: c\n...\n---\n{d: e}\n"));
+
+        std::vector<fkyaml::node> expected = fkyaml::node::deserialize_docs(input);
+        node_builder builder;
+        REQUIRE(fkyaml::node::parse_events(input, builder));
+        REQUIRE(builder.docs == expected);
+    }
+
+    SUBCASE("invalid inputs") {
+        auto input = GENERATE(
+            std::string("&r [1, *r2]"),
+            std::string("&r [1, *r]"),
+            std::string("&r {a: [*r]}: b"),
+            std::string("a: &x 1\n---\nb: *x"),
+            std::string("[a]\n[b]"),
+            std::string("[a]\n: b"),
+            std::string("{a: [b]: c}"),
+            std::string("x: q\n[a: \n ]"));
+
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_docs(input), fkyaml::parse_error);
+        node_builder builder;
+        REQUIRE_THROWS_AS(fkyaml::node::parse_events(input, builder), fkyaml::parse_error);
+    }
+}
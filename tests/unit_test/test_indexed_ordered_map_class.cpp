@@ -0,0 +1,251 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+using indexed_map_t = fkyaml::indexed_ordered_map<std::string, int>;
+using indexed_node_t = fkyaml::basic_node<std::vector, fkyaml::indexed_ordered_map>;
+
+// the number of entries enough to make the hash index built.
+static const int large_map_size = static_cast<int>(indexed_map_t::index_threshold) * 4;
+
+TEST_CASE("IndexedOrderedMap_DefaultCtor") {
+    indexed_map_t map;
+    REQUIRE(map.empty());
+}
+
+TEST_CASE("IndexedOrderedMap_InitListCtor") {
+    indexed_map_t map {{"foo", 1}, {"bar", 2}, {"foo", 3}};
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.at("foo") == 1);
+    REQUIRE(map.at("bar") == 2);
+    REQUIRE_THROWS_AS(map.at("buz"), fkyaml::exception);
+    auto itr = map.begin();
+    REQUIRE(itr->first == "foo");
+    ++itr;
+    REQUIRE(itr->first == "bar");
+}
+
+TEST_CASE("IndexedOrderedMap_Emplace") {
+    auto size = GENERATE(4, large_map_size);
+    CAPTURE(size);
+
+    indexed_map_t map;
+    for (int i = 0; i < size; i++) {
+        REQUIRE(map.emplace(std::to_string(i), i).second == true);
+    }
+    for (int i = 0; i < size; i++) {
+        auto ret = map.emplace(std::to_string(i), -1);
+        REQUIRE(ret.second == false);
+        REQUIRE(ret.first->second == i);
+    }
+    REQUIRE(map.size() == static_cast<std::size_t>(size));
+
+    // insertion order must be preserved.
+    int expected = 0;
+    for (const auto& pair : map) {
+        REQUIRE(pair.first == std::to_string(expected));
+        REQUIRE(pair.second == expected);
+        ++expected;
+    }
+}
+
+TEST_CASE("IndexedOrderedMap_SubscriptOperator") {
+    indexed_map_t map;
+    for (int i = 0; i < large_map_size; i++) {
+        map[std::to_string(i)] = i;
+    }
+    REQUIRE(map.size() == static_cast<std::size_t>(large_map_size));
+    REQUIRE(map["0"] == 0);
+    REQUIRE(map["foo"] == 0);
+    REQUIRE(map.size() == static_cast<std::size_t>(large_map_size + 1));
+}
+
+TEST_CASE("IndexedOrderedMap_At") {
+    auto size = GENERATE(4, large_map_size);
+    CAPTURE(size);
+
+    indexed_map_t map;
+    for (int i = 0; i < size; i++) {
+        map.emplace(std::to_string(i), i);
+    }
+    const indexed_map_t& const_map = map;
+
+    for (int i = 0; i < size; i++) {
+        REQUIRE(map.at(std::to_string(i)) == i);
+        REQUIRE(const_map.at(std::to_string(i)) == i);
+    }
+    REQUIRE_THROWS_AS(map.at("foo"), fkyaml::exception);
+    REQUIRE_THROWS_AS(const_map.at("foo"), fkyaml::exception);
+}
+
+TEST_CASE("IndexedOrderedMap_Find") {
+    auto size = GENERATE(4, large_map_size);
+    CAPTURE(size);
+
+    indexed_map_t map;
+    for (int i = 0; i < size; i++) {
+        map.emplace(std::to_string(i), i);
+    }
+    const indexed_map_t& const_map = map;
+
+    for (int i = 0; i < size; i++) {
+        REQUIRE(map.find(std::to_string(i)) == map.begin() + i);
+        REQUIRE(const_map.find(std::to_string(i)) == const_map.begin() + i);
+    }
+    REQUIRE(map.find("foo") == map.end());
+    REQUIRE(const_map.find("foo") == const_map.end());
+}
+
+TEST_CASE("IndexedOrderedMap_Erase") {
+    indexed_map_t map;
+    for (int i = 0; i < large_map_size; i++) {
+        map.emplace(std::to_string(i), i);
+    }
+
+    auto itr = map.erase(map.find("1"));
+    REQUIRE(itr->first == "2");
+    REQUIRE(map.size() == static_cast<std::size_t>(large_map_size - 1));
+    REQUIRE(map.find("1") == map.end());
+    REQUIRE(map.at("0") == 0);
+    REQUIRE(map.find("2") == map.begin() + 1);
+    REQUIRE(map.at(std::to_string(large_map_size - 1)) == large_map_size - 1);
+
+    // erasing enough entries discards the hash index.
+    while (map.size() > 1) {
+        map.erase(map.begin());
+    }
+    REQUIRE(map.begin()->first == std::to_string(large_map_size - 1));
+    REQUIRE(map.at(std::to_string(large_map_size - 1)) == large_map_size - 1);
+}
+
+TEST_CASE("IndexedOrderedMap_EraseKeepsIndexConsistent") {
+    indexed_map_t map;
+    std::vector<int> expected;
+    for (int i = 0; i < large_map_size * 4; i++) {
+        map.emplace(std::to_string(i), i);
+        expected.push_back(i);
+    }
+
+    // erase entries at various positions while the hash index stays built.
+    std::size_t erase_pos = 7;
+    while (map.size() > indexed_map_t::index_threshold) {
+        erase_pos = (erase_pos * 31 + 3) % map.size();
+        auto itr = map.erase(map.begin() + static_cast<std::ptrdiff_t>(erase_pos));
+        expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(erase_pos));
+        REQUIRE(itr == map.begin() + static_cast<std::ptrdiff_t>(erase_pos));
+
+        REQUIRE(map.size() == expected.size());
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            REQUIRE(map.find(std::to_string(expected[i])) == map.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+
+    // erased keys can be emplaced again.
+    REQUIRE(map.emplace("0", -1).second == (expected.front() != 0));
+    REQUIRE(map.find("0")->second == (expected.front() != 0 ? -1 : 0));
+}
+
+TEST_CASE("IndexedOrderedMap_Clear") {
+    indexed_map_t map;
+    for (int i = 0; i < large_map_size; i++) {
+        map.emplace(std::to_string(i), i);
+    }
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(map.find("0") == map.end());
+    REQUIRE(map.emplace("0", 1).second == true);
+    REQUIRE(map.at("0") == 1);
+}
+
+TEST_CASE("IndexedOrderedMap_CopyAndSwap") {
+    indexed_map_t map;
+    for (int i = 0; i < large_map_size; i++) {
+        map.emplace(std::to_string(i), i);
+    }
+    indexed_map_t copied = map;
+    REQUIRE(copied == map);
+    REQUIRE(copied.at("10") == 10);
+
+    indexed_map_t other {{"foo", 1}};
+    other.swap(copied);
+    REQUIRE(other == map);
+    REQUIRE(other.at("10") == 10);
+    REQUIRE(copied.size() == 1);
+    REQUIRE(copied.at("foo") == 1);
+    REQUIRE(copied != map);
+}
+
+TEST_CASE("IndexedOrderedMap_NodeKeys") {
+    indexed_node_t::mapping_type map;
+    for (int i = 0; i < large_map_size; i++) {
+        map.emplace(indexed_node_t(i), indexed_node_t(std::to_string(i)));
+    }
+
+    SUBCASE("scalar keys") {
+        map.emplace(indexed_node_t("foo"), indexed_node_t(true));
+        map.emplace(indexed_node_t(true), indexed_node_t(1));
+        map.emplace(indexed_node_t(), indexed_node_t(2));
+        REQUIRE(map.at(3).as_str() == "3");
+        REQUIRE(map.at("foo").as_bool() == true);
+        REQUIRE(map.at(true).as_int() == 1);
+        REQUIRE(map.at(nullptr).as_int() == 2);
+        REQUIRE(map.find(large_map_size) == map.end());
+    }
+
+    SUBCASE("non-indexable keys") {
+        map.emplace(indexed_node_t(3.14), indexed_node_t("float"));
+        map.emplace(indexed_node_t {1, 2}, indexed_node_t("seq"));
+        REQUIRE(map.at(3.14).as_str() == "float");
+        REQUIRE(map.at(indexed_node_t {1, 2}).as_str() == "seq");
+        REQUIRE(map.emplace(indexed_node_t {1, 2}, indexed_node_t()).second == false);
+
+        map.erase(map.find(3.14));
+        REQUIRE(map.find(3.14) == map.end());
+        REQUIRE(map.at(indexed_node_t {1, 2}).as_str() == "seq");
+        map.erase(map.begin());
+        REQUIRE(map.at(indexed_node_t {1, 2}).as_str() == "seq");
+        REQUIRE(map.at(3).as_str() == "3");
+    }
+
+    SUBCASE("alias keys") {
+        indexed_node_t anchor = "foo";
+        anchor.add_anchor_name("anchor");
+        map.emplace(anchor, indexed_node_t("anchor"));
+        REQUIRE(map.at("foo").as_str() == "anchor");
+        REQUIRE(map.emplace("foo", indexed_node_t()).second == false);
+
+        indexed_node_t alias = indexed_node_t::alias_of(anchor);
+        REQUIRE(map.at(alias).as_str() == "anchor");
+    }
+}
+
+TEST_CASE("IndexedOrderedMap_AsMappingType") {
+    std::string input;
+    for (int i = 0; i < large_map_size; i++) {
+        input += "key" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+    }
+
+    indexed_node_t root = indexed_node_t::deserialize(input);
+    REQUIRE(root.is_mapping());
+    REQUIRE(root.size() == static_cast<std::size_t>(large_map_size));
+    for (int i = 0; i < large_map_size; i++) {
+        REQUIRE(root.contains("key" + std::to_string(i)));
+        REQUIRE(root["key" + std::to_string(i)].as_int() == i);
+    }
+    REQUIRE_FALSE(root.contains("foo"));
+    REQUIRE(root.begin().key().as_str() == "key0");
+
+    REQUIRE_THROWS_AS(indexed_node_t::deserialize(input + "key0: dup\n"), fkyaml::parse_error);
+    REQUIRE(indexed_node_t::serialize(root) == input);
+}
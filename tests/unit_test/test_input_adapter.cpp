@@ -160,6 +160,12 @@ TEST_CASE("InputAdapter_StreamInputAdapterProvider") {
     }
 }
 
+TEST_CASE("InputAdapter_MappedFileInputAdapterProvider") {
+    fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data.txt");
+    auto input_adapter = fkyaml::detail::input_adapter(file);
+    REQUIRE(std::is_same<decltype(input_adapter), fkyaml::detail::iterator_input_adapter<const char*>>::value);
+}
+
 TEST_CASE("InputAdapter_EmptyInput") {
     SUBCASE("C-style char array") {
         char input[] = "";
@@ -276,6 +282,13 @@ TEST_CASE("InputAdapter_EmptyInput") {
         auto view = input_adapter.get_buffer_view();
         REQUIRE(view.empty());
     }
+
+    SUBCASE("mapped file") {
+        fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_empty.txt");
+        auto input_adapter = fkyaml::detail::input_adapter(file);
+        auto view = input_adapter.get_buffer_view();
+        REQUIRE(view.empty());
+    }
 }
 
 TEST_CASE("InputAdapter_GetBufferView_UTF8N") {
@@ -364,6 +377,24 @@ TEST_CASE("InputAdapter_GetBufferView_UTF8N") {
         REQUIRE(buffer[6] == char(0x80u));
         REQUIRE(buffer[7] == char(0x8Bu));
     }
+    SUBCASE("iterator_input_adapter with a mapped_file") {
+        fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8n.txt");
+        auto input_adapter = fkyaml::detail::input_adapter(file);
+
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+
+        REQUIRE(buffer.size() == 8);
+        REQUIRE(buffer[0] == 'a');
+        REQUIRE(buffer[1] == char(0xE3u));
+        REQUIRE(buffer[2] == char(0x81u));
+        REQUIRE(buffer[3] == char(0x82u));
+        REQUIRE(buffer[4] == char(0xF0u));
+        REQUIRE(buffer[5] == char(0xA0u));
+        REQUIRE(buffer[6] == char(0x80u));
+        REQUIRE(buffer[7] == char(0x8Bu));
+        // the contents without CRs must be viewed in place.
+        REQUIRE(buffer.begin() == file.data());
+    }
 }
 
 TEST_CASE("InputAdapter_GetBufferView_UTF8BOM") {
@@ -445,6 +476,22 @@ TEST_CASE("InputAdapter_GetBufferView_UTF8BOM") {
 
         fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
 
+        REQUIRE(buffer.size() == 8);
+        REQUIRE(buffer[0] == 'a');
+        REQUIRE(buffer[1] == char(0xE3u));
+        REQUIRE(buffer[2] == char(0x81u));
+        REQUIRE(buffer[3] == char(0x82u));
+        REQUIRE(buffer[4] == char(0xF0u));
+        REQUIRE(buffer[5] == char(0xA0u));
+        REQUIRE(buffer[6] == char(0x80u));
+        REQUIRE(buffer[7] == char(0x8Bu));
+    }
+    SUBCASE("iterator_input_adapter with a mapped_file") {
+        fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8bom.txt");
+        auto input_adapter = fkyaml::detail::input_adapter(file);
+
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+
         REQUIRE(buffer.size() == 8);
         REQUIRE(buffer[0] == 'a');
         REQUIRE(buffer[1] == char(0xE3u));
@@ -1988,6 +2035,24 @@ TEST_CASE("InputAdapter_GetBufferView_UTF8NewlineCodeNormalization") {
 
         fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
 
+        REQUIRE(buffer.size() == 10);
+        REQUIRE(buffer[0] == 't');
+        REQUIRE(buffer[1] == 'e');
+        REQUIRE(buffer[2] == 's');
+        REQUIRE(buffer[3] == 't');
+        REQUIRE(buffer[4] == '\n');
+        REQUIRE(buffer[5] == 'd');
+        REQUIRE(buffer[6] == 'a');
+        REQUIRE(buffer[7] == 't');
+        REQUIRE(buffer[8] == 'a');
+        REQUIRE(buffer[9] == '\n');
+    }
+    SUBCASE("iterator_input_adapter with a mapped_file") {
+        fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8_crlf.txt");
+        auto input_adapter = fkyaml::detail::input_adapter(file);
+
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+
         REQUIRE(buffer.size() == 10);
         REQUIRE(buffer[0] == 't');
         REQUIRE(buffer[1] == 'e');
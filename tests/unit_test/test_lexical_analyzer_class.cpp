@@ -693,6 +693,95 @@ TEST_CASE("LexicalAnalyzer_PlainScalar") {
     }
 }
 
+TEST_CASE("LexicalAnalyzer_LongPlainScalar") {
+    // plain scalars are scanned in blocks of characters, so delimiters are placed at every offset around the
+    // boundaries of those blocks.
+    fkyaml::detail::lexical_token token;
+    auto length = GENERATE(
+        std::size_t(15),
+        std::size_t(16),
+        std::size_t(17),
+        std::size_t(31),
+        std::size_t(32),
+        std::size_t(33),
+        std::size_t(47),
+        std::size_t(63),
+        std::size_t(64),
+        std::size_t(65),
+        std::size_t(100));
+    const std::string scalar(length, 'a');
+
+    SUBCASE("followed by a mapping value indicator") {
+        const std::string input = scalar + ": foo";
+        fkyaml::detail::lexical_analyzer lexer(input);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+        REQUIRE(token.str == fkyaml::detail::str_view(scalar));
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::KEY_SEPARATOR);
+    }
+
+    SUBCASE("followed by a comment") {
+        const std::string input = scalar + " # comment";
+        fkyaml::detail::lexical_analyzer lexer(input);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+        REQUIRE(token.str == fkyaml::detail::str_view(scalar));
+    }
+
+    SUBCASE("containing flow indicators in a block context") {
+        const std::string input = scalar + "[]{},bar";
+        fkyaml::detail::lexical_analyzer lexer(input);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+        REQUIRE(token.str == fkyaml::detail::str_view(input));
+    }
+
+    SUBCASE("followed by a flow indicator in a flow context") {
+        const std::string input = "[" + scalar + "]";
+        fkyaml::detail::lexical_analyzer lexer(input);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::SEQUENCE_FLOW_BEGIN);
+        lexer.set_context_state(true);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+        REQUIRE(token.str == fkyaml::detail::str_view(scalar));
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::SEQUENCE_FLOW_END);
+    }
+
+    SUBCASE("multiline with long indentation") {
+        const std::string input = "foo\n" + std::string(length, ' ') + scalar;
+        fkyaml::detail::lexical_analyzer lexer(input);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+        REQUIRE(token.str == fkyaml::detail::str_view(input));
+    }
+
+    SUBCASE("containing a multibyte character") {
+        const std::string input = scalar + "\xE3\x81\x82" + scalar;
+        fkyaml::detail::lexical_analyzer lexer(input);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+        REQUIRE(token.str == fkyaml::detail::str_view(input));
+    }
+
+    SUBCASE("containing an unescaped control character") {
+        const std::string input = scalar + '\x01' + scalar;
+        fkyaml::detail::lexical_analyzer lexer(input);
+        REQUIRE_THROWS_AS(lexer.get_next_token(), fkyaml::parse_error);
+    }
+}
+
 TEST_CASE("LexicalAnalyzer_SingleQuotedScalar") {
     using value_pair_t = std::pair<fkyaml::detail::str_view, uint32_t /*end offset*/>;
     auto value_pair = GENERATE(
@@ -1067,6 +1156,22 @@ TEST_CASE("LexicalAnalyzer_LiteralStringScalar") {
         REQUIRE(token.type == fkyaml::detail::lexical_token_t::END_OF_BUFFER);
     }
 
+    SUBCASE("literal string scalar whose first line has only one character") {
+        const char input[] = "|\n"
+                             "  a\n"
+                             "...\n";
+        fkyaml::detail::lexical_analyzer lexer(input);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::BLOCK_LITERAL_SCALAR);
+        REQUIRE(token.str.begin() == &input[2]);
+        REQUIRE(token.str.end() == &input[0] + 6);
+        REQUIRE(lexer.get_block_scalar_header().indent == 2);
+
+        REQUIRE_NOTHROW(token = lexer.get_next_token());
+        REQUIRE(token.type == fkyaml::detail::lexical_token_t::END_OF_DOCUMENT);
+    }
+
     SUBCASE("literal string scalar with implicit indentation and strip chomping") {
         const char input[] = "|-\n"
                              "\n"
@@ -0,0 +1,72 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <utility>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+// generated in test/unit_test/CMakeLists.txt
+#include <test_data.hpp>
+
+TEST_CASE("MappedFile_Ctor") {
+    SUBCASE("regular file") {
+        fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8_crlf.txt");
+        REQUIRE(file.size() == 12);
+        REQUIRE_FALSE(file.empty());
+        REQUIRE(std::string(file.data(), file.size()) == "test\r\ndata\r\n");
+#if FK_YAML_HAS_MMAP
+        REQUIRE(file.is_mapped());
+#endif
+    }
+
+    SUBCASE("empty file") {
+        fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_empty.txt");
+        REQUIRE(file.size() == 0);
+        REQUIRE(file.empty());
+        REQUIRE(file.data() != nullptr);
+        REQUIRE_FALSE(file.is_mapped());
+    }
+
+    SUBCASE("non-existent file") {
+        REQUIRE_THROWS_AS(fkyaml::mapped_file(FK_YAML_TEST_DATA_DIR "/non_existent_file.txt"), fkyaml::exception);
+    }
+}
+
+TEST_CASE("MappedFile_Move") {
+    fkyaml::mapped_file file(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8_crlf.txt");
+#if FK_YAML_HAS_MMAP
+    const char* p_data = file.data();
+#endif
+
+    fkyaml::mapped_file moved(std::move(file));
+    REQUIRE(file.empty());
+    REQUIRE(moved.size() == 12);
+    REQUIRE(std::string(moved.data(), moved.size()) == "test\r\ndata\r\n");
+#if FK_YAML_HAS_MMAP
+    // the mapped region must be handed over as is.
+    REQUIRE(moved.data() == p_data);
+#endif
+
+    fkyaml::mapped_file assigned(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_empty.txt");
+    assigned = std::move(moved);
+    REQUIRE(assigned.size() == 12);
+    REQUIRE(std::string(assigned.data(), assigned.size()) == "test\r\ndata\r\n");
+}
+
+TEST_CASE("MappedFile_Deserialize") {
+    fkyaml::node root = fkyaml::node::deserialize(
+        fkyaml::mapped_file(FK_YAML_TEST_DATA_DIR "/extraction_operator_test_data.yml"));
+    REQUIRE(root.is_mapping());
+    REQUIRE(root.size() == 3);
+    REQUIRE(root["foo"].as_int() == 123);
+    REQUIRE(root["bar"].is_null());
+    REQUIRE(root["baz"].as_bool() == true);
+}
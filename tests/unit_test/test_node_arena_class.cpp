@@ -0,0 +1,154 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("NodeArena_Allocate") {
+    fkyaml::node_arena arena(64);
+    REQUIRE(arena.allocated_bytes() == 0);
+
+    void* p1 = arena.allocate(3, 1);
+    void* p2 = arena.allocate(8, 8);
+    REQUIRE(p1 != nullptr);
+    REQUIRE(p2 != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p2) % 8 == 0);
+    REQUIRE(arena.allocated_bytes() == 11);
+
+    // larger than the current chunk.
+    void* p3 = arena.allocate(1024, 16);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(p3) % 16 == 0);
+    REQUIRE(arena.allocated_bytes() == 1035);
+
+    arena.release();
+    REQUIRE(arena.allocated_bytes() == 0);
+    REQUIRE(arena.allocate(4, 4) != nullptr);
+}
+
+TEST_CASE("NodeArena_ArenaScope") {
+    fkyaml::node_arena outer;
+    fkyaml::node_arena inner;
+
+    REQUIRE(fkyaml::arena_allocator<int>().arena() == nullptr);
+    {
+        fkyaml::arena_scope outer_scope(outer);
+        REQUIRE(fkyaml::arena_allocator<int>().arena() == &outer);
+        {
+            fkyaml::arena_scope inner_scope(inner);
+            REQUIRE(fkyaml::arena_allocator<int>().arena() == &inner);
+        }
+        REQUIRE(fkyaml::arena_allocator<int>().arena() == &outer);
+    }
+    REQUIRE(fkyaml::arena_allocator<int>().arena() == nullptr);
+}
+
+TEST_CASE("NodeArena_ArenaAllocator") {
+    fkyaml::node_arena arena;
+
+    SUBCASE("with an arena") {
+        fkyaml::arena_allocator<int> alloc(&arena);
+        int* p = alloc.allocate(4);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p) % alignof(int) == 0);
+        REQUIRE(arena.allocated_bytes() == 4 * sizeof(int));
+        alloc.deallocate(p, 4);
+        REQUIRE(arena.allocated_bytes() == 4 * sizeof(int));
+    }
+
+    SUBCASE("without arenas") {
+        fkyaml::arena_allocator<int> alloc(nullptr);
+        int* p = alloc.allocate(4);
+        REQUIRE(p != nullptr);
+        alloc.deallocate(p, 4);
+        REQUIRE(arena.allocated_bytes() == 0);
+    }
+
+    SUBCASE("comparison") {
+        fkyaml::arena_allocator<int> alloc(&arena);
+        fkyaml::arena_allocator<char> rebound(alloc);
+        REQUIRE(rebound.arena() == &arena);
+        REQUIRE(alloc == rebound);
+        REQUIRE(alloc != fkyaml::arena_allocator<int>(nullptr));
+    }
+}
+
+TEST_CASE("NodeArena_ArenaNode") {
+    const std::string input = "foo: bar\n"
+                              "seq:\n"
+                              "  - 123\n"
+                              "  - true\n"
+                              "  - 3.14\n"
+                              "  - a long string which never fits in the small string buffer\n"
+                              "map:\n"
+                              "  anchored: &anchor baz\n"
+                              "  alias: *anchor\n";
+
+    fkyaml::node_arena arena;
+
+    SUBCASE("deserialize and serialize in an arena scope") {
+        fkyaml::arena_scope scope(arena);
+        fkyaml::arena_node root = fkyaml::arena_node::deserialize(input);
+        REQUIRE(arena.allocated_bytes() > 0);
+
+        REQUIRE(root["foo"].as_str() == "bar");
+        REQUIRE(root["seq"].size() == 4);
+        REQUIRE(root["seq"][0].as_int() == 123);
+        REQUIRE(root["seq"][1].as_bool() == true);
+        REQUIRE(root["seq"][2].as_float() == 3.14);
+        REQUIRE(root["seq"][3].as_str() == "a long string which never fits in the small string buffer");
+        REQUIRE(root["seq"][3].as_str().get_allocator().arena() == &arena);
+        REQUIRE(root["map"]["alias"].as_str() == "baz");
+
+        REQUIRE(fkyaml::arena_node::serialize(root) == fkyaml::node::serialize(fkyaml::node::deserialize(input)));
+    }
+
+    SUBCASE("copy out of an arena scope") {
+        fkyaml::arena_node copied;
+        {
+            fkyaml::arena_scope scope(arena);
+            fkyaml::arena_node root = fkyaml::arena_node::deserialize(input);
+            copied = root;
+        }
+        // the copy has been made with the arena active, so it must be released before the arena.
+        REQUIRE(copied["seq"][3].as_str().get_allocator().arena() == &arena);
+
+        fkyaml::arena_node heap_copy = copied;
+        REQUIRE(heap_copy["seq"][3].as_str().get_allocator().arena() == nullptr);
+        REQUIRE(heap_copy == copied);
+
+        copied = nullptr;
+        arena.release();
+        REQUIRE(heap_copy["foo"].as_str() == "bar");
+        REQUIRE(heap_copy["seq"][3].as_str() == "a long string which never fits in the small string buffer");
+    }
+
+    SUBCASE("construct values from other arenas") {
+        const std::string expected(64, 'a');
+        fkyaml::arena_string str(expected.c_str(), fkyaml::arena_allocator<char>(&arena));
+        REQUIRE(str.get_allocator().arena() == &arena);
+
+        // the storage for a value is allocated with the allocator of the value itself.
+        fkyaml::arena_node node(std::move(str));
+        REQUIRE(node.as_str() == expected.c_str());
+        REQUIRE(node.as_str().get_allocator().arena() == &arena);
+    }
+}
+
+TEST_CASE("NodeArena_DefaultNodeNotAffected") {
+    fkyaml::node_arena arena;
+    fkyaml::arena_scope scope(arena);
+
+    fkyaml::node root = fkyaml::node::deserialize("foo: [1, 2, 3]\nbar: a long string which never fits in SSO\n");
+    REQUIRE(root["foo"].size() == 3);
+    REQUIRE(root["bar"].as_str() == "a long string which never fits in SSO");
+    REQUIRE(arena.allocated_bytes() == 0);
+}
@@ -6,8 +6,10 @@
 // SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <cmath>
 #include <cfloat>
+#include <cstdio>
 #include <deque>
 #include <fstream>
 #include <list>
@@ -30,6 +32,9 @@
 #include <string_view>
 #endif
 
+// tags, anchors and document metainfo are stored out of line so that nodes are kept compact.
+static_assert(sizeof(fkyaml::node) <= 24, "The size of fkyaml::node must not exceed 24 bytes.");
+
 //
 // test cases for constructors
 //
@@ -1058,6 +1063,141 @@ TEST_CASE("Node_DeserializeDocs_char8_t") {
 }
 #endif // FK_YAML_HAS_CHAR8_T
 
+TEST_CASE("Node_DeserializeWithLimits") {
+    fkyaml::deserialization_limits limits;
+    limits.max_depth = 2;
+    limits.max_aliases = 1;
+
+    SUBCASE("deserialize") {
+        fkyaml::node node = fkyaml::node::deserialize("foo: [&a 1, *a]", limits);
+        REQUIRE(node["foo"].size() == 2);
+
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize("foo: [[1]]", limits), fkyaml::limit_exceeded);
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize("foo: [&a 1, *a, *a]", limits), fkyaml::limit_exceeded);
+    }
+
+    SUBCASE("deserialize_docs") {
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs("[&a 1, *a]\n---\n[&a 2, *a]", limits);
+        REQUIRE(docs.size() == 2);
+
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_docs("[1]\n---\n[[[2]]]", limits), fkyaml::limit_exceeded);
+    }
+}
+
+TEST_CASE("Node_DeserializeBorrowed") {
+    SUBCASE("string scalars refer to the input") {
+        std::string input = "foo: bar\nbaz: [qux, 123]\n";
+        fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+        REQUIRE(root.is_mapping());
+        REQUIRE(root.size() == 2);
+        REQUIRE(root.contains("foo"));
+        REQUIRE(root["foo"].is_string());
+        REQUIRE(root["foo"].size() == 3);
+        REQUIRE(root["foo"] == fkyaml::node("bar"));
+        REQUIRE(root["baz"][1].get_value<int>() == 123);
+        REQUIRE(fkyaml::node::serialize(root) == "baz:\n  - qux\n  - 123\nfoo: bar\n");
+
+        // a copy keeps referring to the input.
+        fkyaml::node copied = root["foo"];
+        input[5] = 'B';
+        REQUIRE(copied.get_value<std::string>() == "Bar");
+    }
+
+    SUBCASE("as_str() makes an owned copy") {
+        std::string input = "foo";
+        fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+        std::string& str = root.as_str();
+        REQUIRE(str == "foo");
+        input[0] = 'F';
+        REQUIRE(root.as_str() == "foo");
+        str = "modified";
+        REQUIRE(root.as_str() == "modified");
+    }
+
+    SUBCASE("const access never modifies the node") {
+        std::string input = "[foo, bar]";
+        const fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+        REQUIRE(root[0].get_str_view() == "foo");
+        REQUIRE(root[0].get_value<std::string>() == "foo");
+        REQUIRE_THROWS_AS(root[0].as_str(), fkyaml::type_error);
+        REQUIRE_THROWS_AS(root.get_str_view(), fkyaml::type_error);
+
+        // the node still refers to the input after the calls above.
+        input[1] = 'F';
+        REQUIRE(root[0].get_str_view() == "Foo");
+        REQUIRE(root[0].get_value<std::string>() == "Foo");
+    }
+
+    SUBCASE("move a borrowed string") {
+        std::string input = "foo";
+        fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+        fkyaml::node moved = std::move(root);
+        REQUIRE(moved.get_str_view() == "foo");
+        REQUIRE(moved.as_str() == "foo");
+    }
+
+    SUBCASE("borrowed and owned strings have the same hash value") {
+        std::string input = "[foo, '']";
+        const fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+        std::hash<fkyaml::node> hasher;
+        REQUIRE(hasher(root[0]) == hasher(fkyaml::node("foo")));
+        REQUIRE(hasher(root[1]) == hasher(fkyaml::node("")));
+        REQUIRE(root[0].get_str_view() == "foo");
+    }
+
+    SUBCASE("scalars which need conversion are owned") {
+        std::string input = "- 'it''s'\n"
+                            "- \"a\\tb\"\n"
+                            "- multi\n"
+                            "  line\n"
+                            "- |\n"
+                            "  foo\n";
+        fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+        input.assign(input.size(), ' ');
+        REQUIRE(root[0].as_str() == "it's");
+        REQUIRE(root[1].as_str() == "a\tb");
+        REQUIRE(root[2].as_str() == "multi line");
+        REQUIRE(root[3].as_str() == "foo\n");
+    }
+
+    SUBCASE("inputs with CRLF newlines are copied") {
+        std::string input = "- foo\r\n- bar\r\n";
+        fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+        input.assign(input.size(), ' ');
+        REQUIRE(root[0].as_str() == "foo");
+        REQUIRE(root[1].as_str() == "bar");
+    }
+
+    SUBCASE("iterators") {
+        const char input[] = "- foo\n- bar\n";
+        fkyaml::node root = fkyaml::node::deserialize_borrowed(&input[0], &input[sizeof(input) - 1]);
+        REQUIRE(root.is_sequence());
+        REQUIRE(root.size() == 2);
+        REQUIRE(root[0].as_str() == "foo");
+        REQUIRE(root[1].as_str() == "bar");
+    }
+}
+
+TEST_CASE("Node_DeserializeDocsBorrowed") {
+    std::string input = "foo: bar\n"
+                        "--- baz\n";
+
+    SUBCASE("lvalue input") {
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_borrowed(input);
+        REQUIRE(docs.size() == 2);
+        REQUIRE(docs[0]["foo"].as_str() == "bar");
+        REQUIRE(docs[1].as_str() == "baz");
+    }
+
+    SUBCASE("iterators") {
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_borrowed(input.begin(), input.end());
+        REQUIRE(docs.size() == 2);
+        input[13] = 'c';
+        REQUIRE(docs[0]["foo"] < docs[1]);
+        REQUIRE(docs[1].as_str() == "caz");
+    }
+}
+
 TEST_CASE("Node_ExtractionOperator") {
     fkyaml::node node;
     std::ifstream ifs(FK_YAML_TEST_DATA_DIR "/extraction_operator_test_data.yml");
@@ -1208,6 +1348,78 @@ TEST_CASE("Node_SerializeDocs") {
     REQUIRE(fkyaml::node::serialize_docs(docs) == "foo: bar\n...\n123: true\n");
 }
 
+TEST_CASE("Node_SerializeToOutput") {
+    fkyaml::node node = fkyaml::node::deserialize("a: &anchor true\nb: *anchor\nfoo: [bar, {baz: 123}]");
+    const std::string expected = fkyaml::node::serialize(node);
+
+    SUBCASE("std::string") {
+        std::string str = "# appended\n";
+        fkyaml::node::serialize(node, str);
+        REQUIRE(str == "# appended\n" + expected);
+    }
+
+    SUBCASE("std::ostream") {
+        std::ostringstream oss;
+        fkyaml::node::serialize(node, oss);
+        REQUIRE(oss.str() == expected);
+    }
+
+    SUBCASE("FILE pointer") {
+        std::FILE* p_file = std::tmpfile();
+        REQUIRE(p_file != nullptr);
+        fkyaml::node::serialize(node, p_file);
+        std::rewind(p_file);
+        REQUIRE(fkyaml::node::deserialize(p_file) == node);
+        std::fclose(p_file);
+    }
+
+    SUBCASE("null FILE pointer") {
+        std::FILE* p_file = nullptr;
+        REQUIRE_THROWS_AS(fkyaml::node::serialize(node, p_file), fkyaml::exception);
+    }
+
+    SUBCASE("caller-provided buffer") {
+        char buffer[16] {};
+        std::string str;
+        std::size_t max_chunk_size = 0;
+        fkyaml::node::serialize(node, &buffer[0], sizeof(buffer), [&](const char* p_chars, std::size_t size) {
+            str.append(p_chars, size);
+            max_chunk_size = (std::max)(max_chunk_size, size);
+        });
+        REQUIRE(str == expected);
+        REQUIRE(max_chunk_size <= sizeof(buffer));
+    }
+
+    SUBCASE("invalid caller-provided buffer") {
+        char buffer[4] {};
+        auto flush = [](const char* /*unused*/, std::size_t /*unused*/) {};
+        REQUIRE_THROWS_AS(fkyaml::node::serialize(node, nullptr, 4, flush), fkyaml::exception);
+        REQUIRE_THROWS_AS(fkyaml::node::serialize(node, &buffer[0], 0, flush), fkyaml::exception);
+    }
+}
+
+TEST_CASE("Node_SerializeDocsToOutput") {
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs("foo: bar\n"
+                                                                    "...\n"
+                                                                    "123: true");
+    const std::string expected = "foo: bar\n...\n123: true\n";
+
+    SUBCASE("std::ostream") {
+        std::ostringstream oss;
+        fkyaml::node::serialize_docs(docs, oss);
+        REQUIRE(oss.str() == expected);
+    }
+
+    SUBCASE("caller-provided buffer") {
+        char buffer[3] {};
+        std::string str;
+        fkyaml::node::serialize_docs(docs, &buffer[0], sizeof(buffer), [&str](const char* p_chars, std::size_t size) {
+            str.append(p_chars, size);
+        });
+        REQUIRE(str == expected);
+    }
+}
+
 TEST_CASE("Node_InsertionOperator") {
     fkyaml::node node = {{"foo", 123}, {"bar", nullptr}, {"baz", true}};
     std::stringstream ss;
@@ -1367,6 +1579,18 @@ TEST_CASE("Node_AliasNodeFactory") {
         REQUIRE_THROWS_AS(anchor.size(), fkyaml::exception);
     }
 
+    SUBCASE("self-referential alias is added through a reference obtained beforehand") {
+        anchor = fkyaml::node::sequence();
+        anchor.add_anchor_name("anchor_name");
+        fkyaml::node alias = fkyaml::node::alias_of(anchor);
+        fkyaml::node::sequence_type& seq = anchor.as_seq();
+        REQUIRE(alias.size() == 0);
+        // the cached result of the cyclic reference check must be invalidated.
+        seq.emplace_back(fkyaml::node::alias_of(anchor));
+        REQUIRE_THROWS_AS(alias.size(), fkyaml::exception);
+        REQUIRE_THROWS_AS(anchor.size(), fkyaml::exception);
+    }
+
     SUBCASE("anchor contains an alias which is not self-referential") {
         anchor = fkyaml::node::sequence();
         anchor.add_anchor_name("anchor_name");
@@ -2815,6 +3039,85 @@ TEST_CASE("Node_At") {
     }
 }
 
+template <typename NodeType>
+static void test_lookup_with_string_like_keys() {
+    NodeType node = NodeType::mapping();
+    for (int i = 0; i < 20; i++) {
+        node[std::string("key") + std::to_string(i)] = i;
+    }
+    node[1] = "one";
+
+    SUBCASE("existing keys") {
+        const NodeType& const_node = node;
+        std::string str_key = "key10";
+        char buf[16] = "key11";
+        const char* p_key = "key12";
+
+        REQUIRE(node.contains(str_key));
+        REQUIRE(node.contains(buf));
+        REQUIRE(node.contains(p_key));
+        REQUIRE(node.contains("key13"));
+        REQUIRE(node.contains(1));
+
+        REQUIRE(node[str_key].template get_value<int>() == 10);
+        REQUIRE(const_node[buf].template get_value<int>() == 11);
+        REQUIRE(node.at(p_key).template get_value<int>() == 12);
+        REQUIRE(const_node.at("key13").template get_value<int>() == 13);
+        REQUIRE(const_node.at(1).template get_value<std::string>() == "one");
+        REQUIRE(node.size() == 21);
+    }
+
+    SUBCASE("missing keys") {
+        REQUIRE_FALSE(node.contains("key"));
+        REQUIRE_FALSE(node.contains(std::string("key1\0", 5)));
+        REQUIRE_FALSE(node.contains(2));
+        REQUIRE_THROWS_AS(node.at("key20"), fkyaml::out_of_range);
+        try {
+            node.at("key20");
+        }
+        catch (const fkyaml::out_of_range& e) {
+            REQUIRE(std::string(e.what()) == "out_of_range: key 'key20' is not found.");
+        }
+        REQUIRE_THROWS_AS(node.at(2), fkyaml::out_of_range);
+    }
+
+    SUBCASE("inserted keys outlive the given keys") {
+        {
+            std::string key(32, 'x');
+            node[key] = 123;
+            key.assign(32, 'y');
+            node[key.c_str()] = 456;
+        }
+        REQUIRE(node.size() == 23);
+        REQUIRE(node.at(std::string(32, 'x')).template get_value<int>() == 123);
+        REQUIRE(node.at(std::string(32, 'y')).template get_value<int>() == 456);
+
+        auto itr = node.begin();
+        std::advance(itr, 21);
+        REQUIRE(itr.key().as_str() == std::string(32, 'x'));
+    }
+
+    SUBCASE("keys of other types") {
+        REQUIRE_FALSE(node.contains("1"));
+        REQUIRE_FALSE(node.contains(nullptr));
+        REQUIRE_FALSE(node.contains(true));
+    }
+}
+
+TEST_CASE("Node_LookupWithStringLikeKeys") {
+    SUBCASE("std::map") {
+        test_lookup_with_string_like_keys<fkyaml::node>();
+    }
+
+    SUBCASE("ordered_map") {
+        test_lookup_with_string_like_keys<fkyaml::basic_node<std::vector, fkyaml::ordered_map>>();
+    }
+
+    SUBCASE("indexed_ordered_map") {
+        test_lookup_with_string_like_keys<fkyaml::basic_node<std::vector, fkyaml::indexed_ordered_map>>();
+    }
+}
+
 //
 // test cases for YAML version property getter/setter
 //
@@ -2836,6 +3139,19 @@ TEST_CASE("Node_GetYamlVersionType") {
     REQUIRE(node.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_1);
 }
 
+TEST_CASE("Node_YamlVersionTypeInDocument") {
+    fkyaml::node root = fkyaml::node::deserialize("%YAML 1.1\n---\nfoo: [bar, {baz: 123}]");
+    fkyaml::node& bar_node = root["foo"][0];
+    fkyaml::node& baz_node = root["foo"][1]["baz"];
+    REQUIRE(bar_node.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_1);
+    REQUIRE(baz_node.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_1);
+
+    // all the nodes in a document share the same version.
+    root.set_yaml_version_type(fkyaml::yaml_version_type::VERSION_1_2);
+    REQUIRE(bar_node.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_2);
+    REQUIRE(baz_node.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_2);
+}
+
 TEST_CASE("Node_SetYamlVersion(deprecated)") {
     fkyaml::node node;
     node.set_yaml_version(fkyaml::node::yaml_version_t::VER_1_1);
@@ -2956,6 +3272,45 @@ TEST_CASE("Node_AddAnchorName") {
         REQUIRE_FALSE(node.get_anchor_name().compare("anchor_name") == 0);
         REQUIRE(node.get_anchor_name().compare("overwritten_name") == 0);
     }
+
+    SUBCASE("overwrite an existing anchor name referenced by other aliases") {
+        fkyaml::node root = fkyaml::node::deserialize("- &anchor_name 1\n- &anchor_name 2\n- *anchor_name\n");
+        root[0].add_anchor_name("overwritten_name");
+        REQUIRE(root[0].get_anchor_name().compare("overwritten_name") == 0);
+        REQUIRE(root[0].get_value<int>() == 1);
+        REQUIRE(root[1].get_value<int>() == 2);
+        REQUIRE(root[2].get_value<int>() == 2);
+    }
+
+    SUBCASE("overwrite an anchor name referenced by an alias") {
+        fkyaml::node root = fkyaml::node::deserialize("- &anchor_name [1, 2]\n- *anchor_name\n");
+        root[0].add_anchor_name("overwritten_name");
+        REQUIRE(root[0].get_anchor_name().compare("overwritten_name") == 0);
+        REQUIRE(root[0].size() == 2);
+        REQUIRE(root[0][1].get_value<int>() == 2);
+        REQUIRE_THROWS_AS(root[1].size(), fkyaml::exception);
+        REQUIRE_THROWS_AS(fkyaml::node(root[1]).as_seq(), fkyaml::exception);
+
+        // aliases to the new anchor name are resolved as usual.
+        root.as_seq().emplace_back(fkyaml::node::alias_of(root[0]));
+        REQUIRE(root[2].size() == 2);
+
+        // the released entry is erased once the stale alias is gone.
+        root.as_seq().erase(root.as_seq().begin() + 1);
+        root[0].add_anchor_name("anchor_name");
+        REQUIRE(root[0].size() == 2);
+        REQUIRE_THROWS_AS(root[1].size(), fkyaml::exception);
+    }
+
+    SUBCASE("overwrite an anchor name repeatedly") {
+        fkyaml::node node = fkyaml::node::mapping({{"foo", "bar"}});
+        for (int i = 0; i < 100; i++) {
+            node.add_anchor_name(i % 2 ? "odd" : "even");
+            fkyaml::node alias = fkyaml::node::alias_of(node);
+            REQUIRE(alias["foo"].as_str() == "bar");
+        }
+        REQUIRE(node.get_anchor_name().compare("odd") == 0);
+    }
 }
 
 //
@@ -3049,6 +3404,33 @@ TEST_CASE("Node_AddTagName") {
     }
 }
 
+TEST_CASE("Node_PropertiesOfCopiedNodes") {
+    fkyaml::node root = fkyaml::node::deserialize("%TAG !e! tag:example.com,2000:\n---\nfoo: [bar, baz]");
+
+    SUBCASE("tag names are not shared among copies") {
+        fkyaml::node copied = root["foo"][0];
+        copied.add_tag_name("!e!copied");
+        REQUIRE(copied.get_tag_name() == "!e!copied");
+        REQUIRE_FALSE(root["foo"][0].has_tag_name());
+        REQUIRE_FALSE(root["foo"][1].has_tag_name());
+
+        fkyaml::node copied_again = copied;
+        copied_again.add_tag_name("!e!copied_again");
+        REQUIRE(copied.get_tag_name() == "!e!copied");
+        REQUIRE(copied_again.get_tag_name() == "!e!copied_again");
+    }
+
+    SUBCASE("document metainfo is still shared with tagged nodes") {
+        fkyaml::node& bar = root["foo"][0];
+        bar.add_tag_name("!e!bar");
+        REQUIRE(bar.get_resolved_tag_name() == "tag:example.com,2000:bar");
+
+        root.set_yaml_version_type(fkyaml::yaml_version_type::VERSION_1_1);
+        REQUIRE(bar.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_1);
+        REQUIRE(root["foo"][1].get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_1);
+    }
+}
+
 //
 // test cases for value getters (copy)
 //
@@ -5584,6 +5966,110 @@ TEST_CASE("Node_MapItems") {
 #endif
 }
 
+//
+// test cases for copy-on-write
+//
+
+TEST_CASE("Node_EnableCopyOnWrite") {
+    fkyaml::node node = fkyaml::node::deserialize(
+        "seq: [1, 2, {foo: bar}]\n"
+        "map: {baz: a string value which is long enough to be allocated}\n"
+        "anchor: &anchor [true, false]\n"
+        "alias: *anchor\n");
+    const fkyaml::node expected = node;
+    node.enable_copy_on_write();
+    REQUIRE(node == expected);
+
+    SUBCASE("copies share values") {
+        const fkyaml::node copy = node;
+        const fkyaml::node& const_node = node;
+        REQUIRE(copy == expected);
+        REQUIRE(&copy.as_map() == &const_node.as_map());
+        REQUIRE(&copy["seq"].as_seq() == &const_node["seq"].as_seq());
+        REQUIRE(&copy["map"]["baz"].as_str() == &const_node["map"]["baz"].as_str());
+    }
+
+    SUBCASE("modification copies only the modified path") {
+        fkyaml::node copy = node;
+        copy["seq"][2]["foo"] = "qux";
+
+        const fkyaml::node& const_node = node;
+        const fkyaml::node& const_copy = copy;
+        REQUIRE(node == expected);
+        REQUIRE(const_copy["seq"][2]["foo"].as_str() == "qux");
+        REQUIRE(&const_copy.as_map() != &const_node.as_map());
+        REQUIRE(&const_copy["seq"].as_seq() != &const_node["seq"].as_seq());
+        REQUIRE(&const_copy["map"].as_map() == &const_node["map"].as_map());
+    }
+
+    SUBCASE("modification through as_seq(), as_map() and as_str()") {
+        fkyaml::node copy = node;
+        copy["seq"].as_seq().emplace_back(3);
+        copy["map"].as_map().emplace("new", "entry");
+        copy["map"]["baz"].as_str() += "!";
+
+        REQUIRE(node == expected);
+        REQUIRE(copy["seq"].size() == 4);
+        REQUIRE(copy["map"].size() == 2);
+        REQUIRE(copy["map"]["baz"].as_str() == "a string value which is long enough to be allocated!");
+    }
+
+    SUBCASE("modification of the original node") {
+        fkyaml::node copy = node;
+        node["seq"][0] = 100;
+        node.erase("anchor");
+        REQUIRE(copy == expected);
+        REQUIRE(node["seq"][0].as_int() == 100);
+        REQUIRE_FALSE(node.contains("anchor"));
+    }
+
+    SUBCASE("unique values are modified in place") {
+        const fkyaml::node& const_node = node;
+        const fkyaml::node::sequence_type* p_seq = &const_node["seq"].as_seq();
+        node["seq"].as_seq().emplace_back(nullptr);
+        REQUIRE(&const_node["seq"].as_seq() == p_seq);
+    }
+
+    SUBCASE("destruction of copies") {
+        {
+            fkyaml::node copy1 = node;
+            fkyaml::node copy2 = copy1;
+            copy2["seq"][1] = 200;
+        }
+        REQUIRE(node == expected);
+    }
+
+    SUBCASE("assignment to shared nodes") {
+        fkyaml::node copy = node;
+        copy["seq"] = 123;
+        copy["map"]["baz"] = false;
+        REQUIRE(node == expected);
+        REQUIRE(copy["seq"].as_int() == 123);
+        REQUIRE(copy["map"]["baz"].as_bool() == false);
+    }
+
+    SUBCASE("enable copy-on-write again") {
+        fkyaml::node copy = node;
+        copy.enable_copy_on_write();
+        node.enable_copy_on_write();
+        node["seq"].as_seq().emplace_back("new");
+        REQUIRE(copy == expected);
+        REQUIRE(node["seq"].size() == 4);
+    }
+
+    SUBCASE("scalar nodes") {
+        fkyaml::node str = "string";
+        str.enable_copy_on_write();
+        fkyaml::node copy = str;
+        copy.as_str() = "modified";
+        REQUIRE(str.as_str() == "string");
+
+        fkyaml::node integer = 123;
+        integer.enable_copy_on_write();
+        REQUIRE(integer.as_int() == 123);
+    }
+}
+
 //
 // test cases for swap
 //
@@ -0,0 +1,143 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+// records each chunk written to it.
+class chunk_recorder final : public fkyaml::detail::output_adapter_base {
+public:
+    void write(const char* p_chars, std::size_t size) override {
+        chunks.emplace_back(p_chars, size);
+    }
+
+    std::string joined() const {
+        std::string ret;
+        for (const auto& chunk : chunks) {
+            ret += chunk;
+        }
+        return ret;
+    }
+
+    std::vector<std::string> chunks;
+};
+
+} // namespace
+
+TEST_CASE("OutputAdapter_StringOutputAdapter") {
+    std::string str = "foo";
+    auto adapter = fkyaml::detail::output_adapter(str);
+    REQUIRE(std::is_same<decltype(adapter), fkyaml::detail::string_output_adapter>::value);
+    adapter.write("bar", 3);
+    REQUIRE(str == "foobar");
+}
+
+TEST_CASE("OutputAdapter_StreamOutputAdapter") {
+    std::ostringstream oss;
+    auto adapter = fkyaml::detail::output_adapter(oss);
+    REQUIRE(std::is_same<decltype(adapter), fkyaml::detail::stream_output_adapter>::value);
+    adapter.write("foo", 3);
+    adapter.write("bar", 2);
+    REQUIRE(oss.str() == "fooba");
+}
+
+TEST_CASE("OutputAdapter_FileOutputAdapter") {
+    SUBCASE("valid file handle") {
+        std::FILE* p_file = std::tmpfile();
+        REQUIRE(p_file != nullptr);
+        auto adapter = fkyaml::detail::output_adapter(p_file);
+        REQUIRE(std::is_same<decltype(adapter), fkyaml::detail::file_output_adapter>::value);
+        adapter.write("foo", 3);
+
+        std::rewind(p_file);
+        char buffer[4] {};
+        REQUIRE(std::fread(&buffer[0], sizeof(char), 3, p_file) == 3);
+        REQUIRE(std::string(&buffer[0]) == "foo");
+        std::fclose(p_file);
+    }
+
+    SUBCASE("null file handle") {
+        std::FILE* p_file = nullptr;
+        REQUIRE_THROWS_AS(fkyaml::detail::output_adapter(p_file), fkyaml::exception);
+    }
+}
+
+TEST_CASE("OutputAdapter_CallbackOutputAdapter") {
+    std::string str;
+    auto flush = [&str](const char* p_chars, std::size_t size) { str.append(p_chars, size); };
+    fkyaml::detail::callback_output_adapter<decltype(flush)> adapter(flush);
+    adapter.write("foo", 3);
+    REQUIRE(str == "foo");
+}
+
+TEST_CASE("OutputWriter_Append") {
+    chunk_recorder recorder;
+    char buffer[4] {};
+
+    SUBCASE("chunks never exceed the buffer size") {
+        {
+            fkyaml::detail::output_writer writer(recorder, &buffer[0], sizeof(buffer));
+            writer += "foo";
+            writer += ':';
+            writer += std::string(" bar");
+            writer.append(6, ' ');
+            writer += '\n';
+            writer.flush();
+        }
+        REQUIRE(recorder.joined() == "foo: bar      \n");
+        for (const auto& chunk : recorder.chunks) {
+            REQUIRE(chunk.size() <= sizeof(buffer));
+        }
+    }
+
+    SUBCASE("characters larger than the buffer are written directly") {
+        fkyaml::detail::output_writer writer(recorder, &buffer[0], sizeof(buffer));
+        writer += "ab";
+        writer += "0123456789";
+        writer += "c";
+        writer.flush();
+        REQUIRE(recorder.chunks == std::vector<std::string> {"ab", "0123456789", "c"});
+    }
+
+    SUBCASE("nothing is written without characters") {
+        fkyaml::detail::output_writer writer(recorder, &buffer[0], sizeof(buffer));
+        writer.flush();
+        REQUIRE(recorder.chunks.empty());
+    }
+}
+
+TEST_CASE("OutputWriter_Column") {
+    chunk_recorder recorder;
+    char buffer[4] {};
+    fkyaml::detail::output_writer writer(recorder, &buffer[0], sizeof(buffer));
+    REQUIRE(writer.column() == 0);
+
+    writer += "foo";
+    REQUIRE(writer.column() == 3);
+
+    // the column is kept across flushes.
+    writer += "bar";
+    REQUIRE(writer.column() == 6);
+
+    writer += "baz\nq";
+    REQUIRE(writer.column() == 1);
+
+    writer += "0123456789";
+    REQUIRE(writer.column() == 11);
+
+    writer += '\n';
+    REQUIRE(writer.column() == 0);
+}
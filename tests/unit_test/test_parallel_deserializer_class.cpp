@@ -0,0 +1,218 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("ParallelDeserializer_SplitIntoDocuments") {
+    using fkyaml::detail::split_into_documents;
+    using fkyaml::detail::str_view;
+
+    SUBCASE("documents separated by directives end markers") {
+        const std::string input = "foo: 1\n---\nbar: 2\n--- baz\n";
+        const std::vector<str_view> chunks = split_into_documents(input, 0);
+        REQUIRE(chunks.size() == 3);
+        REQUIRE(chunks[0] == "foo: 1\n");
+        REQUIRE(chunks[1] == "---\nbar: 2\n");
+        REQUIRE(chunks[2] == "--- baz\n");
+    }
+
+    SUBCASE("directives and comments after document end markers") {
+        const std::string input = "foo: 1\n...\n# comment\n%YAML 1.2\n---\nbar: 2\n";
+        const std::vector<str_view> chunks = split_into_documents(input, 0);
+        REQUIRE(chunks.size() == 1);
+        REQUIRE(chunks[0] == str_view(input));
+    }
+
+    SUBCASE("empty documents between directives end markers") {
+        const std::string input = "---\n--- # comment\n---\nfoo\n---\nbar";
+        const std::vector<str_view> chunks = split_into_documents(input, 0);
+        REQUIRE(chunks.size() == 2);
+        REQUIRE(chunks[0] == "---\n--- # comment\n---\nfoo\n");
+        REQUIRE(chunks[1] == "---\nbar");
+    }
+
+    SUBCASE("markers not at the beginning of lines") {
+        const std::string input = "foo: |\n  ---\n  ...\nbar: ---foo\n";
+        const std::vector<str_view> chunks = split_into_documents(input, 0);
+        REQUIRE(chunks.size() == 1);
+        REQUIRE(chunks[0] == str_view(input));
+    }
+
+    SUBCASE("indented directives after document end markers") {
+        const std::string input = "foo: 1\n...\n  %YAML 1.2\n---\nbar: 2\n";
+        const std::vector<str_view> chunks = split_into_documents(input, 0);
+        REQUIRE(chunks.size() == 1);
+        REQUIRE(chunks[0] == str_view(input));
+    }
+
+    SUBCASE("document markers followed by %") {
+        auto input = GENERATE(std::string("foo\n--- %bar\n---\nbaz\n"), std::string("foo\n... %bar\n---\nbaz\n"));
+        const std::vector<str_view> chunks = split_into_documents(input, 0);
+        REQUIRE(chunks.size() == 1);
+        REQUIRE(chunks[0] == str_view(input));
+    }
+
+    SUBCASE("small documents put together") {
+        const std::string input = "---\na\n---\nb\n---\nc\n---\nd\n";
+        const std::vector<str_view> chunks = split_into_documents(input, 10);
+        REQUIRE(chunks.size() == 2);
+        REQUIRE(chunks[0] == "---\na\n---\nb\n");
+        REQUIRE(chunks[1] == "---\nc\n---\nd\n");
+    }
+
+    SUBCASE("empty input") {
+        const std::vector<str_view> chunks = split_into_documents(str_view(""), 0);
+        REQUIRE(chunks.size() == 1);
+        REQUIRE(chunks[0].empty());
+    }
+}
+
+TEST_CASE("ParallelDeserializer_DeserializeDocs") {
+    std::string input = "%YAML 1.2\n---\nfirst: &anchor 1\nalias: *anchor\n...\n";
+    for (int i = 0; i < 200; i++) {
+        input += "--- !!map\nid: " + std::to_string(i) + "\nitems: [a, b]\ntext: |\n  line\n";
+    }
+    input += "...\n%TAG !e! tag:example.com,2000:\n---\n!e!foo last\n...\n# trailing comment\n";
+
+    const std::vector<fkyaml::node> expected = fkyaml::node::deserialize_docs(input);
+    REQUIRE(expected.size() == 202);
+
+    auto num_threads = GENERATE(std::size_t(0), std::size_t(1), std::size_t(2), std::size_t(8));
+    std::vector<fkyaml::node> docs {};
+    REQUIRE_NOTHROW(docs = fkyaml::node::deserialize_docs_parallel(input, num_threads));
+    REQUIRE(docs == expected);
+    REQUIRE(docs[0]["alias"].get_value<int>() == 1);
+    REQUIRE(docs[1]["id"].get_value<int>() == 0);
+    REQUIRE(docs[200]["id"].get_value<int>() == 199);
+    REQUIRE(docs[201].get_tag_name() == "!e!foo");
+}
+
+TEST_CASE("ParallelDeserializer_SameResultsAsDeserializeDocs") {
+    SUBCASE("valid inputs") {
+        auto input = GENERATE(
+            std::string("foo: |\n  a\n---\nbar: 1\n"),
+            std::string("- >\n  a\n---\n- b\n"),
+            std::string("foo\n--- %bar\n---\nbaz\n"),
+            std::string("foo\n...\n  %YAML 1.2\n---\nbar\n"),
+            std::string("!!str\nfoo\n---\nbar: baz\n"));
+
+        const std::vector<fkyaml::node> expected = fkyaml::node::deserialize_docs(input);
+        std::vector<fkyaml::node> docs {};
+        REQUIRE_NOTHROW(docs = fkyaml::node::deserialize_docs_parallel(input, 8));
+        REQUIRE(docs == expected);
+    }
+
+    SUBCASE("invalid inputs") {
+        // chunks which end in the middle of a node must not be accepted on their own.
+        auto input = GENERATE(
+            std::string("{\n---\nfoo"),
+            std::string("[\n---\n..."),
+            std::string("|\n---\n# c\ncorge"),
+            std::string("foo: [bar,\n---\nbaz\n"));
+
+        std::string expected_msg {};
+        try {
+            fkyaml::node::deserialize_docs(input);
+        }
+        catch (const fkyaml::parse_error& e) {
+            expected_msg = e.what();
+        }
+        REQUIRE_FALSE(expected_msg.empty());
+
+        std::string msg {};
+        try {
+            fkyaml::node::deserialize_docs_parallel(input, 8);
+        }
+        catch (const fkyaml::parse_error& e) {
+            msg = e.what();
+        }
+        REQUIRE(msg == expected_msg);
+    }
+}
+
+TEST_CASE("ParallelDeserializer_EmptyInput") {
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(std::string(""), 4);
+    REQUIRE(docs.size() == 1);
+    REQUIRE(docs[0].is_null());
+}
+
+TEST_CASE("ParallelDeserializer_ParseError") {
+    std::string input;
+    for (int i = 0; i < 100; i++) {
+        input += "---\nfoo: " + std::to_string(i) + "\n";
+    }
+    input += "---\nfoo: [bar\n";
+    for (int i = 0; i < 100; i++) {
+        input += "---\nbar: {baz\n";
+    }
+
+    std::string expected_msg {};
+    try {
+        fkyaml::node::deserialize_docs(input);
+    }
+    catch (const fkyaml::parse_error& e) {
+        expected_msg = e.what();
+    }
+    REQUIRE_FALSE(expected_msg.empty());
+
+    std::string msg {};
+    try {
+        fkyaml::node::deserialize_docs_parallel(input, 4);
+    }
+    catch (const fkyaml::parse_error& e) {
+        msg = e.what();
+    }
+    REQUIRE(msg == expected_msg);
+}
+
+TEST_CASE("ParallelDeserializer_Limits") {
+    fkyaml::deserialization_limits limits;
+    limits.max_depth = 2;
+    limits.max_aliases = 1;
+
+    std::string input;
+    for (int i = 0; i < 100; i++) {
+        input += "---\nfoo: [&a 1, *a]\n";
+    }
+
+    auto num_threads = GENERATE(std::size_t(1), std::size_t(4));
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(input, limits, num_threads);
+    REQUIRE(docs.size() == 100);
+    REQUIRE(docs[99]["foo"].size() == 2);
+
+    // each document exceeding the limits is rejected on any thread.
+    REQUIRE_THROWS_AS(
+        fkyaml::node::deserialize_docs_parallel(input + "---\nfoo: [[1]]\n", limits, num_threads),
+        fkyaml::limit_exceeded);
+    REQUIRE_THROWS_AS(
+        fkyaml::node::deserialize_docs_parallel("foo: [&a 1, *a, *a]\n" + input, limits, num_threads),
+        fkyaml::limit_exceeded);
+}
+
+TEST_CASE("ParallelDeserializer_ActiveArena") {
+    std::string input;
+    for (int i = 0; i < 100; i++) {
+        input += "---\n- foo\n- bar\n";
+    }
+
+    fkyaml::node_arena arena;
+    std::vector<fkyaml::node> docs {};
+    {
+        fkyaml::arena_scope scope(arena);
+        docs = fkyaml::node::deserialize_docs_parallel(input, 4);
+    }
+
+    REQUIRE(arena.allocated_bytes() == 0);
+    REQUIRE(docs.size() == 100);
+    REQUIRE(docs[99][1].get_value<std::string>() == "bar");
+}
@@ -0,0 +1,240 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+static const std::string path_test_input = "spec:\n"
+                                           "  containers:\n"
+                                           "    - name: web\n"
+                                           "      image: nginx\n"
+                                           "      ports: [80, 443]\n"
+                                           "    - name: sidecar\n"
+                                           "      image: envoy\n"
+                                           "  responses:\n"
+                                           "    200: ok\n"
+                                           "    \"404\": not found\n"
+                                           "  a/b: &anchor {c~d: 1, \"x.y\": 2}\n"
+                                           "ref: *anchor\n"
+                                           "\"\": empty\n";
+
+TEST_CASE("Path_Ctor") {
+    SUBCASE("root") {
+        REQUIRE(fkyaml::path().empty());
+        REQUIRE(fkyaml::path("").empty());
+        REQUIRE(fkyaml::path("").to_json_pointer().empty());
+    }
+
+    SUBCASE("JSON Pointer") {
+        fkyaml::path p("/spec/containers/0/image");
+        REQUIRE(p.size() == 4);
+        REQUIRE(p.to_json_pointer() == "/spec/containers/0/image");
+
+        REQUIRE(fkyaml::path("/").size() == 1);
+        REQUIRE(fkyaml::path("/a//b/").size() == 4);
+        REQUIRE(fkyaml::path("/a~1b/c~0d").size() == 2);
+        REQUIRE(fkyaml::path("/a~1b/c~0d").to_json_pointer() == "/a~1b/c~0d");
+        REQUIRE(fkyaml::path("/~01").to_json_pointer() == "/~01");
+    }
+
+    SUBCASE("dotted path") {
+        fkyaml::path p("spec.containers[0].image");
+        REQUIRE(p.size() == 4);
+        REQUIRE(p.to_json_pointer() == "/spec/containers/0/image");
+
+        REQUIRE(fkyaml::path("[0]").to_json_pointer() == "/0");
+        REQUIRE(fkyaml::path("[0][1].a").to_json_pointer() == "/0/1/a");
+        REQUIRE(fkyaml::path("a/b.c~d").to_json_pointer() == "/a~1b/c~0d");
+    }
+
+    SUBCASE("invalid JSON Pointers") {
+        auto expr = GENERATE(std::string("/~"), std::string("/a~2"), std::string("/a~/b"));
+        REQUIRE_THROWS_AS(fkyaml::path(expr), fkyaml::invalid_path);
+    }
+
+    SUBCASE("invalid dotted paths") {
+        auto expr = GENERATE(
+            std::string("."),
+            std::string("a."),
+            std::string(".a"),
+            std::string("a..b"),
+            std::string("a.[0]"),
+            std::string("a[]"),
+            std::string("a[-1]"),
+            std::string("a[0"),
+            std::string("a[x]"),
+            std::string("a[0]b"));
+        REQUIRE_THROWS_AS(fkyaml::path(expr), fkyaml::invalid_path);
+    }
+}
+
+TEST_CASE("Path_At") {
+    fkyaml::node root = fkyaml::node::deserialize(path_test_input);
+    const fkyaml::node& const_root = root;
+
+    SUBCASE("root") {
+        REQUIRE(&root.at(fkyaml::path()) == &root);
+        REQUIRE(&const_root.at(fkyaml::path()) == &root);
+    }
+
+    SUBCASE("existing nodes") {
+        REQUIRE(root.at(fkyaml::path("spec.containers[0].image")).as_str() == "nginx");
+        REQUIRE(root.at(fkyaml::path("/spec/containers/1/name")).as_str() == "sidecar");
+        REQUIRE(const_root.at(fkyaml::path("spec.containers.0.ports[1]")).get_value<int>() == 443);
+        REQUIRE(const_root.at(fkyaml::path("/")).as_str() == "empty");
+        REQUIRE(&const_root.at(fkyaml::path("spec.containers")) == &const_root["spec"]["containers"]);
+    }
+
+    SUBCASE("keys with special characters") {
+        REQUIRE(root.at(fkyaml::path("/spec/a~1b/c~0d")).get_value<int>() == 1);
+        REQUIRE(root.at(fkyaml::path("/spec/a~1b/x.y")).get_value<int>() == 2);
+        REQUIRE(root.at(fkyaml::path("spec.a/b.c~d")).get_value<int>() == 1);
+    }
+
+    SUBCASE("integer and string keys") {
+        REQUIRE(root.at(fkyaml::path("spec.responses[200]")).as_str() == "ok");
+        REQUIRE(root.at(fkyaml::path("spec.responses.404")).as_str() == "not found");
+        REQUIRE(root.at(fkyaml::path("/spec/responses/404")).as_str() == "not found");
+
+        // each segment looks up either the integer key or the string key.
+        REQUIRE_THROWS_AS(root.at(fkyaml::path("spec.responses.200")), fkyaml::out_of_range);
+        REQUIRE_THROWS_AS(root.at(fkyaml::path("/spec/responses/200")), fkyaml::out_of_range);
+        REQUIRE_THROWS_AS(root.at(fkyaml::path("spec.responses[404]")), fkyaml::out_of_range);
+        REQUIRE_THROWS_AS(root.at(fkyaml::path("spec.responses[99999999999]")), fkyaml::out_of_range);
+    }
+
+    SUBCASE("aliases") {
+        REQUIRE(const_root.at(fkyaml::path("ref.c~d")).get_value<int>() == 1);
+        REQUIRE(&const_root.at(fkyaml::path("ref.c~d")) == &const_root.at(fkyaml::path("/spec/a~1b/c~0d")));
+    }
+
+    SUBCASE("missing nodes") {
+        REQUIRE_THROWS_AS(root.at(fkyaml::path("spec.volumes")), fkyaml::out_of_range);
+        REQUIRE_THROWS_AS(const_root.at(fkyaml::path("spec.containers[2]")), fkyaml::out_of_range);
+        REQUIRE_THROWS_AS(const_root.at(fkyaml::path("spec.responses.500")), fkyaml::out_of_range);
+        REQUIRE_THROWS_AS(const_root.at(fkyaml::path("spec.containers.web")), fkyaml::type_error);
+        REQUIRE_THROWS_AS(const_root.at(fkyaml::path("spec.containers[0].image.tag")), fkyaml::type_error);
+
+        try {
+            root.at(fkyaml::path("spec.containers[0].command"));
+        }
+        catch (const fkyaml::out_of_range& e) {
+            REQUIRE(std::string(e.what()) == "out_of_range: key 'command' is not found.");
+        }
+    }
+
+    SUBCASE("modification") {
+        root.at(fkyaml::path("spec.containers[1].image")) = "envoy:v2";
+        REQUIRE(root["spec"]["containers"][1]["image"].as_str() == "envoy:v2");
+    }
+}
+
+TEST_CASE("Path_Find") {
+    fkyaml::node root = fkyaml::node::deserialize(path_test_input);
+    const fkyaml::node& const_root = root;
+
+    SUBCASE("root") {
+        REQUIRE(root.find(fkyaml::path()) == &root);
+        REQUIRE(const_root.find(fkyaml::path()) == &root);
+    }
+
+    SUBCASE("existing nodes") {
+        fkyaml::node* p_node = root.find(fkyaml::path("spec.containers[0].image"));
+        REQUIRE(p_node != nullptr);
+        REQUIRE(p_node->as_str() == "nginx");
+
+        const fkyaml::node* p_const_node = const_root.find(fkyaml::path("ref.c~d"));
+        REQUIRE(p_const_node != nullptr);
+        REQUIRE(p_const_node->get_value<int>() == 1);
+    }
+
+    SUBCASE("missing nodes") {
+        REQUIRE(root.find(fkyaml::path("spec.volumes")) == nullptr);
+        REQUIRE(root.find(fkyaml::path("spec.volumes.name")) == nullptr);
+        REQUIRE(const_root.find(fkyaml::path("spec.containers[2]")) == nullptr);
+        REQUIRE(const_root.find(fkyaml::path("spec.containers.web")) == nullptr);
+        REQUIRE(const_root.find(fkyaml::path("spec.containers[0].image.tag")) == nullptr);
+        REQUIRE(const_root.find(fkyaml::path("spec.containers[99999999999]")) == nullptr);
+    }
+
+    SUBCASE("ordered_map") {
+        using ordered_node = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+        const ordered_node node = ordered_node::deserialize(path_test_input);
+        const ordered_node* p_node = node.find(fkyaml::path("spec.responses[200]"));
+        REQUIRE(p_node != nullptr);
+        REQUIRE(p_node->as_str() == "ok");
+    }
+}
+
+TEST_CASE("PathBatch_Find") {
+    const fkyaml::node root = fkyaml::node::deserialize(path_test_input);
+
+    SUBCASE("empty batch") {
+        fkyaml::path_batch batch;
+        REQUIRE(batch.empty());
+
+        std::vector<const fkyaml::node*> results {&root};
+        root.find(batch, results);
+        REQUIRE(results.empty());
+    }
+
+    SUBCASE("paths with common prefixes") {
+        fkyaml::path_batch batch {
+            fkyaml::path("spec.containers[0].image"),
+            fkyaml::path("spec.containers[1].image"),
+            fkyaml::path("spec.containers[2].image"),
+            fkyaml::path("spec.responses[200]"),
+            fkyaml::path(""),
+        };
+        REQUIRE(batch.add(fkyaml::path("/spec/containers/0/image")) == 5);
+        REQUIRE(batch.add(fkyaml::path("spec.containers[0].image.tag")) == 6);
+        REQUIRE(batch.add(fkyaml::path("/ref/x.y")) == 7);
+        REQUIRE(batch.size() == 8);
+
+        std::vector<const fkyaml::node*> results;
+        root.find(batch, results);
+        REQUIRE(results.size() == 8);
+        REQUIRE(results[0] == &root.at(fkyaml::path("spec.containers[0].image")));
+        REQUIRE(results[1]->as_str() == "envoy");
+        REQUIRE(results[2] == nullptr);
+        REQUIRE(results[3]->as_str() == "ok");
+        REQUIRE(results[4] == &root);
+        REQUIRE(results[5] == results[0]);
+        REQUIRE(results[6] == nullptr);
+        REQUIRE(results[7]->get_value<int>() == 2);
+
+        // The results are replaced on each call.
+        const fkyaml::node other = fkyaml::node::deserialize(std::string("spec: {containers: [{image: httpd}]}"));
+        other.find(batch, results);
+        REQUIRE(results.size() == 8);
+        REQUIRE(results[0]->as_str() == "httpd");
+        REQUIRE(results[1] == nullptr);
+        REQUIRE(results[4] == &other);
+    }
+
+    SUBCASE("index and key segments") {
+        fkyaml::path_batch batch {
+            fkyaml::path("spec.responses[200]"),
+            fkyaml::path("spec.responses.200"),
+            fkyaml::path("spec.containers[1].name"),
+            fkyaml::path("spec.containers.1.name"),
+        };
+
+        std::vector<const fkyaml::node*> results;
+        root.find(batch, results);
+        REQUIRE(results.size() == 4);
+        REQUIRE(results[0]->as_str() == "ok");
+        REQUIRE(results[1] == nullptr);
+        REQUIRE(results[2]->as_str() == "sidecar");
+        REQUIRE(results[3] == results[2]);
+    }
+}
@@ -98,3 +98,34 @@ TEST_CASE("PositionTracker_MultipleLines") {
         REQUIRE(pos_tracker.get_lines_read() == 2);
     }
 }
+
+TEST_CASE("PositionTracker_MoveBackward") {
+    fkyaml::detail::str_view input = "foo\nbar\n\nbaz";
+    fkyaml::detail::position_tracker pos_tracker {};
+    pos_tracker.set_target_buffer(input);
+
+    pos_tracker.update_position(input.begin() + 11);
+    REQUIRE(pos_tracker.get_cur_pos() == 11);
+    REQUIRE(pos_tracker.get_cur_pos_in_line() == 2);
+    REQUIRE(pos_tracker.get_lines_read() == 3);
+
+    pos_tracker.update_position(input.begin() + 10);
+    REQUIRE(pos_tracker.get_cur_pos() == 10);
+    REQUIRE(pos_tracker.get_cur_pos_in_line() == 1);
+    REQUIRE(pos_tracker.get_lines_read() == 3);
+
+    pos_tracker.update_position(input.begin() + 5);
+    REQUIRE(pos_tracker.get_cur_pos() == 5);
+    REQUIRE(pos_tracker.get_cur_pos_in_line() == 1);
+    REQUIRE(pos_tracker.get_lines_read() == 1);
+
+    pos_tracker.update_position(input.begin() + 2);
+    REQUIRE(pos_tracker.get_cur_pos() == 2);
+    REQUIRE(pos_tracker.get_cur_pos_in_line() == 2);
+    REQUIRE(pos_tracker.get_lines_read() == 0);
+
+    pos_tracker.update_position(input.begin() + 8);
+    REQUIRE(pos_tracker.get_cur_pos() == 8);
+    REQUIRE(pos_tracker.get_cur_pos_in_line() == 0);
+    REQUIRE(pos_tracker.get_lines_read() == 2);
+}
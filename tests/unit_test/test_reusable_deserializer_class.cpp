@@ -0,0 +1,144 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+const std::vector<std::string>& test_inputs() {
+    static const std::vector<std::string> inputs {
+        "foo: bar\nbaz: [1, 2.5, true, null]\n",
+        "- &anchor !!str 123\n- *anchor\n- {a: b, c: d}\n",
+        "%YAML 1.1\n---\nkey: |\n  literal\n  text\n",
+        "plain scalar\n  which spans lines\n",
+        "\"double \\\"quoted\\\"\\n\": 'single ''quoted'''\n",
+        "? explicit key\n: explicit value\n",
+        "%TAG !e! tag:example.com,2000:\n--- !e!foo\nfolded: >\n  a\n  b\n",
+        "",
+        "foo: bar\r\nbaz: qux\r\n",
+    };
+    return inputs;
+}
+
+} // namespace
+
+TEST_CASE("ReusableDeserializer_Deserialize") {
+    fkyaml::node::deserializer deserializer;
+
+    // deserialize the inputs twice so that every input is deserialized after all the others.
+    for (int i = 0; i < 2; i++) {
+        for (const std::string& input : test_inputs()) {
+            REQUIRE(deserializer.deserialize(input) == fkyaml::node::deserialize(input));
+        }
+    }
+}
+
+TEST_CASE("ReusableDeserializer_DeserializeIterators") {
+    fkyaml::node::deserializer deserializer;
+
+    for (const std::string& input : test_inputs()) {
+        REQUIRE(deserializer.deserialize(input.begin(), input.end()) == fkyaml::node::deserialize(input));
+        REQUIRE(deserializer.deserialize_docs(input.begin(), input.end()) == fkyaml::node::deserialize_docs(input));
+    }
+}
+
+TEST_CASE("ReusableDeserializer_DeserializeDocs") {
+    fkyaml::node::deserializer deserializer;
+
+    std::string input = "foo: bar\n...\n%YAML 1.1\n---\n- 1\n- 2\n---\n&a x: *a\n";
+    std::vector<fkyaml::node> docs = deserializer.deserialize_docs(input);
+    REQUIRE(docs.size() == 3);
+    REQUIRE(docs == fkyaml::node::deserialize_docs(input));
+
+    fkyaml::node node = deserializer.deserialize("baz: qux");
+    REQUIRE(node.is_mapping());
+    REQUIRE(node["baz"].get_value<std::string>() == "qux");
+}
+
+TEST_CASE("ReusableDeserializer_NormalizedInputs") {
+    fkyaml::node::deserializer deserializer;
+
+    // inputs with CRs or other encodings are normalized into a buffer kept by the deserializer.
+    std::string long_input;
+    for (int i = 0; i < 100; i++) {
+        long_input += "key" + std::to_string(i) + ": value\r\n";
+    }
+    REQUIRE(deserializer.deserialize(long_input).size() == 100);
+
+    std::u16string utf16_input = u"foo: bar\r\n";
+    fkyaml::node node = deserializer.deserialize(utf16_input);
+    REQUIRE(node.size() == 1);
+    REQUIRE(node["foo"].get_value<std::string>() == "bar");
+
+    std::u32string utf32_input = U"- 1\n- 2\n";
+    node = deserializer.deserialize(utf32_input);
+    REQUIRE(node.size() == 2);
+
+    node = deserializer.deserialize(std::string("a: b\r\n"));
+    REQUIRE(node.size() == 1);
+    REQUIRE(node["a"].get_value<std::string>() == "b");
+}
+
+TEST_CASE("ReusableDeserializer_AfterParseError") {
+    fkyaml::node::deserializer deserializer;
+
+    auto invalid_input = GENERATE(
+        std::string("foo: [bar, {baz"),
+        std::string("- &anchor !!int foo"),
+        std::string("key: \"unterminated"),
+        std::string("%YAML 1.2\n%YAML 1.2\n---\nfoo"));
+
+    REQUIRE_THROWS_AS(deserializer.deserialize(invalid_input), fkyaml::exception);
+
+    // nothing from the failed deserialization must leak into the next one.
+    for (const std::string& input : test_inputs()) {
+        REQUIRE(deserializer.deserialize(input) == fkyaml::node::deserialize(input));
+    }
+}
+
+TEST_CASE("ReusableDeserializer_Reset") {
+    fkyaml::node::deserializer deserializer;
+
+    REQUIRE(deserializer.deserialize("foo: bar\r\n")["foo"].get_value<std::string>() == "bar");
+    deserializer.reset();
+    REQUIRE(deserializer.deserialize("foo: baz\r\n")["foo"].get_value<std::string>() == "baz");
+    deserializer.reset();
+    deserializer.reset();
+    REQUIRE(deserializer.deserialize_docs("a\n---\nb\n").size() == 2);
+}
+
+TEST_CASE("ReusableDeserializer_Move") {
+    fkyaml::node::deserializer deserializer;
+    REQUIRE(deserializer.deserialize("foo: bar").size() == 1);
+
+    fkyaml::node::deserializer moved(std::move(deserializer));
+    REQUIRE(moved.deserialize("- 1\n- 2\n- 3").size() == 3);
+
+    deserializer = std::move(moved);
+    REQUIRE(deserializer.deserialize("{a: b}").size() == 1);
+}
+
+TEST_CASE("ReusableDeserializer_SetLimits") {
+    fkyaml::node::deserializer deserializer;
+    REQUIRE(deserializer.deserialize("[[[1]]]").size() == 1);
+
+    fkyaml::deserialization_limits limits;
+    limits.max_depth = 2;
+    deserializer.set_limits(limits);
+    REQUIRE_THROWS_AS(deserializer.deserialize("[[[1]]]"), fkyaml::limit_exceeded);
+    REQUIRE(deserializer.deserialize("[[1]]").size() == 1);
+
+    // the limits are kept after reset().
+    deserializer.reset();
+    REQUIRE_THROWS_AS(deserializer.deserialize_docs("a\n---\n[[[1]]]"), fkyaml::limit_exceeded);
+}
@@ -7,6 +7,11 @@
 // SPDX-License-Identifier: MIT
 
 #include <cfloat>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
 #include <string>
 #include <utility>
 
@@ -462,4 +467,126 @@ TEST_CASE("ScalarConv_atof_double") {
         input = "1.7976931348623157E+309";
         REQUIRE(fkyaml::detail::atof(input.begin(), input.end(), fp) == false);
     }
+
+    SUBCASE("correctly rounded values") {
+        using pair_t = std::pair<std::string, double>;
+        auto pair = GENERATE(
+            pair_t("0.1", 0.1),
+            pair_t("-0.0", -0.0),
+            pair_t("1e23", 1e23),
+            pair_t(".5", 0.5),
+            pair_t("5.", 5.0),
+            pair_t("1E-2", 0.01),
+            pair_t("1.7976931348623157e308", limits_type::max()),
+            pair_t("2.2250738585072014e-308", limits_type::min()),
+            pair_t("2.2250738585072011e-308", 2.2250738585072011e-308),
+            pair_t("4.9406564584124654e-324", limits_type::denorm_min()),
+            pair_t("9007199254740993", 9007199254740992.0),
+            pair_t("9007199254740993.0000000000000000000001", 9007199254740994.0),
+            pair_t("0.30000000000000004", 0.1 + 0.2),
+            pair_t("123456789012345678901234567890", 123456789012345678901234567890.0));
+        REQUIRE(fkyaml::detail::atof(pair.first.begin(), pair.first.end(), fp) == true);
+        REQUIRE(std::memcmp(&fp, &pair.second, sizeof(fp)) == 0);
+    }
+
+    SUBCASE("invalid values") {
+        auto input = GENERATE(
+            std::string("-"),
+            std::string("."),
+            std::string("e5"),
+            std::string("1e"),
+            std::string("1e+"),
+            std::string("1.2.3"),
+            std::string("1x"),
+            std::string("--1"),
+            std::string("0x10"),
+            std::string("1e-400"));
+        REQUIRE(fkyaml::detail::atof(input.begin(), input.end(), fp) == false);
+    }
+}
+
+TEST_CASE("ScalarConv_float_to_chars") {
+    // one more character for the terminating null character required by std::strtod() and std::strtof().
+    char buf[fkyaml::detail::float_to_chars_buffer_size + 1];
+
+    SUBCASE("double values") {
+        using pair_t = std::pair<double, std::string>;
+        auto pair = GENERATE(
+            pair_t(0.0, "0"),
+            pair_t(-0.0, "-0"),
+            pair_t(1.0, "1"),
+            pair_t(-2.5, "-2.5"),
+            pair_t(0.1, "0.1"),
+            pair_t(0.001, "0.001"),
+            pair_t(1e-05, "1e-05"),
+            pair_t(100.0, "100"),
+            pair_t(123456789.0, "123456789"),
+            pair_t(23000000.0, "2.3e+07"),
+            pair_t(1e22, "1e+22"),
+            pair_t(3.141592653589793, "3.141592653589793"),
+            pair_t(5e-324, "5e-324"),
+            pair_t(std::numeric_limits<double>::min(), "2.2250738585072014e-308"),
+            pair_t(std::numeric_limits<double>::max(), "1.7976931348623157e+308"));
+
+        char* p_end = fkyaml::detail::float_to_chars(&buf[0], pair.first);
+        REQUIRE(std::string(&buf[0], p_end) == pair.second);
+    }
+
+    SUBCASE("float values") {
+        using pair_t = std::pair<float, std::string>;
+        auto pair = GENERATE(
+            pair_t(0.0f, "0"),
+            pair_t(3.14f, "3.14"),
+            pair_t(0.1f, "0.1"),
+            pair_t(16777216.0f, "16777216"),
+            pair_t(1e-45f, "1e-45"),
+            pair_t(std::numeric_limits<float>::max(), "3.4028235e+38"));
+
+        char* p_end = fkyaml::detail::float_to_chars(&buf[0], pair.first);
+        REQUIRE(std::string(&buf[0], p_end) == pair.second);
+    }
+
+    SUBCASE("round trip of random double values") {
+        std::mt19937_64 engine(0x5EED);
+        for (int i = 0; i < 100000; i++) {
+            const uint64_t bits = engine();
+            double value = 0.0;
+            std::memcpy(&value, &bits, sizeof(value));
+            if (!std::isfinite(value)) {
+                continue;
+            }
+
+            char* p_end = fkyaml::detail::float_to_chars(&buf[0], value);
+            *p_end = '\0';
+            const double expected = std::strtod(&buf[0], nullptr);
+            REQUIRE(std::memcmp(&expected, &value, sizeof(value)) == 0);
+
+            double parsed = 0.0;
+            const char* p_begin = &buf[0];
+            REQUIRE(fkyaml::detail::atof(p_begin, static_cast<const char*>(p_end), parsed) == true);
+            REQUIRE(std::memcmp(&parsed, &expected, sizeof(value)) == 0);
+        }
+    }
+
+    SUBCASE("round trip of random float values") {
+        std::mt19937 engine(0x5EED);
+        for (int i = 0; i < 100000; i++) {
+            const uint32_t bits = engine();
+            float value = 0.0f;
+            std::memcpy(&value, &bits, sizeof(value));
+            if (!std::isfinite(value)) {
+                continue;
+            }
+
+            char* p_end = fkyaml::detail::float_to_chars(&buf[0], value);
+            *p_end = '\0';
+            const float expected = std::strtof(&buf[0], nullptr);
+            REQUIRE(std::memcmp(&expected, &value, sizeof(value)) == 0);
+
+            float parsed = 0.0f;
+            const char* p_begin = &buf[0];
+            REQUIRE(fkyaml::detail::atof(p_begin, static_cast<const char*>(p_end), parsed) == true);
+            REQUIRE(std::memcmp(&parsed, &expected, sizeof(value)) == 0);
+        }
+    }
 }
@@ -102,6 +102,10 @@ TEST_CASE("SerializeClassTest_FloatNode") {
         node_str_pair_t(-53.97, "-53.97"),
         node_str_pair_t(23000000.0, "2.3e+07"),
         node_str_pair_t(-23000000.0, "-2.3e+07"),
+        node_str_pair_t(3.141592653589793, "3.141592653589793"),
+        node_str_pair_t(123456789.0, "123456789.0"),
+        node_str_pair_t(0.1 + 0.2, "0.30000000000000004"),
+        node_str_pair_t(1e-05, "1e-05"),
         node_str_pair_t(std::numeric_limits<fkyaml::node::float_number_type>::infinity(), ".inf"),
         node_str_pair_t(-1 * std::numeric_limits<fkyaml::node::float_number_type>::infinity(), "-.inf"),
         node_str_pair_t(std::nan(""), ".nan"));
@@ -186,6 +190,39 @@ TEST_CASE("Serializer_StringNode") {
     REQUIRE(serializer.serialize(node_str_pair.first) == node_str_pair.second);
 }
 
+TEST_CASE("Serializer_LongStringNode") {
+    // long enough to be scanned in multiple blocks, with a special character at every possible position.
+    using str_pair_t = std::pair<std::string, std::string>;
+    auto special = GENERATE(
+        str_pair_t(" ", " "),
+        str_pair_t(",", ","),
+        str_pair_t("[", "["),
+        str_pair_t("}", "}"),
+        str_pair_t("\"", "\\\""),
+        str_pair_t("\\", "\\\\"),
+        str_pair_t("\n", "\\n"),
+        str_pair_t("\x1B", "\\e"),
+        str_pair_t(std::string({char(0xC2u), char(0xA0u)}), "\\_"),
+        str_pair_t(std::string({char(0xE2u), char(0x80u), char(0xA9u)}), "\\P"),
+        str_pair_t(std::string({char(0xC3u), char(0xA9u)}), std::string({char(0xC3u), char(0xA9u)})),
+        str_pair_t("|", "|"));
+    const bool is_plain = special.first == "|" || special.first[0] == char(0xC3u);
+
+    fkyaml::detail::basic_serializer<fkyaml::node> serializer;
+    for (std::size_t pos = 1; pos < 70; pos++) {
+        std::string value(70, 'a');
+        value.replace(pos, 1, special.first);
+
+        std::string expected(70, 'a');
+        expected.replace(pos, 1, special.second);
+        if (!is_plain) {
+            expected = "\"" + expected + "\"";
+        }
+
+        REQUIRE(serializer.serialize(fkyaml::node(value)) == expected);
+    }
+}
+
 TEST_CASE("Serializer_StringNodeStartingWithDirectiveIndicatorInMapping") {
     const std::string yaml = "project: fkYAML\n"
                              "percent: %\n"
@@ -392,3 +429,45 @@ TEST_CASE("Serializer_MultipleDocuments") {
         REQUIRE(serializer.serialize_docs(docs) == expected);
     }
 }
+
+TEST_CASE("Serializer_RoundTripThroughSmallBuffers") {
+    // canonical outputs, which must be reproduced regardless of where chunks are split.
+    auto expected = GENERATE(
+        std::string("%YAML 1.2\n"
+                    "--- &anchor !!map\n"
+                    "foo: bar\n"),
+        std::string("? - 3.14\n"
+                    "  - null\n"
+                    ": foo\n"
+                    "? ? - a\n"
+                    "    - b\n"
+                    "  :\n"
+                    "    - c\n"
+                    "    - d\n"
+                    ": e\n"
+                    "? true: 123\n"
+                    ": 3.14\n"),
+        std::string("long:\n"
+                    "  -\n"
+                    "    - &item " +
+                    std::string(100, 'x') +
+                    "\n"
+                    "    - *item\n"
+                    "  -\n"
+                    "    key: \"multi\\nline\"\n"
+                    "    other: []\n"));
+
+    fkyaml::node root = fkyaml::node::deserialize(expected);
+    fkyaml::detail::basic_serializer<fkyaml::node> serializer;
+    REQUIRE(serializer.serialize(root) == expected);
+
+    auto buffer_size = GENERATE(std::size_t(1), std::size_t(2), std::size_t(3), std::size_t(7), std::size_t(64));
+    std::vector<char> buffer(buffer_size);
+    std::string actual;
+    auto flush = [&actual](const char* p_chars, std::size_t size) { actual.append(p_chars, size); };
+    fkyaml::detail::callback_output_adapter<decltype(flush)> adapter(flush);
+    serializer.serialize(root, adapter, buffer.data(), buffer.size());
+
+    REQUIRE(actual == expected);
+    REQUIRE(fkyaml::node::deserialize(actual) == root);
+}
@@ -0,0 +1,80 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.4.4
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2026 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <string>
+
+#include <doctest/doctest.h>
+
+#include <fkYAML/node.hpp>
+
+static std::size_t validate_and_count_crs(const std::string& input) {
+    return fkyaml::detail::utf8::validate_and_count_crs(input.data(), input.data() + input.size());
+}
+
+TEST_CASE("UTF8Validator_SkipASCII") {
+    // cover the 32-byte, 16-byte, 8-byte and byte-by-byte steps.
+    auto size = GENERATE(0, 1, 7, 8, 15, 16, 31, 32, 33, 63, 64, 100);
+    CAPTURE(size);
+
+    std::string input(static_cast<std::size_t>(size), 'a');
+    std::size_t num_crs = 0;
+    const char* p_end = input.data() + input.size();
+    REQUIRE(fkyaml::detail::utf8::skip_ascii(input.data(), p_end, num_crs) == p_end);
+    REQUIRE(num_crs == 0);
+
+    input += "\xE3\x81\x82";
+    p_end = input.data() + input.size();
+    REQUIRE(fkyaml::detail::utf8::skip_ascii(input.data(), p_end, num_crs) == input.data() + size);
+    REQUIRE(num_crs == 0);
+}
+
+TEST_CASE("UTF8Validator_ValidateAndCountCRs") {
+    SUBCASE("ASCII characters only") {
+        REQUIRE(validate_and_count_crs("") == 0);
+        REQUIRE(validate_and_count_crs("foo: bar\n") == 0);
+        REQUIRE(validate_and_count_crs("foo: bar\r\n") == 1);
+        REQUIRE(validate_and_count_crs(std::string(100, '\r')) == 100);
+    }
+
+    SUBCASE("CRs at every position in long inputs") {
+        auto pos = GENERATE(0, 7, 8, 15, 16, 31, 32, 47, 63, 64, 99);
+        CAPTURE(pos);
+
+        std::string input(100, 'a');
+        input[static_cast<std::size_t>(pos)] = '\r';
+        input[99] = '\r';
+        REQUIRE(validate_and_count_crs(input) == (pos == 99 ? 1 : 2));
+    }
+
+    SUBCASE("mixed with multi-byte characters") {
+        std::string input;
+        for (int i = 0; i < 20; i++) {
+            input += "key\r\n\xC2\x80\xE3\x81\x82\xF0\x9F\x98\x80 value with some ASCII characters\r\n";
+        }
+        REQUIRE(validate_and_count_crs(input) == 40);
+    }
+
+    SUBCASE("invalid characters at every position in long inputs") {
+        auto pos = GENERATE(0, 7, 8, 15, 16, 31, 32, 47, 63, 64, 98);
+        auto invalid = GENERATE(
+            std::string("\x80"), std::string("\xF8"), std::string("\xC0\xAF"), std::string("\xE3\x81"),
+            std::string("\xED\xA0\x80"), std::string("\xF0\x8F\xBF\xBF"));
+        CAPTURE(pos);
+
+        std::string input(100, 'a');
+        input.replace(static_cast<std::size_t>(pos), invalid.size(), invalid);
+        REQUIRE_THROWS_AS(validate_and_count_crs(input), fkyaml::invalid_encoding);
+    }
+
+    SUBCASE("truncated multi-byte characters at the end") {
+        auto truncated = GENERATE(std::string("\xC2"), std::string("\xE3\x81"), std::string("\xF0\x9F\x98"));
+        std::string input = std::string(40, 'a') + truncated;
+        REQUIRE_THROWS_AS(validate_and_count_crs(input), fkyaml::invalid_encoding);
+    }
+}
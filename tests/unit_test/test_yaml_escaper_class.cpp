@@ -120,3 +120,19 @@ TEST_CASE("YamlEscaper_Escape") {
     REQUIRE(fkyaml::detail::yaml_escaper::escape(input.begin(), input.end(), is_escaped) == test_data.second);
     REQUIRE(is_escaped);
 }
+
+TEST_CASE("YamlEscaper_EscapeToOutput") {
+    SUBCASE("no escape") {
+        std::string out = "prefix:";
+        fkyaml::detail::str_view input = "foo bar";
+        REQUIRE_FALSE(fkyaml::detail::yaml_escaper::escape(input.begin(), input.end(), out));
+        REQUIRE(out == "prefix:foo bar");
+    }
+
+    SUBCASE("escapes") {
+        std::string out = "prefix:";
+        fkyaml::detail::str_view input = "foo\t\"bar\"\n";
+        REQUIRE(fkyaml::detail::yaml_escaper::escape(input.begin(), input.end(), out));
+        REQUIRE(out == "prefix:foo\\t\\\"bar\\\"\\n");
+    }
+}
@@ -11,9 +11,14 @@
 #define _CRT_SECURE_NO_WARNINGS
 #endif
 
+#include <atomic>
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <new>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -29,6 +34,61 @@
 #include <c4/yml/parse.hpp>
 
 static std::string test_src {};
+static const char* test_src_filename = nullptr;
+
+// The numbers of heap allocations and allocated bytes made through the global operator new.
+// Used to report allocation costs per iteration along with timings.
+// Atomic since operator new is also called from worker threads (see bm_fkyaml_parse_docs_parallel).
+static std::atomic<std::size_t> alloc_count {0};
+static std::atomic<std::size_t> alloc_bytes {0};
+
+// A snapshot of the allocation counters.
+struct alloc_stats {
+    std::size_t count;
+    std::size_t bytes;
+};
+
+// Takes a snapshot of the allocation counters.
+alloc_stats load_alloc_totals() {
+    return {alloc_count.load(std::memory_order_relaxed), alloc_bytes.load(std::memory_order_relaxed)};
+}
+
+void* operator new(std::size_t size) {
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*unused*/) noexcept {
+    std::free(p);
+}
+
+// Sets the average numbers of heap allocations and allocated bytes per iteration since `before` to the benchmark
+// counters.
+void set_alloc_counters(benchmark::State& st, const alloc_stats& before) {
+    const alloc_stats after = load_alloc_totals();
+    st.counters["allocs_per_iter"] =
+        benchmark::Counter(static_cast<double>(after.count - before.count), benchmark::Counter::kAvgIterations);
+    st.counters["alloc_bytes_per_iter"] =
+        benchmark::Counter(static_cast<double>(after.bytes - before.bytes), benchmark::Counter::kAvgIterations);
+}
+
+// Skips a benchmark which needs an input file if none has been given.
+bool skip_without_test_source(benchmark::State& st) {
+    if (test_src_filename == nullptr) {
+        st.SkipWithError("No input file is given.");
+        return true;
+    }
+    return false;
+}
 
 void prepare_test_source(char* filename) {
     FILE* fp = std::fopen(filename, "rb");
@@ -43,9 +103,21 @@ void prepare_test_source(char* filename) {
 }
 
 int main(int argc, char** argv) {
-    prepare_test_source(argv[1]);
-
     benchmark::Initialize(&argc, argv);
+
+    // The input file is optional since most of the benchmarks generate synthetic inputs by themselves.
+    if (argc > 1) {
+        test_src_filename = argv[1];
+        prepare_test_source(argv[1]);
+    }
+
+    // recorded in the "context" object of the JSON output (--benchmark_out_format=json) to compare results later.
+    benchmark::AddCustomContext(
+        "fkyaml_version",
+        std::to_string(FK_YAML_MAJOR_VERSION) + "." + std::to_string(FK_YAML_MINOR_VERSION) + "." +
+            std::to_string(FK_YAML_PATCH_VERSION));
+    benchmark::AddCustomContext("input_file", test_src_filename ? test_src_filename : "");
+
     benchmark::RunSpecifiedBenchmarks();
     benchmark::Shutdown();
 
@@ -58,19 +130,203 @@ int main(int argc, char** argv) {
 
 // fkYAML
 void bm_fkyaml_parse(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
     for (auto _ : st) {
         fkyaml::node n = fkyaml::node::deserialize(test_src);
     }
+    set_alloc_counters(st, allocs_before);
+    // track the per-node footprint along with timings.
+    st.counters["sizeof_node"] = static_cast<double>(sizeof(fkyaml::node));
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * test_src.size());
+}
+
+// fkYAML (from a FILE pointer)
+void bm_fkyaml_parse_file_pointer(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        FILE* fp = std::fopen(test_src_filename, "rb");
+        fkyaml::node n = fkyaml::node::deserialize(fp);
+        std::fclose(fp);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * test_src.size());
+}
+
+// fkYAML (from a memory-mapped file)
+void bm_fkyaml_parse_mapped_file(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize(fkyaml::mapped_file(test_src_filename));
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * test_src.size());
+}
+
+// fkYAML (node values allocated from an arena which is released at once)
+void bm_fkyaml_parse_arena(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node_arena arena;
+        fkyaml::arena_scope scope(arena);
+        fkyaml::arena_node n = fkyaml::arena_node::deserialize(test_src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * test_src.size());
+}
+
+// fkYAML (string scalars borrowed from the input buffer)
+void bm_fkyaml_parse_borrowed(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize_borrowed(test_src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * test_src.size());
+}
+
+// fkYAML (parse events only, without creating nodes)
+struct event_counter {
+    bool start_document() {
+        return count();
+    }
+    bool end_document() {
+        return count();
+    }
+    bool start_mapping() {
+        return count();
+    }
+    bool end_mapping() {
+        return count();
+    }
+    bool start_sequence() {
+        return count();
+    }
+    bool end_sequence() {
+        return count();
+    }
+    bool scalar(const char* /*unused*/, std::size_t /*unused*/, fkyaml::scalar_style /*unused*/) {
+        return count();
+    }
+    bool alias(const char* /*unused*/, std::size_t /*unused*/) {
+        return count();
+    }
+    bool anchor(const char* /*unused*/, std::size_t /*unused*/) {
+        return count();
+    }
+    bool tag(const char* /*unused*/, std::size_t /*unused*/) {
+        return count();
+    }
+
+    bool count() {
+        ++num_events;
+        return true;
+    }
+
+    std::size_t num_events {0};
+};
+
+void bm_fkyaml_parse_events(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        event_counter counter;
+        fkyaml::node::parse_events(test_src, counter);
+        benchmark::DoNotOptimize(counter.num_events);
+    }
+    set_alloc_counters(st, allocs_before);
 
     st.SetItemsProcessed(st.iterations());
     st.SetBytesProcessed(st.iterations() * test_src.size());
 }
 
+// fkYAML (serialize into a std::string object)
+void bm_fkyaml_serialize(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const fkyaml::node n = fkyaml::node::deserialize(test_src);
+    std::size_t output_size = 0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        std::string out = fkyaml::node::serialize(n);
+        output_size = out.size();
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * output_size);
+}
+
+// fkYAML (serialize through a fixed-size buffer without building the whole output)
+void bm_fkyaml_serialize_buffer(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const fkyaml::node n = fkyaml::node::deserialize(test_src);
+    char buffer[4096];
+    std::size_t output_size = 0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        output_size = 0;
+        fkyaml::node::serialize(n, &buffer[0], sizeof(buffer), [&output_size](const char* p, std::size_t size) {
+            benchmark::DoNotOptimize(p);
+            output_size += size;
+        });
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * output_size);
+}
+
 // yaml-cpp
 void bm_yamlcpp_parse(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
     for (auto _ : st) {
         YAML::Node n = YAML::Load(test_src);
     }
+    set_alloc_counters(st, allocs_before);
 
     st.SetItemsProcessed(st.iterations());
     st.SetBytesProcessed(st.iterations() * test_src.size());
@@ -79,6 +335,10 @@ void bm_yamlcpp_parse(benchmark::State& st) {
 #ifdef FK_YAML_BM_HAS_LIBFYAML
 // libfyaml
 void bm_libfyaml_parse(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
     const char* p_test_src = test_src.c_str();
     std::size_t test_src_size = std::distance(test_src.begin(), test_src.end());
 
@@ -94,6 +354,10 @@ void bm_libfyaml_parse(benchmark::State& st) {
 
 // rapidyaml (in place)
 void bm_rapidyaml_parse_inplace(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
     std::string in_place_buff(test_src.size(), '\0');
     c4::substr c4_test_src = c4::to_substr(in_place_buff).trimr('\0');
 
@@ -112,6 +376,10 @@ void bm_rapidyaml_parse_inplace(benchmark::State& st) {
 
 // rapidyaml (arena)
 void bm_rapidyaml_parse_arena(benchmark::State& st) {
+    if (skip_without_test_source(st)) {
+        return;
+    }
+
     c4::csubstr src = c4::to_csubstr(test_src).trimr('\0');
 
     for (auto _ : st) {
@@ -122,8 +390,654 @@ void bm_rapidyaml_parse_arena(benchmark::State& st) {
     st.SetBytesProcessed(st.iterations() * test_src.size());
 }
 
+// fkYAML (large mappings)
+using ordered_map_node = fkyaml::basic_node<std::vector, fkyaml::ordered_map>;
+using indexed_ordered_map_node = fkyaml::basic_node<std::vector, fkyaml::indexed_ordered_map>;
+
+// Generates a YAML document which consists of a block mapping with the given number of keys.
+std::string make_large_mapping_source(int64_t num_keys) {
+    std::string src;
+    for (int64_t i = 0; i < num_keys; i++) {
+        src += "key" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+    }
+    return src;
+}
+
+template <typename NodeType>
+void bm_fkyaml_parse_large_mapping(benchmark::State& st) {
+    const std::string src = make_large_mapping_source(st.range(0));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        NodeType n = NodeType::deserialize(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+template <typename NodeType>
+void bm_fkyaml_lookup_large_mapping(benchmark::State& st) {
+    const NodeType root = NodeType::deserialize(make_large_mapping_source(st.range(0)));
+    std::vector<NodeType> keys;
+    for (int64_t i = 0; i < st.range(0); i++) {
+        keys.emplace_back("key" + std::to_string(i));
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const NodeType& key : keys) {
+            benchmark::DoNotOptimize(root.contains(key));
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// Looks up the values with std::string keys, which are compared with the mapping keys without temporary nodes.
+template <typename NodeType>
+void bm_fkyaml_lookup_string_keys(benchmark::State& st) {
+    const NodeType root = NodeType::deserialize(make_large_mapping_source(st.range(0)));
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < st.range(0); i++) {
+        keys.push_back("key" + std::to_string(i));
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const std::string& key : keys) {
+            benchmark::DoNotOptimize(root.contains(key));
+            benchmark::DoNotOptimize(&root.at(key));
+            benchmark::DoNotOptimize(&root[key]);
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0) * 3);
+}
+
+template <typename NodeType>
+void bm_fkyaml_serialize_large_mapping(benchmark::State& st) {
+    const NodeType root = NodeType::deserialize(make_large_mapping_source(st.range(0)));
+    std::size_t output_size = 0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        std::string out = NodeType::serialize(root);
+        output_size = out.size();
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * output_size);
+}
+
+std::vector<double> make_float_values(std::size_t num) {
+    std::vector<double> values;
+    values.reserve(num);
+    double v = 0.1;
+    for (std::size_t i = 0; i < num; i++) {
+        values.push_back(v);
+        v = v * 1.7 + 0.013;
+        if (v > 1e12) {
+            v /= 1e15;
+        }
+    }
+    return values;
+}
+
+// floating point number formatting with std::ostringstream (the former implementation of to_string())
+void bm_format_float_ostringstream(benchmark::State& st) {
+    const std::vector<double> values = make_float_values(1000);
+    std::string s;
+
+    for (auto _ : st) {
+        for (double v : values) {
+            std::ostringstream oss;
+            oss << v;
+            s = oss.str();
+            benchmark::DoNotOptimize(s.data());
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * values.size());
+}
+
+// floating point number formatting with the shortest round-trip representation
+void bm_format_float_to_string(benchmark::State& st) {
+    const std::vector<double> values = make_float_values(1000);
+    std::string s;
+
+    for (auto _ : st) {
+        for (double v : values) {
+            fkyaml::detail::to_string(v, s);
+            benchmark::DoNotOptimize(s.data());
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * values.size());
+}
+
+std::vector<std::string> make_float_scalars(std::size_t num) {
+    std::vector<std::string> scalars;
+    scalars.reserve(num);
+    std::string s;
+    for (double v : make_float_values(num)) {
+        fkyaml::detail::to_string(v, s);
+        scalars.push_back(s);
+    }
+    return scalars;
+}
+
+// floating point number parsing from scalars
+void bm_fkyaml_atof(benchmark::State& st) {
+    const std::vector<std::string> scalars = make_float_scalars(1000);
+    double v = 0.0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const std::string& s : scalars) {
+            benchmark::DoNotOptimize(fkyaml::detail::atof(s.begin(), s.end(), v));
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * scalars.size());
+}
+
+// fkYAML (a document which consists of floating point numbers only)
+void bm_fkyaml_parse_floats(benchmark::State& st) {
+    std::string src;
+    for (const std::string& s : make_float_scalars(static_cast<std::size_t>(st.range(0)))) {
+        src += "- " + s + "\n";
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// fkYAML (a block mapping whose values are long plain scalars of prose)
+void bm_fkyaml_parse_long_plain_scalars(benchmark::State& st) {
+    const auto length = static_cast<std::size_t>(st.range(0));
+    std::string prose;
+    while (prose.size() < length) {
+        prose += "lorem ipsum dolor sit amet, consectetur adipiscing elit ";
+    }
+    prose.resize(length);
+    if (prose.back() == ' ') {
+        prose.back() = 'x';
+    }
+
+    std::string src;
+    for (int i = 0; i < 1000; i++) {
+        src += "key" + std::to_string(i) + ": " + prose + "\n";
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * 1000);
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// Generates a multi-document YAML stream which consists of the given number of independent documents.
+std::string make_multi_document_source(int64_t num_docs) {
+    std::string src;
+    for (int64_t i = 0; i < num_docs; i++) {
+        const std::string id = std::to_string(i);
+        src += "---\nid: " + id + "\nname: item" + id + "\nprice: " + id + ".5\ntags: [foo, bar, baz]\n";
+        src += "attributes:\n  color: red\n  size: 42\n  available: true\n";
+        src += "description: a plain scalar which spans\n  multiple lines in the document " + id + "\n";
+    }
+    return src;
+}
+
+// fkYAML (multiple documents deserialized one after another)
+void bm_fkyaml_parse_docs(benchmark::State& st) {
+    const std::string src = make_multi_document_source(10000);
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * 10000);
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// fkYAML (multiple documents deserialized concurrently with the given number of threads)
+void bm_fkyaml_parse_docs_parallel(benchmark::State& st) {
+    const std::string src = make_multi_document_source(10000);
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        std::vector<fkyaml::node> docs =
+            fkyaml::node::deserialize_docs_parallel(src, static_cast<std::size_t>(st.range(0)));
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * 10000);
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// Generates small YAML payloads such as messages exchanged in RPCs.
+std::vector<std::string> make_small_payloads(std::size_t num) {
+    std::vector<std::string> payloads;
+    payloads.reserve(num);
+    for (std::size_t i = 0; i < num; i++) {
+        const std::string id = std::to_string(i);
+        payloads.push_back(
+            "id: " + id + "\nmethod: update\nparams:\n  key: item" + id + "\n  value: " + id +
+            ".25\n  tags: [foo, bar]\n  enabled: true\n");
+    }
+    return payloads;
+}
+
+// fkYAML (many small documents, each deserialized with a new deserializer)
+void bm_fkyaml_parse_small_docs(benchmark::State& st) {
+    const std::vector<std::string> payloads = make_small_payloads(1000);
+    std::size_t total_size = 0;
+    for (const std::string& payload : payloads) {
+        total_size += payload.size();
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const std::string& payload : payloads) {
+            fkyaml::node n = fkyaml::node::deserialize(payload);
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * payloads.size());
+    st.SetBytesProcessed(st.iterations() * total_size);
+}
+
+// fkYAML (many small documents deserialized with a deserializer which keeps its internal buffers)
+void bm_fkyaml_parse_small_docs_reused(benchmark::State& st) {
+    const std::vector<std::string> payloads = make_small_payloads(1000);
+    std::size_t total_size = 0;
+    for (const std::string& payload : payloads) {
+        total_size += payload.size();
+    }
+
+    fkyaml::node::deserializer deserializer;
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const std::string& payload : payloads) {
+            fkyaml::node n = deserializer.deserialize(payload);
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * payloads.size());
+    st.SetBytesProcessed(st.iterations() * total_size);
+}
+
+// Generates a YAML document which consists of a block sequence of records, each of which is a block mapping with
+// scalars of various types, a nested mapping and a flow sequence.
+std::string make_records_source(int64_t num_records) {
+    std::string src;
+    for (int64_t i = 0; i < num_records; i++) {
+        const std::string id = std::to_string(i);
+        src += "- id: " + id + "\n  name: \"record " + id + "\"\n  price: " + id + ".75\n  active: true\n";
+        src += "  owner:\n    name: user" + id + "\n    email: user" + id + "@example.com\n";
+        src += "  tags: [alpha, beta, gamma]\n";
+    }
+    return src;
+}
+
+// Counts scalars in a node tree by iterating over all the collections.
+std::size_t count_scalars(const fkyaml::node& node) {
+    if (!node.is_sequence() && !node.is_mapping()) {
+        return 1;
+    }
+
+    std::size_t count = 0;
+    for (const fkyaml::node& child : node) {
+        count += count_scalars(child);
+    }
+    return count;
+}
+
+// fkYAML (a sequence of records)
+void bm_fkyaml_parse_records(benchmark::State& st) {
+    const std::string src = make_records_source(st.range(0));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// fkYAML (serialize a sequence of records)
+void bm_fkyaml_serialize_records(benchmark::State& st) {
+    const fkyaml::node root = fkyaml::node::deserialize(make_records_source(st.range(0)));
+    std::size_t output_size = 0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        std::string out = fkyaml::node::serialize(root);
+        output_size = out.size();
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * output_size);
+}
+
+// fkYAML (iterate over all the nodes in a sequence of records)
+void bm_fkyaml_iterate_records(benchmark::State& st) {
+    const fkyaml::node root = fkyaml::node::deserialize(make_records_source(st.range(0)));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        benchmark::DoNotOptimize(count_scalars(root));
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// fkYAML (access values in a sequence of records by indices and keys)
+void bm_fkyaml_access_records(benchmark::State& st) {
+    const fkyaml::node root = fkyaml::node::deserialize(make_records_source(st.range(0)));
+    const auto num_records = static_cast<std::size_t>(st.range(0));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        double total_price = 0.0;
+        std::size_t total_length = 0;
+        for (std::size_t i = 0; i < num_records; i++) {
+            const fkyaml::node& record = root[i];
+            total_price += record["price"].get_value<double>();
+            total_length += record["owner"]["email"].as_str().size();
+            if (record["active"].get_value<bool>()) {
+                total_length += record["tags"][2].as_str().size();
+            }
+        }
+        benchmark::DoNotOptimize(total_price);
+        benchmark::DoNotOptimize(total_length);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// fkYAML (build, update and shrink a mapping)
+void bm_fkyaml_mutate_mapping(benchmark::State& st) {
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < st.range(0); i++) {
+        keys.push_back("key" + std::to_string(i));
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node root = fkyaml::node::mapping();
+        int64_t value = 0;
+        for (const std::string& key : keys) {
+            root[key] = value++;
+        }
+        for (const std::string& key : keys) {
+            root[key] = fkyaml::node::sequence({fkyaml::node(key), fkyaml::node(true)});
+        }
+        for (std::size_t i = 0; i < keys.size(); i += 2) {
+            root.erase(keys[i]);
+        }
+        benchmark::DoNotOptimize(root.size());
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// Generates a YAML document in which each of the given number of anchored mappings is referred to by 10 aliases.
+std::string make_alias_heavy_source(int64_t num_anchors) {
+    std::string src = "definitions:\n";
+    for (int64_t i = 0; i < num_anchors; i++) {
+        const std::string id = std::to_string(i);
+        src += "  def" + id + ": &def" + id + "\n    name: def" + id + "\n    values: [1, 2, 3]\n";
+    }
+    src += "references:\n";
+    for (int j = 0; j < 10; j++) {
+        for (int64_t i = 0; i < num_anchors; i++) {
+            src += "  - *def" + std::to_string(i) + "\n";
+        }
+    }
+    return src;
+}
+
+// fkYAML (a document with many aliases)
+void bm_fkyaml_parse_aliases(benchmark::State& st) {
+    const std::string src = make_alias_heavy_source(st.range(0));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0) * 10);
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// Generates a YAML document which consists of block mappings nested to the given depth.
+std::string make_deep_block_nesting_source(int64_t depth) {
+    std::string src;
+    for (int64_t i = 0; i < depth; i++) {
+        src += std::string(static_cast<std::size_t>(i) * 2, ' ') + "key" + std::to_string(i) + ":\n";
+    }
+    src += std::string(static_cast<std::size_t>(depth) * 2, ' ') + "leaf\n";
+    return src;
+}
+
+// Generates a YAML document which consists of flow sequences nested to the given depth.
+std::string make_deep_flow_nesting_source(int64_t depth) {
+    const auto size = static_cast<std::size_t>(depth);
+    return std::string(size, '[') + "leaf" + std::string(size, ']') + "\n";
+}
+
+// fkYAML (deeply nested block mappings)
+void bm_fkyaml_parse_deep_block_nesting(benchmark::State& st) {
+    const std::string src = make_deep_block_nesting_source(st.range(0));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// fkYAML (deeply nested flow sequences)
+void bm_fkyaml_parse_deep_flow_nesting(benchmark::State& st) {
+    const std::string src = make_deep_flow_nesting_source(st.range(0));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node n = fkyaml::node::deserialize(src);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * src.size());
+}
+
+// fkYAML (serialize a sequence of floating point numbers)
+void bm_fkyaml_serialize_floats(benchmark::State& st) {
+    const std::vector<double> values = make_float_values(static_cast<std::size_t>(st.range(0)));
+    fkyaml::node root = fkyaml::node::sequence();
+    for (double v : values) {
+        root.as_seq().emplace_back(v);
+    }
+    std::size_t output_size = 0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        std::string out = fkyaml::node::serialize(root);
+        output_size = out.size();
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    st.SetBytesProcessed(st.iterations() * output_size);
+}
+
+// fkYAML (take snapshots of a sequence of records and read a value from each of them)
+// The second argument enables copy-on-write for the records if non-zero.
+void bm_fkyaml_copy_records(benchmark::State& st) {
+    fkyaml::node root = fkyaml::node::deserialize(make_records_source(st.range(0)));
+    if (st.range(1) != 0) {
+        root.enable_copy_on_write();
+    }
+    const auto num_records = static_cast<std::size_t>(st.range(0));
+    std::size_t i = 0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        const fkyaml::node snapshot = root;
+        benchmark::DoNotOptimize(snapshot[i++ % num_records]["owner"]["email"].as_str().size());
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+}
+
+// fkYAML (take snapshots of a sequence of records and update a value in each of them)
+// The second argument enables copy-on-write for the records if non-zero.
+void bm_fkyaml_copy_and_update_records(benchmark::State& st) {
+    fkyaml::node root = fkyaml::node::deserialize(make_records_source(st.range(0)));
+    if (st.range(1) != 0) {
+        root.enable_copy_on_write();
+    }
+    const auto num_records = static_cast<std::size_t>(st.range(0));
+    std::size_t i = 0;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        fkyaml::node snapshot = root;
+        snapshot[i++ % num_records]["owner"]["email"] = "updated@example.com";
+        benchmark::DoNotOptimize(snapshot);
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations());
+}
+
+// Generates a YAML document which consists of a block sequence of Kubernetes Deployment-like manifests.
+std::string make_manifests_source(int64_t num_manifests) {
+    std::string src;
+    for (int64_t i = 0; i < num_manifests; i++) {
+        const std::string id = std::to_string(i);
+        src += "- apiVersion: apps/v1\n  kind: Deployment\n";
+        src += "  metadata:\n    name: app" + id + "\n    labels: {app: app" + id + ", tier: backend}\n";
+        src += "  spec:\n    replicas: 3\n    template:\n      metadata:\n        labels: {app: app" + id + "}\n";
+        src += "      spec:\n        containers:\n";
+        src += "          - name: app\n            image: registry.example.com/app" + id + ":1.0\n";
+        src += "            ports: [{containerPort: 8080}]\n";
+        src += "          - name: sidecar\n            image: envoy:v1\n";
+    }
+    return src;
+}
+
+// The paths queried in each manifest by the bm_fkyaml_query_* benchmarks.
+const std::vector<std::string> manifest_query_paths = {
+    "metadata.name",
+    "spec.replicas",
+    "spec.template.spec.containers[0].image",
+    "spec.template.spec.containers[0].ports[0].containerPort",
+    "spec.template.spec.containers[1].image",
+};
+
+// fkYAML (query values in many manifests with chained operator[] calls)
+void bm_fkyaml_query_chained_subscripts(benchmark::State& st) {
+    const fkyaml::node root = fkyaml::node::deserialize(make_manifests_source(st.range(0)));
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const fkyaml::node& manifest : root) {
+            const fkyaml::node& containers = manifest["spec"]["template"]["spec"]["containers"];
+            benchmark::DoNotOptimize(&manifest["metadata"]["name"]);
+            benchmark::DoNotOptimize(&manifest["spec"]["replicas"]);
+            benchmark::DoNotOptimize(&manifest["spec"]["template"]["spec"]["containers"][0]["image"]);
+            benchmark::DoNotOptimize(&containers[0]["ports"][0]["containerPort"]);
+            benchmark::DoNotOptimize(&containers[1]["image"]);
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0) * manifest_query_paths.size());
+}
+
+// fkYAML (query values in many manifests with paths compiled in advance)
+void bm_fkyaml_query_paths(benchmark::State& st) {
+    const fkyaml::node root = fkyaml::node::deserialize(make_manifests_source(st.range(0)));
+    std::vector<fkyaml::path> paths;
+    for (const std::string& expr : manifest_query_paths) {
+        paths.emplace_back(expr);
+    }
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const fkyaml::node& manifest : root) {
+            for (const fkyaml::path& p : paths) {
+                benchmark::DoNotOptimize(&manifest.at(p));
+            }
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0) * paths.size());
+}
+
+// fkYAML (query values in many manifests with a batch of paths which share their prefixes)
+void bm_fkyaml_query_path_batch(benchmark::State& st) {
+    const fkyaml::node root = fkyaml::node::deserialize(make_manifests_source(st.range(0)));
+    fkyaml::path_batch batch;
+    for (const std::string& expr : manifest_query_paths) {
+        batch.add(fkyaml::path(expr));
+    }
+    std::vector<const fkyaml::node*> results;
+
+    const alloc_stats allocs_before = load_alloc_totals();
+    for (auto _ : st) {
+        for (const fkyaml::node& manifest : root) {
+            manifest.find(batch, results);
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+    set_alloc_counters(st, allocs_before);
+
+    st.SetItemsProcessed(st.iterations() * st.range(0) * batch.size());
+}
+
 // Register benchmarking functions.
 BENCHMARK(bm_fkyaml_parse);
+BENCHMARK(bm_fkyaml_parse_file_pointer);
+BENCHMARK(bm_fkyaml_parse_mapped_file);
+BENCHMARK(bm_fkyaml_parse_arena);
+BENCHMARK(bm_fkyaml_parse_borrowed);
+BENCHMARK(bm_fkyaml_parse_events);
+BENCHMARK(bm_fkyaml_serialize);
+BENCHMARK(bm_fkyaml_serialize_buffer);
 BENCHMARK(bm_yamlcpp_parse);
 
 #ifdef FK_YAML_BM_HAS_LIBFYAML
@@ -132,3 +1046,35 @@ BENCHMARK(bm_libfyaml_parse);
 
 BENCHMARK(bm_rapidyaml_parse_inplace);
 BENCHMARK(bm_rapidyaml_parse_arena);
+
+BENCHMARK_TEMPLATE(bm_fkyaml_parse_large_mapping, ordered_map_node)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(bm_fkyaml_parse_large_mapping, indexed_ordered_map_node)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(bm_fkyaml_lookup_large_mapping, ordered_map_node)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(bm_fkyaml_lookup_large_mapping, indexed_ordered_map_node)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(bm_fkyaml_lookup_string_keys, fkyaml::node)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(bm_fkyaml_lookup_string_keys, ordered_map_node)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(bm_fkyaml_lookup_string_keys, indexed_ordered_map_node)->Arg(100)->Arg(10000);
+BENCHMARK_TEMPLATE(bm_fkyaml_serialize_large_mapping, fkyaml::node)->Arg(1000)->Arg(10000);
+BENCHMARK(bm_format_float_ostringstream);
+BENCHMARK(bm_format_float_to_string);
+BENCHMARK(bm_fkyaml_atof);
+BENCHMARK(bm_fkyaml_parse_floats)->Arg(10000);
+BENCHMARK(bm_fkyaml_parse_long_plain_scalars)->Arg(64)->Arg(1024);
+BENCHMARK(bm_fkyaml_parse_docs)->UseRealTime();
+BENCHMARK(bm_fkyaml_parse_docs_parallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(bm_fkyaml_parse_small_docs);
+BENCHMARK(bm_fkyaml_parse_small_docs_reused);
+BENCHMARK(bm_fkyaml_parse_records)->Arg(1000);
+BENCHMARK(bm_fkyaml_serialize_records)->Arg(1000);
+BENCHMARK(bm_fkyaml_iterate_records)->Arg(1000);
+BENCHMARK(bm_fkyaml_access_records)->Arg(1000);
+BENCHMARK(bm_fkyaml_mutate_mapping)->Arg(1000);
+BENCHMARK(bm_fkyaml_parse_aliases)->Arg(100)->Arg(1000);
+BENCHMARK(bm_fkyaml_parse_deep_block_nesting)->Arg(100)->Arg(1000);
+BENCHMARK(bm_fkyaml_parse_deep_flow_nesting)->Arg(100)->Arg(1000);
+BENCHMARK(bm_fkyaml_serialize_floats)->Arg(10000);
+BENCHMARK(bm_fkyaml_copy_records)->Args({1000, 0})->Args({1000, 1})->ArgNames({"records", "cow"});
+BENCHMARK(bm_fkyaml_copy_and_update_records)->Args({1000, 0})->Args({1000, 1})->ArgNames({"records", "cow"});
+BENCHMARK(bm_fkyaml_query_chained_subscripts)->Arg(1000);
+BENCHMARK(bm_fkyaml_query_paths)->Arg(1000);
+BENCHMARK(bm_fkyaml_query_path_batch)->Arg(1000);